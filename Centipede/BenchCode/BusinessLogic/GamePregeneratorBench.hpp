@@ -0,0 +1,39 @@
+#ifndef GAME_PREGENERATOR_BENCH_HPP
+#define GAME_PREGENERATOR_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GamePregenerator.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include <chrono>
+#include <thread>
+
+/**
+ * Compares the time from "new game" to the state of the game: created on the spot or taken from the pregenerator.
+ * Between two games the pregenerator has the time of a game, here a few milliseconds, to prepare the next one.
+ */
+void runGamePregeneratorBench()
+{
+    printBenchName("GamePregenerator Bench");
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    unsigned int seed = 1;
+    auto onTheSpot = measureNanoseconds(2000, [&]()
+    {
+        GameSimulation::createNewGame(settings_ptr, seed++);
+    });
+
+    GamePregenerator pregenerator(settings_ptr, 1);
+    double takenNanoseconds = 0;
+    int games = 200;
+    for(int game = 0; game < games; game++)
+    {
+        // Playing the game.
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        auto start = std::chrono::steady_clock::now();
+        auto state_ptr = pregenerator.take();
+        takenNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+    printBenchResult("created on the spot", onTheSpot, onTheSpot);
+    printBenchResult("taken from the pregenerator", takenNanoseconds / games, onTheSpot);
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef GAME_SIMULATION_BENCH_HPP
+#define GAME_SIMULATION_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../lib/perf_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Common/GamePhase.hpp"
+#include "../../SourceCode/Input/ReplayInputBuffer.hpp"
+#include <random>
+
+/**
+ * Plays the given number of gameticks without output, a lost game is replaced by a new one.
+ * The starship moves and shoots at random, but the same way in every run.
+ */
+void simulateBenchGames(int gameTicks, std::shared_ptr<PhaseProfiler> profiler_ptr)
+{
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    std::mt19937 script(42);
+    unsigned int seed = 1;
+    auto simulation_ptr = std::make_shared<GameSimulation>(GameSimulation::createNewGame(settings_ptr, seed), profiler_ptr);
+    ReplayInputBuffer input;
+    for(int gameTick = 0; gameTick < gameTicks; gameTick++)
+    {
+        if(!simulation_ptr->alive())
+        {
+            simulation_ptr = std::make_shared<GameSimulation>(GameSimulation::createNewGame(settings_ptr, ++seed), profiler_ptr);
+        }
+        input.setInput(TickInput(gameTick, (Direction) (script() % 5), script() % 2 == 0, false));
+        simulation_ptr->executeGametick(input);
+    }
+}
+
+/**
+ * Shows where the time of a gametick goes, with hardware counters if the system allows them.
+ */
+void runGameSimulationBench()
+{
+    printBenchName("GameSimulation Bench");
+    auto profiler_ptr = std::make_shared<PhaseProfiler>(getGamePhaseNames());
+    simulateBenchGames(200000, profiler_ptr);
+    print(profiler_ptr->report());
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef HEATMAP_BENCH_HPP
+#define HEATMAP_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/BusinessLogic/Heatmap.hpp"
+#include "../../SourceCode/BusinessLogic/HeatmapBatch.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Input/ReplayInputBuffer.hpp"
+#include "../../SourceCode/Input/ScriptedPlayer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Plays the same scripted games with and without heatmap, returns the nanoseconds per gametick.
+ */
+double playHeatmapBenchGames(std::shared_ptr<Heatmap> heatmap_ptr, int games)
+{
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    ReplayInputBuffer input;
+    long gameTicks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(int game = 1; game <= games; game++)
+    {
+        auto saveState_ptr = GameSimulation::createNewGame(settings_ptr, game);
+        GameSimulation simulation(saveState_ptr, nullptr, heatmap_ptr);
+        ScriptedPlayer player(game);
+        while(simulation.alive() && saveState_ptr->getGameTick() < 20000)
+        {
+            input.setInput(player.nextInput(*saveState_ptr));
+            simulation.executeGametick(input);
+        }
+        gameTicks += saveState_ptr->getGameTick();
+    }
+    auto nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return nanoseconds / std::max(gameTicks, 1L);
+}
+
+/**
+ * Cost of the heatmap per gametick, scaling of the batch with its threads and of the merge of big heatmaps.
+ */
+void runHeatmapBench()
+{
+    printBenchName("Heatmap Bench");
+    auto withoutHeatmap = playHeatmapBenchGames(nullptr, 20);
+    auto withHeatmap = playHeatmapBenchGames(std::make_shared<Heatmap>(std::make_shared<CentipedeSettings>()), 20);
+    printBenchResult("gametick without heatmap", withoutHeatmap, withoutHeatmap);
+    printBenchResult("gametick with heatmap", withHeatmap, withoutHeatmap);
+
+    auto workers = std::max(2, (int) std::thread::hardware_concurrency());
+    double oneThread = 0;
+    for(int threads : { 1, workers })
+    {
+        HeatmapBatch batch(4 * workers, threads, 20000, 1);
+        auto start = std::chrono::steady_clock::now();
+        batch.run();
+        auto nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        auto perGametick = nanoseconds / std::max(batch.getGameTicks(), 1L);
+        oneThread = threads == 1 ? perGametick : oneThread;
+        printBenchResult("batch of " + std::to_string(4 * workers) + " games on " + std::to_string(threads) + " threads, per gametick",
+                         perGametick, oneThread);
+    }
+
+    std::vector<std::shared_ptr<Heatmap>> parts;
+    std::vector<Heatmap*> partPointers;
+    for(int part = 0; part < 16; part++)
+    {
+        parts.push_back(std::make_shared<Heatmap>(512, 512));
+        partPointers.push_back(parts.back().get());
+    }
+    double mergedByOne = 0;
+    for(int threads : { 1, workers })
+    {
+        auto merge = measureNanoseconds(5, [&]()
+        {
+            Heatmap merged(512, 512);
+            merged.merge(partPointers, threads);
+        });
+        mergedByOne = threads == 1 ? merge : mergedByOne;
+        printBenchResult("merge of 16 heatmaps 512x512 by " + std::to_string(threads) + " threads", merge, mergedByOne);
+    }
+}
+
+#endif
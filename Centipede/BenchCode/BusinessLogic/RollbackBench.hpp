@@ -0,0 +1,73 @@
+#ifndef ROLLBACK_BENCH_HPP
+#define ROLLBACK_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Input/LatchedInputBuffer.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Costs of a lockstep game with rollback, in the middle of a two player game.
+ * A snapshot is taken before every gametick, a late input re-simulates up to the maximum rollback
+ * with a snapshot per gametick again. Both have to fit into the length of a gametick with room to spare.
+ */
+void runRollbackBench()
+{
+    printBenchName("Rollback Bench");
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    auto state_ptr = GameSimulation::createNewGame(settings_ptr, 1, 2);
+    GameSimulation simulation(state_ptr);
+    LatchedInputBuffer input;
+    LatchedInputBuffer secondInput;
+    auto play = [&]()
+    {
+        auto gameTick = state_ptr->getGameTick() + 1;
+        input.add(TickInput(gameTick, gameTick % 16 < 8 ? Direction::left : Direction::right, gameTick % 4 == 0, false));
+        secondInput.add(TickInput(gameTick, Direction::none, gameTick % 6 == 0, false));
+        simulation.executeGametick(input, secondInput);
+    };
+    for(int gameTick = 0; gameTick < 500 && simulation.alive(); gameTick++)
+    {
+        play();
+    }
+
+    auto rollbackTicks = settings_ptr->getLockstepMaxRollbackTicks();
+    std::vector<std::shared_ptr<SaveState>> snapshots;
+    for(int slot = 0; slot <= rollbackTicks; slot++)
+    {
+        snapshots.push_back(state_ptr->clone());
+    }
+    auto cloned = measureNanoseconds(20000, [&]()
+    {
+        state_ptr->clone();
+    });
+    auto copied = measureNanoseconds(20000, [&]()
+    {
+        snapshots[0]->copyFrom(*state_ptr);
+    });
+    auto gametick = measureNanoseconds(2000, [&]()
+    {
+        snapshots[0]->copyFrom(*state_ptr);
+        play();
+        state_ptr->copyFrom(*snapshots[0]);
+    });
+    auto rollback = measureNanoseconds(2000, [&]()
+    {
+        for(int gameTick = 0; gameTick < rollbackTicks; gameTick++)
+        {
+            snapshots[gameTick + 1]->copyFrom(*state_ptr);
+            play();
+        }
+        state_ptr->copyFrom(*snapshots[1]);
+    });
+    double gameTickLength = settings_ptr->getGameTickLength() * 1000000.0;
+    printBenchResult("length of a gametick", gameTickLength, gameTickLength);
+    printBenchResult("snapshot by clone", cloned, cloned);
+    printBenchResult("snapshot by copy into a kept state", copied, cloned);
+    printBenchResult("snapshot and two player gametick", gametick, gameTickLength);
+    printBenchResult("rollback of " + std::to_string(rollbackTicks) + " gameticks", rollback, gameTickLength);
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef END_TO_END_BENCH_HPP
+#define END_TO_END_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "PtyProcess.hpp"
+#include "TerminalScreen.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+/**
+ * Everything measured during one run of the game on a pseudo terminal.
+ */
+class EndToEndResult
+{
+    public:
+        // Time from writing a keystroke until the moved starship is visible, per keystroke.
+        std::vector<double> latenciesMilliseconds;
+        // Keystrokes, after which the starship didn't move within the timeout.
+        int missedKeystrokes = 0;
+        long frames = 0;
+        size_t bytes = 0;
+        double seconds = 0;
+        double gameCpuMilliseconds = 0;
+        double harnessCpuMilliseconds = 0;
+};
+
+/**
+ * Starts the game on a pseudo terminal, steers the starship left and right and watches the screen.
+ */
+class EndToEndBench
+{
+    private:
+        static constexpr int terminalLines = 50;
+        static constexpr int terminalColumns = 120;
+
+        std::string program;
+        std::string theme;
+        std::string starshipGlyph;
+
+        static double getOwnCpuMilliseconds()
+        {
+            rusage usage;
+            getrusage(RUSAGE_SELF, &usage);
+            return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0
+                 + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+        }
+
+        /**
+         * Reads output until the condition holds or the timeout has passed, returns true if it holds.
+         */
+        template <typename TCondition>
+        static bool readUntil(PtyProcess &process, TerminalScreen &screen, EndToEndResult &result,
+                              std::chrono::steady_clock::time_point deadline, TCondition condition)
+        {
+            std::string output;
+            while(!condition())
+            {
+                auto now = std::chrono::steady_clock::now();
+                if(now >= deadline || !process.isRunning())
+                {
+                    return false;
+                }
+                output.clear();
+                auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+                result.bytes += process.read(output, std::max(timeout, std::chrono::milliseconds(1)));
+                screen.feed(output);
+            }
+            return true;
+        }
+
+    public:
+        EndToEndBench(std::string program, std::string theme, std::string starshipGlyph)
+            : program(program), theme(theme), starshipGlyph(starshipGlyph)
+        {
+        }
+
+        /**
+         * Runs the game for the given number of keystrokes with the given pause in between.
+         */
+        EndToEndResult run(int keystrokes, std::chrono::milliseconds pause)
+        {
+            EndToEndResult result;
+            auto harnessCpuStart = getOwnCpuMilliseconds();
+            PtyProcess process(this->program, { "--theme", this->theme }, terminalLines, terminalColumns);
+            TerminalScreen screen(terminalLines, terminalColumns);
+
+            // Wait for the first frame with the starship.
+            auto started = readUntil(process, screen, result, std::chrono::steady_clock::now() + std::chrono::seconds(5), [&]()
+            {
+                return screen.find(this->starshipGlyph) >= 0;
+            });
+            if(!started)
+            {
+                throw std::logic_error("The game didn't show a starship, is '" + this->program + "' built?");
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            auto framesAtStart = screen.getFrames();
+            auto bytesAtStart = result.bytes;
+            std::string left = "\x1B[D";
+            std::string right = "\x1B[C";
+            for(int keystroke = 0; keystroke < keystrokes && process.isRunning(); keystroke++)
+            {
+                auto position = screen.find(this->starshipGlyph);
+                auto sent = std::chrono::steady_clock::now();
+                // Alternate, so the starship never runs into the edge of the field.
+                process.write(keystroke % 2 == 0 ? left : right);
+                auto moved = readUntil(process, screen, result, sent + std::chrono::seconds(1), [&]()
+                {
+                    auto current = screen.find(this->starshipGlyph);
+                    return current >= 0 && current != position;
+                });
+                if(moved)
+                {
+                    auto latency = std::chrono::steady_clock::now() - sent;
+                    result.latenciesMilliseconds.push_back(std::chrono::duration<double, std::milli>(latency).count());
+                }
+                else
+                {
+                    result.missedKeystrokes++;
+                }
+                readUntil(process, screen, result, std::chrono::steady_clock::now() + pause, []() { return false; });
+            }
+
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            result.frames = screen.getFrames() - framesAtStart;
+            result.bytes -= bytesAtStart;
+            process.terminate();
+            result.gameCpuMilliseconds = std::chrono::duration<double, std::milli>(process.getCpuTime()).count();
+            result.harnessCpuMilliseconds = getOwnCpuMilliseconds() - harnessCpuStart;
+            return result;
+        }
+};
+
+double getPercentile(std::vector<double> values, double percentile)
+{
+    if(values.empty())
+    {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    auto index = (size_t) (percentile * (values.size() - 1) + 0.5);
+    return values[index];
+}
+
+void printEndToEndResult(std::string name, EndToEndResult &result)
+{
+    println(name + ":");
+    println("  input latency: p50 " + std::to_string(getPercentile(result.latenciesMilliseconds, 0.5))
+            + " ms, p95 " + std::to_string(getPercentile(result.latenciesMilliseconds, 0.95))
+            + " ms, max " + std::to_string(getPercentile(result.latenciesMilliseconds, 1))
+            + " ms (" + std::to_string(result.latenciesMilliseconds.size()) + " samples, "
+            + std::to_string(result.missedKeystrokes) + " missed)");
+    auto framesPerSecond = result.seconds > 0 ? result.frames / result.seconds : 0;
+    auto bytesPerFrame = result.frames > 0 ? (double) result.bytes / result.frames : 0;
+    println("  frames: " + std::to_string(framesPerSecond) + " per second, " + std::to_string(bytesPerFrame) + " bytes per frame");
+    println("  cpu time: game " + std::to_string(result.gameCpuMilliseconds) + " ms, harness "
+            + std::to_string(result.harnessCpuMilliseconds) + " ms in " + std::to_string(result.seconds) + " s");
+}
+
+/**
+ * Measures the game as a user sees it. Needs the game binary built with "make Game".
+ */
+void runEndToEndBench(std::string program, int keystrokes)
+{
+    printBenchName("End to end Bench");
+    EndToEndBench compact(program, "compact", "A");
+    auto compactResult = compact.run(keystrokes, std::chrono::milliseconds(50));
+    printEndToEndResult("compact theme", compactResult);
+    EndToEndBench monochrome(program, "monochrome", "A");
+    auto monochromeResult = monochrome.run(keystrokes, std::chrono::milliseconds(50));
+    printEndToEndResult("monochrome theme", monochromeResult);
+}
+
+#endif
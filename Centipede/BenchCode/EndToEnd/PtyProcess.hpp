@@ -0,0 +1,179 @@
+#ifndef PTY_PROCESS_HPP
+#define PTY_PROCESS_HPP
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Runs a program on a pseudo terminal, like a user would in a terminal window.
+ * Everything the program prints can be read and keystrokes can be written to it.
+ */
+class PtyProcess
+{
+    private:
+        int master_fd;
+        pid_t pid;
+        bool exited;
+        rusage usage;
+
+    public:
+        /**
+         * Starts the program with the given arguments on a new terminal of the given size.
+         */
+        PtyProcess(std::string program, std::vector<std::string> arguments, int lines, int columns)
+        {
+            this->exited = false;
+            this->usage = {};
+            this->master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+            if(this->master_fd < 0 || grantpt(this->master_fd) != 0 || unlockpt(this->master_fd) != 0)
+            {
+                throw std::logic_error("Can't open a pseudo terminal.");
+            }
+            std::string slaveName = ptsname(this->master_fd);
+            winsize size = {};
+            size.ws_row = lines;
+            size.ws_col = columns;
+            ioctl(this->master_fd, TIOCSWINSZ, &size);
+
+            std::vector<char*> argv;
+            argv.push_back(const_cast<char*>(program.c_str()));
+            for(auto &argument : arguments)
+            {
+                argv.push_back(const_cast<char*>(argument.c_str()));
+            }
+            argv.push_back(nullptr);
+
+            this->pid = fork();
+            if(this->pid < 0)
+            {
+                throw std::logic_error("Can't start " + program + ".");
+            }
+            if(this->pid == 0)
+            {
+                // Child: the slave becomes the controlling terminal and stdin, stdout and stderr.
+                setsid();
+                int slave_fd = open(slaveName.c_str(), O_RDWR);
+                if(slave_fd < 0)
+                {
+                    _exit(127);
+                }
+                ioctl(slave_fd, TIOCSCTTY, 0);
+                dup2(slave_fd, STDIN_FILENO);
+                dup2(slave_fd, STDOUT_FILENO);
+                dup2(slave_fd, STDERR_FILENO);
+                close(slave_fd);
+                close(this->master_fd);
+                execv(program.c_str(), argv.data());
+                _exit(127);
+            }
+            fcntl(this->master_fd, F_SETFL, fcntl(this->master_fd, F_GETFL) | O_NONBLOCK);
+        }
+
+        ~PtyProcess()
+        {
+            this->terminate();
+            close(this->master_fd);
+        }
+
+        /**
+         * Writes the bytes as if they were typed at once.
+         */
+        void write(const std::string &keys)
+        {
+            size_t written = 0;
+            while(written < keys.size())
+            {
+                auto result = ::write(this->master_fd, keys.data() + written, keys.size() - written);
+                if(result < 0 && (errno == EINTR || errno == EAGAIN))
+                {
+                    continue;
+                }
+                if(result < 0)
+                {
+                    return;
+                }
+                written += result;
+            }
+        }
+
+        /**
+         * Waits up to the timeout for output and appends everything available to the buffer.
+         * Returns the number of bytes read, 0 on timeout or when the program has closed the terminal.
+         */
+        size_t read(std::string &buffer, std::chrono::milliseconds timeout)
+        {
+            pollfd terminal = { this->master_fd, POLLIN, 0 };
+            if(poll(&terminal, 1, timeout.count()) <= 0)
+            {
+                return 0;
+            }
+            char chunk[65536];
+            size_t total = 0;
+            while(true)
+            {
+                auto result = ::read(this->master_fd, chunk, sizeof(chunk));
+                if(result <= 0)
+                {
+                    break;
+                }
+                buffer.append(chunk, result);
+                total += result;
+            }
+            return total;
+        }
+
+        /**
+         * Returns true while the program is running.
+         */
+        bool isRunning()
+        {
+            if(this->exited)
+            {
+                return false;
+            }
+            int status;
+            if(wait4(this->pid, &status, WNOHANG, &this->usage) == this->pid)
+            {
+                this->exited = true;
+            }
+            return !this->exited;
+        }
+
+        /**
+         * Stops the program and waits for it.
+         */
+        void terminate()
+        {
+            if(!this->isRunning())
+            {
+                return;
+            }
+            kill(this->pid, SIGTERM);
+            int status;
+            wait4(this->pid, &status, 0, &this->usage);
+            this->exited = true;
+        }
+
+        /**
+         * Returns the user and system CPU time the program used, available once it has exited.
+         */
+        std::chrono::microseconds getCpuTime()
+        {
+            auto seconds = this->usage.ru_utime.tv_sec + this->usage.ru_stime.tv_sec;
+            auto microseconds = this->usage.ru_utime.tv_usec + this->usage.ru_stime.tv_usec;
+            return std::chrono::microseconds(seconds * 1000000L + microseconds);
+        }
+};
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef TERMINAL_SCREEN_HPP
+#define TERMINAL_SCREEN_HPP
+#include <string>
+#include <vector>
+
+/**
+ * The part of a terminal emulator the game's output needs: printable characters, line breaks,
+ * cursor positioning and clearing the screen. Colours and any other sequence are skipped.
+ *
+ * Also counts the frames the game has drawn. A frame either starts by clearing the screen (full frame)
+ * or ends by parking the cursor below the field without printing anything there (changed lines only).
+ */
+class TerminalScreen
+{
+    private:
+        enum ParserState
+        {
+            text,
+            escape,
+            controlSequence
+        };
+
+        int lines;
+        int columns;
+        // One UTF-8 character per cell.
+        std::vector<std::string> cells;
+        int cursorLine;
+        int cursorColumn;
+        ParserState state;
+        std::string parameters;
+        // Bytes of a UTF-8 character, that is not complete yet.
+        std::string character;
+        int missingCharacterBytes;
+        // The cursor was positioned and nothing was printed since.
+        bool cursorParked;
+        long frames;
+
+        void clear()
+        {
+            for(auto &cell : this->cells)
+            {
+                cell = " ";
+            }
+            this->cursorLine = 0;
+            this->cursorColumn = 0;
+        }
+
+        void endParkedFrame()
+        {
+            if(this->cursorParked)
+            {
+                this->frames++;
+                this->cursorParked = false;
+            }
+        }
+
+        void print(const std::string &character)
+        {
+            this->cursorParked = false;
+            if(this->cursorColumn >= this->columns)
+            {
+                // Auto wrap.
+                this->cursorColumn = 0;
+                this->cursorLine++;
+            }
+            if(this->cursorLine >= this->lines)
+            {
+                this->scroll();
+            }
+            this->cells[this->cursorLine * this->columns + this->cursorColumn] = character;
+            this->cursorColumn++;
+        }
+
+        void scroll()
+        {
+            this->cells.erase(this->cells.begin(), this->cells.begin() + this->columns);
+            this->cells.resize(this->lines * this->columns, " ");
+            this->cursorLine = this->lines - 1;
+        }
+
+        std::vector<int> parseParameters()
+        {
+            std::vector<int> values;
+            int value = 0;
+            bool hasValue = false;
+            for(auto character : this->parameters)
+            {
+                if(character >= '0' && character <= '9')
+                {
+                    value = value * 10 + (character - '0');
+                    hasValue = true;
+                    continue;
+                }
+                values.push_back(hasValue ? value : 0);
+                value = 0;
+                hasValue = false;
+            }
+            values.push_back(hasValue ? value : 0);
+            return values;
+        }
+
+        void executeControlSequence(char command)
+        {
+            auto values = this->parseParameters();
+            switch(command)
+            {
+                case 'H':
+                case 'f':
+                {
+                    this->endParkedFrame();
+                    auto line = values.size() > 0 && values[0] > 0 ? values[0] : 1;
+                    auto column = values.size() > 1 && values[1] > 0 ? values[1] : 1;
+                    this->cursorLine = std::min(line, this->lines) - 1;
+                    this->cursorColumn = std::min(column, this->columns) - 1;
+                    this->cursorParked = true;
+                    break;
+                }
+                case 'J':
+                {
+                    if(values[0] == 2)
+                    {
+                        this->endParkedFrame();
+                        this->frames++;
+                        auto line = this->cursorLine;
+                        auto column = this->cursorColumn;
+                        this->clear();
+                        this->cursorLine = line;
+                        this->cursorColumn = column;
+                    }
+                    break;
+                }
+                default:
+                    // Colours and everything else don't change the characters on the screen.
+                    break;
+            }
+        }
+
+    public:
+        TerminalScreen(int lines, int columns)
+            : lines(lines), columns(columns), cells(lines * columns, " ")
+        {
+            this->cursorLine = 0;
+            this->cursorColumn = 0;
+            this->state = ParserState::text;
+            this->missingCharacterBytes = 0;
+            this->cursorParked = false;
+            this->frames = 0;
+        }
+
+        /**
+         * Applies the output of the program to the screen.
+         */
+        void feed(const std::string &output)
+        {
+            for(auto byte : output)
+            {
+                unsigned char value = byte;
+                switch(this->state)
+                {
+                    case ParserState::escape:
+                        this->state = value == '[' ? ParserState::controlSequence : ParserState::text;
+                        this->parameters.clear();
+                        continue;
+                    case ParserState::controlSequence:
+                        if(value >= 0x40 && value <= 0x7E)
+                        {
+                            this->executeControlSequence(byte);
+                            this->state = ParserState::text;
+                        }
+                        else
+                        {
+                            this->parameters += byte;
+                        }
+                        continue;
+                    default:
+                        break;
+                }
+
+                if(this->missingCharacterBytes > 0)
+                {
+                    this->character += byte;
+                    if(--this->missingCharacterBytes == 0)
+                    {
+                        this->print(this->character);
+                    }
+                    continue;
+                }
+                if(value == 0x1B)
+                {
+                    this->state = ParserState::escape;
+                }
+                else if(value == '\r')
+                {
+                    this->cursorColumn = 0;
+                }
+                else if(value == '\n')
+                {
+                    this->cursorParked = false;
+                    this->cursorLine++;
+                    if(this->cursorLine >= this->lines)
+                    {
+                        this->scroll();
+                    }
+                }
+                else if(value >= 0xC0)
+                {
+                    this->character = std::string(1, byte);
+                    this->missingCharacterBytes = value >= 0xF0 ? 3 : value >= 0xE0 ? 2 : 1;
+                }
+                else if(value >= 0x20)
+                {
+                    this->print(std::string(1, byte));
+                }
+            }
+        }
+
+        /**
+         * Returns the number of frames, that were completely drawn so far.
+         * The last frame of changed lines is only counted once the next one starts.
+         */
+        long getFrames()
+        {
+            return this->frames;
+        }
+
+        /**
+         * Searches the screen for the character and returns its cell index, -1 if it is not shown.
+         */
+        int find(const std::string &character)
+        {
+            for(size_t cell = 0; cell < this->cells.size(); cell++)
+            {
+                if(this->cells[cell] == character)
+                {
+                    return cell;
+                }
+            }
+            return -1;
+        }
+
+        std::string getLine(int line)
+        {
+            std::string result;
+            for(int column = 0; column < this->columns; column++)
+            {
+                result += this->cells[line * this->columns + column];
+            }
+            return result;
+        }
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef MUSHROOM_FIELD_GENERATOR_BENCH_HPP
+#define MUSHROOM_FIELD_GENERATOR_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../lib/CppRandom.hpp"
+#include "../../SourceCode/Common/Utils.hpp"
+#include "../../SourceCode/GameObjects/MushroomFieldGenerator.hpp"
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Fills the field the way MushroomMap did before the generator: two draws from the global generator per cell.
+ */
+void generateFieldPerCell(std::vector<std::vector<int8_t>> &field, int dividend, int divisor, int health)
+{
+    for(auto &row : field)
+    {
+        for(auto &cell : row)
+        {
+            cell = 0;
+            if(rollRandomWithChance(dividend, divisor))
+            {
+                cell = health - GetRandomNumberBetween(0, health - 1);
+            }
+        }
+    }
+}
+
+void benchMushroomFieldGeneratorForSize(int lines, int width, int iterations)
+{
+    std::vector<std::vector<int8_t>> field(lines, std::vector<int8_t>(width, 0));
+    MushroomFieldGenerator generator(1, width, lines, 1, 20, 3);
+    auto name = std::to_string(lines) + "x" + std::to_string(width);
+
+    auto perCell = measureNanoseconds(iterations, [&]()
+    {
+        generateFieldPerCell(field, 1, 20, 3);
+    });
+    auto scalarRows = measureNanoseconds(iterations, [&]()
+    {
+        for(int line = 0; line < lines; line++)
+        {
+            generator.generateRow(line, field[line].data(), true);
+        }
+    });
+    auto vectorizedRows = measureNanoseconds(iterations, [&]()
+    {
+        generator.generate(field, 1);
+    });
+    auto parallelBands = measureNanoseconds(iterations, [&]()
+    {
+        generator.generate(field);
+    });
+    printBenchResult(name + " per cell draws", perCell, perCell);
+    printBenchResult(name + " scalar rows", scalarRows, perCell);
+    printBenchResult(name + " vectorized rows", vectorizedRows, perCell);
+    printBenchResult(name + " parallel bands (" + std::to_string(std::thread::hardware_concurrency()) + " threads)", parallelBands, perCell);
+}
+
+/**
+ * Compares the generation of the initial mushroom field for the default and for huge fields.
+ */
+void runMushroomFieldGeneratorBench()
+{
+    printBenchName("MushroomFieldGenerator Bench");
+    benchMushroomFieldGeneratorForSize(23, 29, 2000);
+    benchMushroomFieldGeneratorForSize(2048, 2048, 3);
+}
+
+#endif
@@ -0,0 +1,62 @@
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> allocationCount(0);
+    std::atomic<uint64_t> allocatedBytes(0);
+
+    void* countedAllocation(std::size_t size)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        auto memory = std::malloc(size == 0 ? 1 : size);
+        if(memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return memory;
+    }
+}
+
+uint64_t getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+uint64_t getAllocatedBytes()
+{
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    return countedAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocation(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,13 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+#include <cstdint>
+
+/**
+ * Heap allocations of the whole bench program since its start.
+ * Counted by the replaced global operator new in AllocationCounter.cpp, so only linked into the benchmarks.
+ */
+uint64_t getAllocationCount();
+
+uint64_t getAllocatedBytes();
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef SESSION_POOL_BENCH_HPP
+#define SESSION_POOL_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Common/SessionMemoryPool.hpp"
+#include "../../SourceCode/Input/ReplayInputBuffer.hpp"
+#include "../../SourceCode/Input/ScriptedPlayer.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/ConsoleOutput.hpp"
+#include "../../SourceCode/UI/MonochromeTheme.hpp"
+#include "../../SourceCode/UI/NullOutputBuffer.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include "AllocationCounter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * One hosted game: played by the ScriptedPlayer and rendered into a sink, optionally with its own memory pool.
+ */
+class BenchSession
+{
+    private:
+        // Declared first, so that it is released after everything of the session.
+        std::unique_ptr<SessionMemory> memory_ptr;
+        NullOutputBuffer sink;
+        std::ostream output;
+        std::shared_ptr<ConsoleOutput> ui_ptr;
+        std::shared_ptr<SaveState> saveState_ptr;
+        std::unique_ptr<GameSimulation> simulation_ptr;
+        std::unique_ptr<ScriptedPlayer> player_ptr;
+        std::shared_ptr<CentipedeSettings> settings_ptr;
+        StandardTheme theme;
+        ReplayInputBuffer input;
+        unsigned int seed;
+
+    public:
+        BenchSession(std::shared_ptr<CentipedeSettings> settings_ptr, unsigned int seed, bool pooled)
+            : output(&sink)
+        {
+            this->settings_ptr = settings_ptr;
+            this->seed = seed;
+            if(pooled)
+            {
+                this->memory_ptr = std::make_unique<SessionMemory>();
+            }
+            this->ui_ptr = std::make_shared<ConsoleOutput>(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), this->output);
+        }
+
+        /**
+         * Plays one gametick on the calling worker, a lost game is replaced by a new one.
+         */
+        void executeGametick()
+        {
+            std::unique_ptr<SessionMemoryScope> scope_ptr;
+            if(this->memory_ptr != nullptr)
+            {
+                scope_ptr = std::make_unique<SessionMemoryScope>(*(this->memory_ptr));
+            }
+            if(this->simulation_ptr == nullptr || !this->simulation_ptr->alive())
+            {
+                this->saveState_ptr = GameSimulation::createNewGame(this->settings_ptr, this->seed);
+                this->simulation_ptr = std::make_unique<GameSimulation>(this->saveState_ptr);
+                this->player_ptr = std::make_unique<ScriptedPlayer>(this->seed);
+                this->seed += 1000;
+            }
+            this->input.setInput(this->player_ptr->nextInput(*(this->saveState_ptr)));
+            this->simulation_ptr->executeGametick(this->input);
+            this->ui_ptr->displayImage(*(this->saveState_ptr), *(this->settings_ptr), this->theme);
+        }
+};
+
+/**
+ * Hosts the sessions on the workers, every worker plays its share of the sessions in turns.
+ * Returns the nanoseconds per gametick of one session and stores the global heap allocations per gametick.
+ */
+double hostBenchSessions(int sessions, int workers, int gameTicks, bool pooled, double &allocationsPerGametick)
+{
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    std::vector<std::unique_ptr<BenchSession>> hosted;
+    for(int session = 0; session < sessions; session++)
+    {
+        hosted.push_back(std::make_unique<BenchSession>(settings_ptr, session + 1, pooled));
+    }
+    auto playShare = [&](int worker)
+    {
+        for(int gameTick = 0; gameTick < gameTicks; gameTick++)
+        {
+            for(int session = worker; session < sessions; session += workers)
+            {
+                hosted[session]->executeGametick();
+            }
+        }
+    };
+
+    auto allocations = getAllocationCount();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for(int worker = 1; worker < workers; worker++)
+    {
+        threads.emplace_back(playShare, worker);
+    }
+    playShare(0);
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+    auto nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    allocationsPerGametick = (double) (getAllocationCount() - allocations) / ((double) sessions * gameTicks);
+    return nanoseconds / ((double) sessions * gameTicks);
+}
+
+/**
+ * Compares sessions allocating from the global heap with sessions allocating from their own pools,
+ * for a growing number of sessions on the same workers.
+ */
+void runSessionPoolBench()
+{
+    printBenchName("SessionMemoryPool Bench");
+    auto workers = std::max(2, (int) std::thread::hardware_concurrency());
+    for(int sessions : { workers, 4 * workers, 16 * workers })
+    {
+        auto gameTicks = 32000 / sessions;
+        double globalAllocations = 0;
+        double pooledAllocations = 0;
+        auto global = hostBenchSessions(sessions, workers, gameTicks, false, globalAllocations);
+        auto pooled = hostBenchSessions(sessions, workers, gameTicks, true, pooledAllocations);
+        auto name = std::to_string(sessions) + " sessions on " + std::to_string(workers) + " workers";
+        printBenchResult(name + " global heap (" + std::to_string(globalAllocations) + " allocs/tick)", global, global);
+        printBenchResult(name + " session pools (" + std::to_string(pooledAllocations) + " allocs/tick)", pooled, global);
+    }
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef BLOCK_CODEC_BENCH_HPP
+#define BLOCK_CODEC_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Persistence/SaveStateSerializer.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * Loads the states of many games from a raw file and from a compressed file, and compresses them.
+ * The files are in the page cache after the first iteration, so this compares with the fastest disk there is.
+ */
+void runBlockCodecBench()
+{
+    printBenchName("BlockCodec Bench");
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    SaveStateSerializer serializer(settings_ptr);
+    BinaryWriter writer;
+    for(unsigned int seed = 1; seed <= 1000; seed++)
+    {
+        serializer.serialize(*GameSimulation::createNewGame(settings_ptr, seed), writer);
+    }
+    auto &raw = writer.getBytes();
+    std::vector<char> compressed;
+    BlockCodec::compress(raw.data(), raw.size(), compressed);
+
+    std::string rawPath = "blockCodecBench.raw";
+    std::string compressedPath = "blockCodecBench.lz";
+    File(rawPath).writeAllBytes(raw.size(), raw.data());
+    File(compressedPath).writeAllBytes(compressed.size(), compressed.data());
+    std::vector<char> decompressed(raw.size());
+
+    auto loadRaw = measureNanoseconds(200, [&]()
+    {
+        File(rawPath).readAllBytes();
+    });
+    auto loadCompressed = measureNanoseconds(200, [&]()
+    {
+        auto bytes_ptr = File(compressedPath).readAllBytes();
+        BlockCodec::decompress(bytes_ptr->data(), bytes_ptr->size(), decompressed.data(), decompressed.size());
+    });
+    auto decompress = measureNanoseconds(200, [&]()
+    {
+        BlockCodec::decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+    });
+    auto compress = measureNanoseconds(200, [&]()
+    {
+        std::vector<char> output;
+        BlockCodec::compress(raw.data(), raw.size(), output);
+    });
+    std::remove(rawPath.c_str());
+    std::remove(compressedPath.c_str());
+
+    auto sizes = std::to_string(raw.size()) + " -> " + std::to_string(compressed.size()) + " bytes";
+    printBenchResult("load raw states (" + std::to_string(raw.size()) + " bytes)", loadRaw, loadRaw);
+    printBenchResult("load compressed states (" + sizes + ")", loadCompressed, loadRaw);
+    printBenchResult("decompress (" + std::to_string((int) (raw.size() / decompress * 1000)) + " MB/s)", decompress, loadRaw);
+    printBenchResult("compress (" + std::to_string((int) (raw.size() / compress * 1000)) + " MB/s)", compress, loadRaw);
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef STATE_MIRROR_BENCH_HPP
+#define STATE_MIRROR_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Input/LatchedInputBuffer.hpp"
+#include "../../SourceCode/Persistence/Autosaver.hpp"
+#include "../../SourceCode/Persistence/StateMirror.hpp"
+#include <cstdio>
+#include <memory>
+#include <string>
+
+/**
+ * Costs on the game thread of mirroring every gametick, in the middle of a game.
+ * Compared with a gametick itself and with what an autosave costs the game thread and its background thread.
+ */
+void runStateMirrorBench()
+{
+    printBenchName("StateMirror Bench");
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    auto state_ptr = GameSimulation::createNewGame(settings_ptr, 1);
+    GameSimulation simulation(state_ptr);
+    LatchedInputBuffer input;
+    for(int gameTick = 1; gameTick <= 500 && simulation.alive(); gameTick++)
+    {
+        input.add(TickInput(gameTick, gameTick % 16 < 8 ? Direction::left : Direction::right, gameTick % 4 == 0, false));
+        simulation.executeGametick(input);
+    }
+
+    std::string mirrorPath = "stateMirrorBench.cmir";
+    std::string autosavePath = "stateMirrorBench.csav";
+    StateMirror mirror(mirrorPath, settings_ptr);
+    auto update = measureNanoseconds(20000, [&]()
+    {
+        mirror.update(*state_ptr);
+    });
+    auto handOver = measureNanoseconds(20000, [&]()
+    {
+        state_ptr->clone();
+    });
+    Autosaver autosaver(autosavePath, settings_ptr);
+    auto autosave = measureNanoseconds(50, [&]()
+    {
+        autosaver.save(state_ptr->clone());
+        autosaver.waitUntilWritten();
+    });
+    mirror.discard();
+    autosaver.discard();
+
+    double gameTickLength = settings_ptr->getGameTickLength() * 1000000.0;
+    printBenchResult("length of a gametick", gameTickLength, gameTickLength);
+    printBenchResult("mirror update per gametick", update, gameTickLength);
+    printBenchResult("autosave hand over on the game thread", handOver, update);
+    printBenchResult("autosave written durably in the background", autosave, update);
+}
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef REPLAY_MACRO_BENCH_HPP
+#define REPLAY_MACRO_BENCH_HPP
+#include "../../lib/bench_lib.hpp"
+#include "../../lib/perf_lib.hpp"
+#include "../../SourceCode/BusinessLogic/ReplayPlayer.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Common/GamePhase.hpp"
+#include "../../SourceCode/Persistence/ReplayReader.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/ConsoleOutput.hpp"
+#include "../../SourceCode/UI/MonochromeTheme.hpp"
+#include "../../SourceCode/UI/NullOutputBuffer.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include "../Memory/AllocationCounter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Plays the recorded games of the corpus through the simulation and the renderer as fast as possible.
+ * The frames go to a sink, that discards them.
+ * Results are compared with a stored baseline, which is the number to watch from release to release.
+ */
+class ReplayMacroBench
+{
+    private:
+        std::string corpusDirectory;
+        std::vector<std::string> replayNames;
+        int repetitions;
+
+        /**
+         * Plays the replay the given number of times and adds its measurements to the results.
+         */
+        void measureReplay(std::string replayName, std::map<std::string, double> &results)
+        {
+            auto settings_ptr = std::make_shared<CentipedeSettings>();
+            auto reader_ptr = std::make_shared<ReplayReader>(this->corpusDirectory + "/" + replayName + ".crpl", settings_ptr);
+            auto profiler_ptr = std::make_shared<PhaseProfiler>(getGamePhaseNames());
+            NullOutputBuffer sink;
+            std::ostream output(&sink);
+            auto ui_ptr = std::make_shared<ConsoleOutput>(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), output);
+            auto theme_ptr = std::make_shared<StandardTheme>();
+
+            // Warm up without measuring, e.g. the glyph tables of the renderer.
+            ReplayPlayer(reader_ptr, ui_ptr, theme_ptr).play(0, false);
+
+            long gameTicks = 0;
+            auto allocations = getAllocationCount();
+            auto bytes = sink.getBytes();
+            auto start = std::chrono::steady_clock::now();
+            for(int repetition = 0; repetition < this->repetitions; repetition++)
+            {
+                ReplayPlayer player(reader_ptr, ui_ptr, theme_ptr, profiler_ptr);
+                gameTicks += player.play(0, false);
+            }
+            auto nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            allocations = getAllocationCount() - allocations;
+            bytes = sink.getBytes() - bytes;
+            gameTicks = std::max(gameTicks, 1L);
+
+            results[replayName + ".gameticks"] = gameTicks / this->repetitions;
+            results[replayName + ".gameticks_per_second"] = gameTicks / (nanoseconds / 1e9);
+            results[replayName + ".ns_per_gametick"] = nanoseconds / gameTicks;
+            for(int phase = 0; phase < profiler_ptr->getPhaseCount(); phase++)
+            {
+                auto phaseNanoseconds = std::chrono::duration<double, std::nano>(profiler_ptr->getTotalTime(phase)).count();
+                // Names are stored in the baseline separated by white space.
+                auto phaseName = profiler_ptr->getPhaseName(phase);
+                std::replace(phaseName.begin(), phaseName.end(), ' ', '_');
+                results[replayName + "." + phaseName + "_ns_per_gametick"] = phaseNanoseconds / gameTicks;
+            }
+            results[replayName + ".allocations_per_gametick"] = (double) allocations / gameTicks;
+            results[replayName + ".output_bytes_per_gametick"] = (double) bytes / gameTicks;
+        }
+
+        /**
+         * Returns true for measurements, where a higher value is better.
+         */
+        static bool higherIsBetter(const std::string &name)
+        {
+            return name.find("per_second") != std::string::npos;
+        }
+
+        static bool isGameTickCount(const std::string &name)
+        {
+            auto suffix = std::string(".gameticks");
+            return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+        }
+
+    public:
+        ReplayMacroBench(std::string corpusDirectory, int repetitions)
+        {
+            this->corpusDirectory = corpusDirectory;
+            // Short game, long game and a game in late rounds with fast and long centipedes.
+            this->replayNames = { "short", "long", "late-rounds" };
+            this->repetitions = repetitions;
+        }
+
+        std::string getBaselinePath()
+        {
+            return this->corpusDirectory + "/baseline.txt";
+        }
+
+        /**
+         * Plays every replay of the corpus and returns the measurements by name, e.g. "long.ns_per_gametick".
+         */
+        std::map<std::string, double> run()
+        {
+            std::map<std::string, double> results;
+            for(auto &replayName : this->replayNames)
+            {
+                this->measureReplay(replayName, results);
+            }
+            return results;
+        }
+
+        /**
+         * Reads the measurements of an earlier run, empty if there is none.
+         */
+        std::map<std::string, double> loadBaseline()
+        {
+            std::map<std::string, double> baseline;
+            std::ifstream file(this->getBaselinePath());
+            std::string name;
+            double value;
+            while(file >> name >> value)
+            {
+                baseline[name] = value;
+            }
+            return baseline;
+        }
+
+        void saveBaseline(std::map<std::string, double> &results)
+        {
+            std::ofstream file(this->getBaselinePath());
+            for(auto &result : results)
+            {
+                file << result.first << " " << std::fixed << std::setprecision(2) << result.second << "\n";
+            }
+        }
+
+        /**
+         * Prints every measurement next to its baseline and the relative change, green if it got better.
+         */
+        static void printResults(std::map<std::string, double> &results, std::map<std::string, double> &baseline)
+        {
+            AnsiExcapeCodes ansiExcapeCodes;
+            for(auto &result : results)
+            {
+                std::ostringstream line;
+                line << std::left << std::setw(44) << result.first << std::right << std::fixed << std::setprecision(2)
+                     << std::setw(14) << result.second;
+                auto entry = baseline.find(result.first);
+                if(entry != baseline.end() && entry->second != 0)
+                {
+                    auto change = (result.second - entry->second) / entry->second * 100;
+                    auto better = higherIsBetter(result.first) ? change >= 0 : change <= 0;
+                    // A different number of gameticks means the game rules changed, which is neither better nor worse.
+                    auto unchanged = std::abs(change) < 0.05 || isGameTickCount(result.first);
+                    auto colour = unchanged ? ansiExcapeCodes.foregroundDefault
+                                : better ? ansiExcapeCodes.foregroundGreen : ansiExcapeCodes.foregroundRed;
+                    line << "  baseline " << std::setw(14) << entry->second << "  " << colour
+                         << std::showpos << std::setprecision(1) << change << "%" << std::noshowpos
+                         << ansiExcapeCodes.foregroundDefault;
+                }
+                println(line.str());
+            }
+        }
+};
+
+/**
+ * Runs the macro benchmark on the checked in corpus, optionally stores the result as the new baseline.
+ */
+void runReplayMacroBench(std::string corpusDirectory, bool updateBaseline)
+{
+    printBenchName("Replay Macro Bench");
+    ReplayMacroBench bench(corpusDirectory, 3);
+    auto results = bench.run();
+    auto baseline = bench.loadBaseline();
+    ReplayMacroBench::printResults(results, baseline);
+    if(baseline.empty())
+    {
+        println("No baseline in " + bench.getBaselinePath() + " yet.");
+    }
+    if(updateBaseline)
+    {
+        bench.saveBaseline(results);
+        println("Baseline written to " + bench.getBaselinePath() + ".");
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#include "../lib/bench_lib.hpp"
+#include "UI/GlyphRowSerializerBench.hpp"
+#include "UI/ThemeAtlasBench.hpp"
+#include "UI/MenuLayoutBench.hpp"
+#include "GameObjects/MushroomFieldGeneratorBench.hpp"
+#include "BusinessLogic/GameSimulationBench.hpp"
+#include "BusinessLogic/GamePregeneratorBench.hpp"
+#include "BusinessLogic/HeatmapBench.hpp"
+#include "BusinessLogic/RollbackBench.hpp"
+#include "Memory/SessionPoolBench.hpp"
+#include "Persistence/BlockCodecBench.hpp"
+#include "Persistence/StateMirrorBench.hpp"
+#include "Replay/ReplayMacroBench.hpp"
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+#include "EndToEnd/EndToEndBench.hpp"
+#endif
+#include <string>
+
+// ###############################
+// Run Benchmarks
+// ###############################
+
+/**
+ * Benchmarks for the rendering of the UI.
+ */
+void runUIBenchSuite()
+{
+    runGlyphRowSerializerBench();
+    runThemeAtlasBench();
+    runMenuLayoutBench();
+}
+
+/**
+ * Benchmarks for the game objects.
+ */
+void runGameObjectsBenchSuite()
+{
+    runMushroomFieldGeneratorBench();
+}
+
+/**
+ * Benchmarks for the game rules.
+ */
+void runBusinessLogicBenchSuite()
+{
+    runGameSimulationBench();
+    runGamePregeneratorBench();
+    runHeatmapBench();
+    runRollbackBench();
+}
+
+/**
+ * Benchmarks for the memory of the hosted sessions.
+ */
+void runMemoryBenchSuite()
+{
+    runSessionPoolBench();
+}
+
+/**
+ * Benchmarks for the save and replay files.
+ */
+void runPersistenceBenchSuite()
+{
+    runBlockCodecBench();
+    runStateMirrorBench();
+}
+
+/**
+ * Runs the built game on a pseudo terminal and measures latency, frames and cpu time.
+ * Needs the game binary, e.g. "./centipedeBench --end-to-end ./centipede".
+ */
+void runEndToEndBenchSuite(std::string program)
+{
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    runEndToEndBench(program, 100);
+#endif
+}
+
+/**
+ * Plays the recorded games of the corpus through simulation and renderer and compares them with the baseline.
+ * E.g. "./centipedeBench --replays BenchCode/Replays --update-baseline".
+ */
+void runReplayBenchSuite(std::string corpusDirectory, bool updateBaseline)
+{
+    runReplayMacroBench(corpusDirectory, updateBaseline);
+}
+
+int main(int argc, char** argv)
+{
+    if(argc > 1 && std::string(argv[1]) == "--replays")
+    {
+        std::string corpusDirectory = argc > 2 && std::string(argv[2]) != "--update-baseline" ? argv[2] : "BenchCode/Replays";
+        bool updateBaseline = std::string(argv[argc - 1]) == "--update-baseline";
+        runReplayBenchSuite(corpusDirectory, updateBaseline);
+        return 0;
+    }
+    if(argc > 1 && std::string(argv[1]) == "--end-to-end")
+    {
+        runEndToEndBenchSuite(argc > 2 ? argv[2] : "./centipede");
+        return 0;
+    }
+    runUIBenchSuite();
+    runGameObjectsBenchSuite();
+    runBusinessLogicBenchSuite();
+    runMemoryBenchSuite();
+    runPersistenceBenchSuite();
+}
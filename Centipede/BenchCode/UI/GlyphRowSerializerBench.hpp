@@ -0,0 +1,93 @@
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/UI/GlyphCanvas.hpp"
+#include "../../SourceCode/UI/GlyphTable.hpp"
+#include "../../SourceCode/UI/GlyphRowSerializer.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include <random>
+
+/**
+ * Fills the canvas like a crowded playing field: mostly white space, some mushrooms and centipedes.
+ */
+void fillBenchCanvas(GlyphCanvas &canvas)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<> distribution(0, 19);
+    for(int line = 0; line < canvas.getLines(); line++)
+    {
+        for(int column = 0; column < canvas.getColumns(); column++)
+        {
+            auto roll = distribution(generator);
+            auto glyph = roll < GlyphId::glyphCount ? (GlyphId) roll : GlyphId::whiteSpaceGlyph;
+            canvas.set(line, column, glyph);
+        }
+    }
+}
+
+/**
+ * Serializes all rows the way ConsoleOutput::renderFrame did before the serializer: one append per cell.
+ */
+size_t serializeRowsPerCell(GlyphCanvas &canvas, GlyphTable &glyphs)
+{
+    size_t bytes = 0;
+    for(int line = 0; line < canvas.getLines(); line++)
+    {
+        auto cells = canvas.getLine(line);
+        std::string imageLine;
+        for(int column = 0; column < canvas.getColumns(); column++)
+        {
+            imageLine += glyphs.getGlyph(cells[column]);
+        }
+        bytes += imageLine.size();
+    }
+    return bytes;
+}
+
+/**
+ * Serializes all rows the way ConsoleOutput::renderFrame does now.
+ */
+size_t serializeRowsInBulk(GlyphCanvas &canvas, GlyphRowSerializer &serializer)
+{
+    size_t bytes = 0;
+    auto &glyphs = serializer.getGlyphTable();
+    for(int line = 0; line < canvas.getLines(); line++)
+    {
+        auto cells = canvas.getLine(line);
+        std::string imageLine;
+        imageLine.reserve(glyphs.getByteSize(cells, canvas.getColumns()));
+        serializer.serialize(cells, canvas.getColumns(), imageLine);
+        bytes += imageLine.size();
+    }
+    return bytes;
+}
+
+void benchGlyphRowSerializerForTheme(std::string themeName, ITheme &theme, GlyphCanvas &canvas)
+{
+    auto glyphs_ptr = std::make_shared<GlyphTable>(theme);
+    GlyphRowSerializer serializer(glyphs_ptr);
+    volatile size_t sink = 0;
+    int iterations = 50;
+
+    auto perCell = measureNanoseconds(iterations, [&]()
+    {
+        sink = sink + serializeRowsPerCell(canvas, *glyphs_ptr);
+    });
+    auto bulk = measureNanoseconds(iterations, [&]()
+    {
+        sink = sink + serializeRowsInBulk(canvas, serializer);
+    });
+    printBenchResult(themeName + " per cell append", perCell, perCell);
+    printBenchResult(themeName + " row serializer", bulk, perCell);
+}
+
+void runGlyphRowSerializerBench()
+{
+    printBenchName("GlyphRowSerializer Bench (512 x 1024 cells)");
+    GlyphCanvas canvas(512, 1024);
+    fillBenchCanvas(canvas);
+
+    CompactTheme compactTheme;
+    StandardTheme standardTheme;
+    benchGlyphRowSerializerForTheme("Compact theme", compactTheme, canvas);
+    benchGlyphRowSerializerForTheme("Standard theme", standardTheme, canvas);
+}
@@ -0,0 +1,61 @@
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/UI/MenuLayout.hpp"
+#include "../../SourceCode/UI/ConsoleOutput.hpp"
+#include "../../SourceCode/UI/NullOutputBuffer.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/MonochromeTheme.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include <string>
+#include <vector>
+
+void runMenuLayoutBench()
+{
+    printBenchName("MenuLayout Bench");
+    StandardTheme theme;
+    ThemeAtlas atlas(theme);
+    std::string title = "Centipede";
+    std::vector<std::string> textLines(8, std::string(3000, 'x'));
+    std::vector<std::string> options;
+    for(int option = 0; option < 20; option++)
+    {
+        options.push_back("Option " + std::to_string(option));
+    }
+    volatile size_t sink = 0;
+    int iterations = 200;
+
+    // Field of 512 x 1024 cells.
+    auto layout = measureNanoseconds(iterations, [&]()
+    {
+        MenuLayout menu(title, ConsoleColour::Red, textLines, options, 1024, 512, atlas);
+        sink = sink + menu.select(0).size();
+    });
+    MenuLayout menu(title, ConsoleColour::Red, textLines, options, 1024, 512, atlas);
+    int selected = 0;
+    auto select = measureNanoseconds(iterations, [&]()
+    {
+        selected = (selected + 1) % options.size();
+        sink = sink + menu.select(selected).size();
+    });
+    printBenchResult("lay out 512 x 1024 menu", layout, layout);
+    printBenchResult("move selection in 512 x 1024 menu", select, layout);
+
+    // Whole redraw on a key press, on the field of the settings.
+    NullOutputBuffer nullBuffer;
+    std::ostream output(&nullBuffer);
+    ConsoleOutput ui(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), output);
+    CentipedeSettings settings;
+    std::vector<std::string> otherOptions = options;
+    int redraw = 0;
+    auto fullMenu = measureNanoseconds(iterations, [&]()
+    {
+        // Other content every time -> laid out and drawn in full.
+        otherOptions[0] = redraw++ % 2 ? "Continue" : "Resume";
+        ui.displayMenu(title, ConsoleColour::Red, textLines, otherOptions, 0, theme, settings);
+    });
+    auto keyPress = measureNanoseconds(iterations, [&]()
+    {
+        ui.displayMenu(title, ConsoleColour::Red, textLines, options, redraw++ % options.size(), theme, settings);
+    });
+    printBenchResult("display new menu", fullMenu, fullMenu);
+    printBenchResult("display menu after key press", keyPress, fullMenu);
+}
@@ -0,0 +1,82 @@
+#include "../../lib/bench_lib.hpp"
+#include "../../SourceCode/UI/ThemeAtlas.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include <string>
+
+/**
+ * Builds everything of a frame around the field the way ConsoleOutput did before the atlas: one theme call per piece.
+ */
+size_t renderDecorationsWithTheme(ITheme &theme, int lines, int columns, int lives)
+{
+    std::string output = theme.getColourSetupStart() + theme.getWhiteSpace();
+    for(int i = 0; i < lives; i++) output += theme.getHeart();
+    output += theme.getFieldEdgeTopLeftCorner();
+    for(int column = 0; column < columns; column++) output += theme.getFieldEdgeTop();
+    output += theme.getFieldEdgeTopRightCorner();
+    auto leftEdge = theme.getFieldEdgeLeft();
+    auto rightEdge = theme.getFieldEdgeRight();
+    for(int line = 0; line < lines; line++)
+    {
+        output += leftEdge;
+        output += rightEdge;
+    }
+    output += theme.getFieldEdgeBottomLeftCorner();
+    for(int column = 0; column < columns; column++) output += theme.getFieldEdgeBottom();
+    output += theme.getFieldEdgeBottomRightCorner();
+    output += theme.getColourSetupEnd();
+    return output.size();
+}
+
+/**
+ * Builds the same bytes the way ConsoleOutput does now: only views into the compiled atlas.
+ */
+size_t renderDecorationsWithAtlas(ThemeAtlas &atlas, int lines, int columns, int lives)
+{
+    std::string output(atlas.get(ThemeElement::colourSetupStartElement));
+    output += atlas.get(GlyphId::whiteSpaceGlyph);
+    auto heart = atlas.get(ThemeElement::heartElement);
+    for(int i = 0; i < lives; i++) output += heart;
+    output += atlas.get(ThemeElement::fieldEdgeTopLeftCornerElement);
+    auto topEdge = atlas.get(ThemeElement::fieldEdgeTopElement);
+    for(int column = 0; column < columns; column++) output += topEdge;
+    output += atlas.get(ThemeElement::fieldEdgeTopRightCornerElement);
+    auto leftEdge = atlas.get(ThemeElement::fieldEdgeLeftElement);
+    auto rightEdge = atlas.get(ThemeElement::fieldEdgeRightElement);
+    for(int line = 0; line < lines; line++)
+    {
+        output += leftEdge;
+        output += rightEdge;
+    }
+    output += atlas.get(ThemeElement::fieldEdgeBottomLeftCornerElement);
+    auto bottomEdge = atlas.get(ThemeElement::fieldEdgeBottomElement);
+    for(int column = 0; column < columns; column++) output += bottomEdge;
+    output += atlas.get(ThemeElement::fieldEdgeBottomRightCornerElement);
+    output += atlas.get(ThemeElement::colourSetupEndElement);
+    return output.size();
+}
+
+void runThemeAtlasBench()
+{
+    printBenchName("ThemeAtlas Bench (frame decorations of a 512 x 1024 field)");
+    StandardTheme theme;
+    volatile size_t sink = 0;
+    int iterations = 200;
+
+    auto compile = measureNanoseconds(iterations, [&]()
+    {
+        ThemeAtlas atlas(theme);
+        sink = sink + atlas.getSize();
+    });
+    ThemeAtlas atlas(theme);
+    auto withTheme = measureNanoseconds(iterations, [&]()
+    {
+        sink = sink + renderDecorationsWithTheme(theme, 512, 1024, 3);
+    });
+    auto withAtlas = measureNanoseconds(iterations, [&]()
+    {
+        sink = sink + renderDecorationsWithAtlas(atlas, 512, 1024, 3);
+    });
+    printBenchResult("theme calls per piece", withTheme, withTheme);
+    printBenchResult("views into the atlas", withAtlas, withTheme);
+    printBenchResult("compile the atlas once", compile, withTheme);
+}
@@ -1,39 +1,40 @@
 #ifndef GAME_LOGIC_HPP
 #define GAME_LOGIC_HPP
 #include "MenuLogic.hpp"
+#include "GameSimulation.hpp"
+#include "GamePregenerator.hpp"
 #include "../Input/Keylistener.hpp"
 #include "../Input/IInputBufferReader.hpp"
+#include "../Input/RecordingInputBuffer.hpp"
 #include "../GameObjects/SaveState.hpp"
 #include "../GameObjects/Bullet.hpp"
-#include "../Common/Tuple.hpp"
+#include "../Persistence/Autosaver.hpp"
+#include "../Persistence/ReplayRecorder.hpp"
+#include "../Persistence/StateMirror.hpp"
 #include "../Common/IUI.hpp"
 #include "../Common/ITheme.hpp"
-#include "../Common/Utils.hpp"
+#include "../Common/SessionMemoryPool.hpp"
+#include "../Common/ThreadRole.hpp"
 #include "../../lib/concurrency_lib.hpp"
 #include <memory>
 #include <mutex>
+#include <random>
 #include <shared_mutex>
 #include <thread>
 #include <chrono>
 #include <iostream>
 
-enum ScoreType : int
-{
-    centipedeHit,
-    mushroomKill,
-    roundEnd
-};
-
 class GameLogic
 {
     private:
         std::shared_ptr<MenuLogic> menuLogic_ptr;
         std::shared_ptr<IInputBufferReader> inputBuffer_ptr;
+        std::shared_ptr<CentipedeSettings> settings_ptr;
         std::shared_ptr<SaveState> saveState_ptr;
         std::unique_ptr<std::thread> gameClock_thread_ptr;
         std::shared_ptr<IUI> ui_ptr;
         std::shared_ptr<ITheme> theme_ptr;
-        bool hasDiedInRound;
+        std::shared_ptr<PhaseProfiler> profiler_ptr;
 
         // //////////////////////////////////////////////////
         // Additional Methods
@@ -45,40 +46,53 @@ class GameLogic
          */
         void gameLoop()
         {
+            // Objects and frames of the game come from its own pool, it is released when the game and its last objects are gone.
+            SessionMemory sessionMemory;
+            SessionMemoryScope sessionMemoryScope(sessionMemory);
             auto saveState_ptr = this->saveState_ptr;
-            auto inputBuffer_ptr = this->inputBuffer_ptr;
             auto settings_ptr = saveState_ptr->getSettings();
+            GameSimulation simulation(saveState_ptr, this->profiler_ptr);
+            auto recordingInput_ptr = std::make_shared<RecordingInputBuffer>(this->inputBuffer_ptr);
+            auto recorder_ptr = this->startRecording(settings_ptr);
+            auto autosaver_ptr = this->startAutosave(settings_ptr);
+            auto lastAutosave = std::chrono::steady_clock::now();
+            auto lastAutosaveRound = saveState_ptr->getCurrentRound();
+            auto mirror_ptr = this->startStateMirror(settings_ptr);
+
             auto gameClock = startGameClock(settings_ptr->getGameTickLength());
-            // Outer game loop.
-            while(this->alive())
+            while(simulation.alive())
             {
-                // Start a new Round
-                this->startNextRound(saveState_ptr);
+                // Await next game tick.
+                gameClock->await();
 
-                // Play through the round
-                while(this->alive() && this->continueRound(saveState_ptr->getCentipedes()))
+                // Do the calculations.
+                simulation.executeGametick(*recordingInput_ptr);
+                auto input = recordingInput_ptr->takeTickInput(saveState_ptr->getGameTick());
+                if(recorder_ptr != nullptr)
                 {
-                    saveState_ptr->incrementGameTick();
-                    // Await next game tick.
-                    gameClock->await();
-
-                    // Do the calculations.
-                    this->handlePlayerControlledEntities(inputBuffer_ptr, saveState_ptr);
-                    this->handleCentipedes(saveState_ptr);
-                    this->handleGlobalCollisions(saveState_ptr);
+                    recorder_ptr->recordGametick(input, *saveState_ptr);
+                }
 
-                    // Print the current state to the UI.
-                    this->printGame(saveState_ptr, settings_ptr);
+                if(mirror_ptr != nullptr)
+                {
+                    mirror_ptr->update(*saveState_ptr);
+                }
 
-                    // Break the game if necessary.
-                    this->breakGameIfNecessary(inputBuffer_ptr, gameClock);
+                if(autosaver_ptr != nullptr)
+                {
+                    this->autosaveIfDue(autosaver_ptr, settings_ptr, lastAutosave, lastAutosaveRound);
                 }
 
-                if(!this->hasDiedInRound)
+                // Print the current state to the UI.
                 {
-                    this->increaseScore(ScoreType::roundEnd);
+                    ProfiledPhase phase(this->profiler_ptr.get(), GamePhase::renderPhase);
+                    this->printGame(saveState_ptr, settings_ptr);
                 }
-                else
+
+                // Break the game if necessary.
+                this->breakGameIfNecessary(simulation, recorder_ptr, gameClock);
+
+                if(simulation.roundEnded() && saveState_ptr->hasDiedInRound())
                 {
                     // Delay after the starship got hit.
                     auto delayLength = settings_ptr->getLiveLostBreakTime();
@@ -86,6 +100,23 @@ class GameLogic
                 }
             }
 
+            if(recorder_ptr != nullptr)
+            {
+                recorder_ptr->close(*saveState_ptr);
+            }
+
+            if(autosaver_ptr != nullptr)
+            {
+                // A finished game can't be continued.
+                autosaver_ptr->discard();
+            }
+
+            if(mirror_ptr != nullptr)
+            {
+                // Nothing crashed, nothing to investigate.
+                mirror_ptr->discard();
+            }
+
             if(this->saveState_ptr->getLives() <= 0)
             {
                 this->loseGame();
@@ -95,11 +126,78 @@ class GameLogic
         }
 
         /**
-         * Stops the game with the next gametick and returns the current Safe State.
+         * Opens the replay file if recording is enabled, returns nullptr otherwise.
+         * The current state is recorded as first keyframe.
+         */
+        std::shared_ptr<ReplayRecorder> startRecording(std::shared_ptr<CentipedeSettings> settings_ptr)
+        {
+            auto path = settings_ptr->getReplayRecordingPath();
+            if(path.empty())
+            {
+                return nullptr;
+            }
+            auto recorder_ptr = std::make_shared<ReplayRecorder>(path, settings_ptr, settings_ptr->getReplayKeyframeInterval());
+            recorder_ptr->recordKeyframe(*(this->saveState_ptr));
+            return recorder_ptr;
+        }
+
+        /**
+         * Starts the background autosave if enabled, returns nullptr otherwise.
+         */
+        std::shared_ptr<Autosaver> startAutosave(std::shared_ptr<CentipedeSettings> settings_ptr)
+        {
+            auto path = settings_ptr->getAutosavePath();
+            if(path.empty())
+            {
+                return nullptr;
+            }
+            return std::make_shared<Autosaver>(path, settings_ptr);
+        }
+
+        /**
+         * Creates the state mirror if enabled, returns nullptr otherwise.
+         * The current state is mirrored right away, a crash in the first gametick still leaves the state it started from.
          */
-        void breakGameIfNecessary(std::shared_ptr<IInputBufferReader> inputBuffer_ptr, std::shared_ptr<Signal> gameClock)
+        std::unique_ptr<StateMirror> startStateMirror(std::shared_ptr<CentipedeSettings> settings_ptr)
         {
-            if(!inputBuffer_ptr->getAndResetBreakoutMenu())
+            auto path = settings_ptr->getStateMirrorPath();
+            if(path.empty())
+            {
+                return nullptr;
+            }
+            auto mirror_ptr = std::make_unique<StateMirror>(path, settings_ptr);
+            mirror_ptr->update(*(this->saveState_ptr));
+            return mirror_ptr;
+        }
+
+        /**
+         * Hands a snapshot of the game to the autosave, if a new round has started or the interval has passed.
+         * The game thread only pays for the copy, writing happens in the background.
+         */
+        void autosaveIfDue(std::shared_ptr<Autosaver> autosaver_ptr,
+                           std::shared_ptr<CentipedeSettings> settings_ptr,
+                           std::chrono::steady_clock::time_point &lastAutosave,
+                           int &lastAutosaveRound)
+        {
+            auto now = std::chrono::steady_clock::now();
+            auto interval = settings_ptr->getAutosaveIntervalSeconds();
+            auto intervalPassed = interval > 0 && now - lastAutosave >= std::chrono::seconds(interval);
+            auto roundStarted = settings_ptr->getAutosaveEveryRound() && this->saveState_ptr->getCurrentRound() != lastAutosaveRound;
+            if(!intervalPassed && !roundStarted)
+            {
+                return;
+            }
+            autosaver_ptr->save(this->saveState_ptr->clone());
+            lastAutosave = now;
+            lastAutosaveRound = this->saveState_ptr->getCurrentRound();
+        }
+
+        /**
+         * Opens the breakout menu if it was requested and ends the game, if the player chooses so.
+         */
+        void breakGameIfNecessary(GameSimulation &simulation, std::shared_ptr<ReplayRecorder> recorder_ptr, std::shared_ptr<Signal> gameClock)
+        {
+            if(!this->inputBuffer_ptr->getAndResetBreakoutMenu())
             {
                 return;
             }
@@ -115,10 +213,11 @@ class GameLogic
             }
 
             // Game was ended -> Kill player to show result screen
-            while(this->alive())
+            if(recorder_ptr != nullptr)
             {
-                this->loseLive();
+                recorder_ptr->recordQuit(simulation.getSaveState()->getGameTick());
             }
+            simulation.quit();
         }
 
         /**
@@ -141,6 +240,8 @@ class GameLogic
          */
         void executeGameClock(int gameTickLength, std::shared_ptr<Signal> gameClock)
         {
+            // Ticks arrive late, if this thread gets preempted -> optionally pinned and scheduled with priority.
+            this->settings_ptr->getThreadPlacement(ThreadRole::clockThread).applyToCurrentThread();
             while(this->alive())
             {
                 std::this_thread::sleep_for(std::chrono::milliseconds(gameTickLength));
@@ -179,377 +280,6 @@ class GameLogic
             this->ui_ptr->displayImage(*saveState_ptr, *settings_ptr, *(this->theme_ptr));
         }
 
-        /**
-         * Determines wheather a path with the given slowdown should be executed within the current gametick.
-         */
-        bool executePathForGametick(int gameTick, int moduloSlowdown)
-        {
-            return gameTick % moduloSlowdown == 0;
-        }
-
-        // //////////////////////////////////////////////////
-        // High Level Logic Methods
-        // //////////////////////////////////////////////////
-
-        /**
-         * Handles all starship and bullet actions.
-         * This is path 1, executed after a constant gametick delay.
-         */
-        void handlePlayerControlledEntities(std::shared_ptr<IInputBufferReader> inputBuffer_ptr, std::shared_ptr<SaveState> saveState_ptr)
-        {
-            auto settings_ptr = saveState_ptr->getSettings();
-            auto starshipModuloGametickSlowdown = settings_ptr->getStarshipModuloGametickSlowdown();
-            auto currentGameTick = saveState_ptr->getGameTick();
-            if(!executePathForGametick(currentGameTick, starshipModuloGametickSlowdown)){
-                // Player controlled entities won't move this gametick-> skip path.
-                return;
-            }
-
-            auto starship_ptr = saveState_ptr->getStarship();
-            auto bullets_ptr = saveState_ptr->getBullets();
-            auto mushroomMap_ptr = saveState_ptr->getMushroomMap();
-            spawnBulletIfNecessary(inputBuffer_ptr, starship_ptr, bullets_ptr);
-            moveBullets(bullets_ptr);
-            collideBulletsMushrooms(bullets_ptr, mushroomMap_ptr);
-            moveStarshipIfNecessary(inputBuffer_ptr, starship_ptr, mushroomMap_ptr);
-        }
-        
-        /**
-         * Handles centipede movement.
-         * This is path 2, executed after a varying gametick delay.
-         */
-        void handleCentipedes(std::shared_ptr<SaveState> saveState_ptr)
-        {
-            auto currentGameTick = saveState_ptr->getGameTick();
-            auto currentCentipedeModuloGametickSlowdown = saveState_ptr->getCurrentCentipedeModuloGametickSlowdown();
-            if(!executePathForGametick(currentGameTick, currentCentipedeModuloGametickSlowdown)){
-                // Centiepedes won't move this gametick-> skip path.
-                return;
-            }
-
-            auto centipedes_ptr = saveState_ptr->getCentipedes();
-            auto mushroomMap_ptr = saveState_ptr->getMushroomMap();
-            auto settings_ptr = saveState_ptr->getSettings();
-            moveCentipedes(centipedes_ptr, mushroomMap_ptr, settings_ptr);
-        }
-
-        /**
-         * Handles collisions with objects of both pathes at once: bullet-centipede and player-centipede.
-         */
-        void handleGlobalCollisions(std::shared_ptr<SaveState> saveState_ptr)
-        {
-            auto settings_ptr = saveState_ptr->getSettings();
-            auto currentCentipedeModuloGametickSlowdown = saveState_ptr->getCurrentCentipedeModuloGametickSlowdown();
-            auto starshipModuloGametickSlowdown = saveState_ptr->getSettings()->getStarshipModuloGametickSlowdown();
-            auto currentGameTick = saveState_ptr->getGameTick();
-
-            // Collision can only be skipped, if neither path was executed.
-            if(!executePathForGametick(currentGameTick, starshipModuloGametickSlowdown)
-               && !executePathForGametick(currentGameTick,currentCentipedeModuloGametickSlowdown)){
-                return;
-            }
-
-            auto centipedes_ptr = saveState_ptr->getCentipedes();
-            auto bullets_ptr = saveState_ptr->getBullets();
-            auto mushroomMap_ptr = saveState_ptr->getMushroomMap();
-            auto starship_ptr = saveState_ptr->getStarship();
-            
-            this->collideBulletsCentipedes(centipedes_ptr, bullets_ptr, mushroomMap_ptr);
-            this->collidePlayerCentipedes(centipedes_ptr, starship_ptr);
-        }
-
-        /**
-         * Determines wheather the round continues or a new has to be started.
-         */
-        bool continueRound(std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr)
-        {
-            // A round continues, while there are still centipedes left.
-            return centipedes_ptr->size() > 0;
-        }
-
-        /**
-         * Adjusts centipede-lenght and speed and spawns a new centipede to start the next round.
-         */
-        void startNextRound(std::shared_ptr<SaveState> saveState_ptr)
-        {
-            saveState_ptr->incrementCurrentRound();
-            
-            auto currentRound = saveState_ptr->getCurrentRound();
-            auto settings_ptr = saveState_ptr->getSettings();
-
-            // Calculate and set new slowdown.
-            auto currentSlowdown = this->calculateCentipedeSlowdown(settings_ptr, currentRound);
-            saveState_ptr->setCurrentCentipedeModuloGametickSlowdown(currentSlowdown);
-
-            // Calculate Size.
-            auto currentSize = this->calculateCentipedeSize(settings_ptr, currentRound);
-
-            // Evaluate initial position and movement
-            auto movingDirection = this->getRandomCentipedeMovingDirection();
-            auto line = settings_ptr->getCentipedeSpawnLine();
-            auto column = settings_ptr->getCentipedeSpawnColumn();
-
-            CentipedeHead newCentipede(line, column, movingDirection, settings_ptr, currentSize);
-            saveState_ptr->getCentipedes()->push_back(newCentipede);
-        }
-
-        int calculateCentipedeSlowdown(std::shared_ptr<CentipedeSettings> settings_ptr, int currentRound)
-        {
-            auto initialSlowdown = settings_ptr->getInitialCentipedeModuloGametickSlowdown();
-            auto numberOfSpeedups = currentRound / settings_ptr->getCentipedeSpeedIncrementRoundModuloSlowdown();
-            auto currentSlowdown = initialSlowdown - (numberOfSpeedups * settings_ptr->getCentipedeSpeedIncrementAmount());
-            return currentSlowdown;
-        }
-
-        int calculateCentipedeSize(std::shared_ptr<CentipedeSettings> settings_ptr, int currentRound)
-        {
-            auto initialSize = settings_ptr->getInitialCentipedeSize();
-            auto numberOfSizeIncrements = currentRound / settings_ptr->getCentipedeSizeIncrementRoundModuloSlowdown();
-            auto currentSize = initialSize + (numberOfSizeIncrements * settings_ptr->getCentipedeSizeIncrementAmount());
-            return currentSize;
-        }
-
-        CentipedeMovingDirection getRandomCentipedeMovingDirection()
-        {
-            auto goLeft = rollRandomWithChance(1,2);
-            if(goLeft) 
-            {
-                return CentipedeMovingDirection::cLeft;
-            }
-            // go right.
-            return CentipedeMovingDirection::cRight;
-        }
-
-        // //////////////////////////////////////////////////
-        // Low Level Logic Methods
-        // //////////////////////////////////////////////////
-
-        /**
-         * Increases the score according to the type this is called for.
-         */
-        void increaseScore(ScoreType type)
-        {
-            auto saveState_ptr = this->saveState_ptr;
-            auto settings_ptr = saveState_ptr->getSettings();
-            switch(type)
-            {
-                case centipedeHit:
-                {
-                    saveState_ptr->addToScore(settings_ptr->getPointsForCentipedeHit());
-                    break;
-                }
-                case mushroomKill:
-                {
-                    saveState_ptr->addToScore(settings_ptr->getPointsForMushroomKill());
-                    break;
-                }
-                case roundEnd:
-                {
-                    saveState_ptr->addToScore(settings_ptr->getPointsForRoundEnd());
-                    break;
-                }
-            }
-        }
-
-        /**
-         * Spawns a bullet if required button was pressed.
-         */
-        void spawnBulletIfNecessary(std::shared_ptr<IInputBufferReader> inputBuffer_ptr, 
-                                    std::shared_ptr<Starship> starship_ptr, 
-                                    std::shared_ptr<std::vector<Bullet>> bullets_ptr)
-        {
-            auto shot = inputBuffer_ptr->getAndResetShot();
-            if(shot)
-            {
-                auto newBullet_ptr = starship_ptr->shoot();
-                bullets_ptr->push_back(*newBullet_ptr);
-            }
-        }
-
-        /**
-         * Moves all bullets one line up.
-         */
-        void moveBullets(std::shared_ptr<std::vector<Bullet>> bullets_ptr)
-        {
-            auto bullet_ptr = bullets_ptr->begin();
-            while(bullet_ptr != bullets_ptr->end())
-            {
-                auto hasMoved = bullet_ptr->move();
-                if(!hasMoved)
-                {
-                    // Bullet has reached top.
-                    bullet_ptr = bullets_ptr->erase(bullet_ptr);
-                    continue;
-                }
-                bullet_ptr++;
-            }
-        }
-
-        /**
-         * Takes Care of Collisions between bullets and mushrooms.
-         */
-        void collideBulletsMushrooms(std::shared_ptr<std::vector<Bullet>> bullets_ptr,
-                                     std::shared_ptr<MushroomMap> mushroomMap_ptr)
-        {
-            // no simple for loop because vector may be edited while looping through.
-            auto bullet_ptr = bullets_ptr->begin();
-            while(bullet_ptr != bullets_ptr->end())
-            {
-                if(mushroomMap_ptr->collide(*bullet_ptr))
-                {
-                    // Check if Mushroom was killed
-                    if(mushroomMap_ptr->getMushroom(bullet_ptr->getPosition().getLine(), bullet_ptr->getPosition().getColumn()) == 0)
-                    {
-                        this->increaseScore(ScoreType::mushroomKill);
-                    }
-                    // Collision bullet & mushroom -> remove bullet.
-                    bullet_ptr = bullets_ptr->erase(bullet_ptr);
-                    // no increment here, since bullet_ptr already points to the following element.
-                    continue;
-                }
-                // No collision, bullet remains in list.
-                // check next bullet.
-                bullet_ptr++;
-            }
-        }
-
-        /**
-         * Moves the starship if any direction was set by button press.
-         */
-        void moveStarshipIfNecessary(std::shared_ptr<IInputBufferReader> inputBuffer_ptr,
-                                     std::shared_ptr<Starship> starship_ptr,
-                                     std::shared_ptr<MushroomMap> mushroomMap_ptr)
-        {
-            auto direction = inputBuffer_ptr->getAndResetDirection();
-            if(direction == Direction::none)
-            {
-                // no direction was picked.
-                return;
-            }
-
-            // valid direction was picked.
-            starship_ptr->move(direction, *mushroomMap_ptr);
-        }
-
-        // //////////////////////////////////////////////////
-
-        /**
-         * Moves all centipedes if possible.
-         */
-        void moveCentipedes(std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr,
-                            std::shared_ptr<MushroomMap> mushroomMap_ptr,
-                            std::shared_ptr<CentipedeSettings> settings_ptr)
-        {
-            auto centipede_ptr = centipedes_ptr->begin();
-            while(centipede_ptr != centipedes_ptr->end())
-            {
-                centipede_ptr->move(*mushroomMap_ptr, *centipedes_ptr, settings_ptr);
-                centipede_ptr++;
-            }
-        }
-
-        // //////////////////////////////////////////////////
-
-        /**
-         * Handles collisions between bullets and centipedes.
-         */
-        void collideBulletsCentipedes(std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr,
-                                      std::shared_ptr<std::vector<Bullet>> bullets_ptr,
-                                      std::shared_ptr<MushroomMap> mushroomMap_ptr)
-        {
-            auto centipede_ptr = centipedes_ptr->begin();
-            while(centipede_ptr < centipedes_ptr->end())
-            {
-                // Indicator wheather the head was hit.
-                bool headHit = false;
-                // Check bullets.
-                // No simple "for" loop because vector may be edited while looping through.
-                auto bullet_ptr = bullets_ptr->begin();
-                while(bullet_ptr != bullets_ptr->end())
-                {
-                    auto collisionResult = centipede_ptr->collide(*bullet_ptr, mushroomMap_ptr);
-                    auto hitIndicator = collisionResult.getItem1();
-                    auto splitOfTail_ptr = collisionResult.getItem2();
-                    if(hitIndicator == CentipedeHit::noHit)
-                    {
-                        // Nothing left to do, just continue checking the others.
-                        ++bullet_ptr;
-                        continue;
-                    }
-
-                    // Bullet has hit -> remove from list.
-                    bullet_ptr = bullets_ptr->erase(bullet_ptr);
-                    // Update score
-                    this->increaseScore(ScoreType::centipedeHit);
-
-                    // Create new centipede from split of tail if necessary.
-                    if(splitOfTail_ptr != nullptr)
-                    {
-                        auto splitOfBody_ptr = std::reinterpret_pointer_cast<CentipedeBody>(splitOfTail_ptr);
-                        CentipedeHead newCentipedeFromSplitOfTail(splitOfBody_ptr);
-                        // Need to recreate the iterator after adding a new centipede.
-                        auto diff = centipede_ptr - centipedes_ptr->begin();
-                        centipedes_ptr->push_back(newCentipedeFromSplitOfTail);
-                        centipede_ptr = centipedes_ptr->begin() + diff;
-                    }
-
-                    if(hitIndicator == CentipedeHit::tailHit)
-                    {
-                        // Nothing left to do, just continue checking the others.
-                        // bullet_ptr already points to next item.
-                        continue;
-                    }
-
-                    // The head of the Centipede was hit -> return true and do NOT continue checking more bullets.
-                    headHit = true;
-                    break;
-                }
-
-                if(headHit)
-                {
-                    // Head needs to be removed.
-                    centipede_ptr = centipedes_ptr->erase(centipede_ptr);
-                    continue;
-                }
-
-                // No hit or only tail hit -> continue regulary.
-                ++centipede_ptr;
-            }
-        }
-
-        /**
-         * Handles collisions between centipedes and the starship.
-         */
-        void collidePlayerCentipedes(std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr,
-                                     std::shared_ptr<Starship> starship_ptr)
-        {
-            auto starshipPosition = starship_ptr->getPosition();
-            for(auto centipede : *centipedes_ptr)
-            {
-                if(!centipede.isAtPosition(starshipPosition))
-                {
-                    // No collision, game continues running.
-                    continue;
-                }
-
-                // Collision player & centipede -> lose game.
-                this->loseLive();
-            }
-        }
-
-        /**
-         * Decreases player health by 1, kills all centipedes and lets the round end without getting points.
-         */
-        void loseLive()
-        {
-            // Decrease health.
-            this->saveState_ptr->loseLive();
-            // This makes shure that no points for the round end are gained.
-            this->hasDiedInRound = true;
-            // Remove all enemies.
-            this->saveState_ptr->getCentipedes()->clear();
-        }
-
         /**
          * Displays the Game Over screen.
          */
@@ -566,15 +296,30 @@ class GameLogic
         GameLogic(std::shared_ptr<IInputBufferReader> inputBuffer_ptr,
                   std::shared_ptr<IUI> ui_ptr,
                   std::shared_ptr<ITheme> theme_ptr,
-                  std::shared_ptr<MenuLogic> menuLogic_ptr)
+                  std::shared_ptr<MenuLogic> menuLogic_ptr,
+                  std::shared_ptr<CentipedeSettings> settings_ptr)
         {
             this->menuLogic_ptr = menuLogic_ptr;
             this->inputBuffer_ptr = inputBuffer_ptr;
+            this->settings_ptr = settings_ptr;
 
             this->ui_ptr = ui_ptr;
             this->theme_ptr = theme_ptr;
 
             this->gameClock_thread_ptr = nullptr;
+            this->profiler_ptr = nullptr;
+            if(settings_ptr->getPerformanceCounters())
+            {
+                this->profiler_ptr = std::make_shared<PhaseProfiler>(getGamePhaseNames());
+            }
+        }
+
+        /**
+         * Returns the measurements of all games played so far, nullptr if performance counters are disabled.
+         */
+        std::shared_ptr<PhaseProfiler> getProfiler()
+        {
+            return this->profiler_ptr;
         }
 
         // //////////////////////////////////////////////////
@@ -582,30 +327,11 @@ class GameLogic
         // //////////////////////////////////////////////////
 
         /**
-         * Starts a new Game.
+         * Starts a new Game with the next field of the pregenerator, the host starts it as early as possible.
          */
-        void startNew()
+        void startNew(GamePregenerator &pregenerator)
         {
-            auto settings_ptr = std::make_shared<CentipedeSettings>();
-			auto bullets_ptr = std::make_shared<std::vector<Bullet>>();
-			auto starship_ptr = std::make_shared<Starship>(settings_ptr->getInitialStarshipLine(),
-                                                           settings_ptr->getInitialStarshipColumn(),
-                                                           settings_ptr);
-			auto mushroomMap_ptr = std::make_shared<MushroomMap>(settings_ptr);
-			auto centipedes_ptr = std::make_shared<std::vector<CentipedeHead>>();
-			int currentCentipedeModuloGametickSlowdown = settings_ptr->getInitialCentipedeModuloGametickSlowdown();
-            int currentRound = 0;
-            int score = 0;
-            int lives = settings_ptr->getInitialPlayerHealth();
-            auto newState = std::make_shared<SaveState>(settings_ptr, 
-                                                        bullets_ptr,
-                                                        starship_ptr,
-                                                        mushroomMap_ptr,
-                                                        centipedes_ptr,
-                                                        currentCentipedeModuloGametickSlowdown,
-                                                        currentRound,
-                                                        score,
-                                                        lives);
+            auto newState = pregenerator.take();
             this->continueGame(newState);
         }
 
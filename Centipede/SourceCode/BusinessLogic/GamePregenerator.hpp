@@ -0,0 +1,112 @@
+#ifndef GAME_PREGENERATOR_HPP
+#define GAME_PREGENERATOR_HPP
+#include "GameSimulation.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../Common/ThreadRole.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../../lib/thread_lib.hpp"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * Prepares the state of the next new game on a background thread, e.g. while the host sets up the console or a game is played.
+ * Starting a game only takes the prepared state, if the field took longer to generate, it waits for the rest.
+ * The games get the seeds first seed, first seed + 1 and so on, the sequence of fields is reproducible.
+ * A host, that plays a known number of games, limits the pregenerator to them, so that no field is generated for nothing.
+ */
+class GamePregenerator
+{
+    private:
+        std::shared_ptr<CentipedeSettings> settings_ptr;
+        ThreadPlacement placement;
+        std::mutex mutex;
+        std::condition_variable stateChanged;
+        // Prepared state, that is not yet taken.
+        std::shared_ptr<SaveState> ready_ptr;
+        unsigned int nextSeed;
+        // Games, that are still to be stored as prepared, negative for no limit.
+        int remainingGames;
+        bool stopped;
+        std::thread generator_thread;
+
+        void runGenerator()
+        {
+            this->placement.applyToCurrentThread();
+            std::unique_lock<std::mutex> lock(this->mutex);
+            while(true)
+            {
+                this->stateChanged.wait(lock, [this]() { return this->ready_ptr == nullptr || this->stopped; });
+                if(this->stopped || this->remainingGames == 0)
+                {
+                    return;
+                }
+                auto seed = this->nextSeed++;
+                lock.unlock();
+                auto state_ptr = GameSimulation::createNewGame(this->settings_ptr, seed);
+                lock.lock();
+                this->ready_ptr = state_ptr;
+                if(this->remainingGames > 0)
+                {
+                    this->remainingGames--;
+                }
+                this->stateChanged.notify_all();
+            }
+        }
+
+    public:
+        /**
+         * Starts preparing the first game right away, games limits how many are generated at all, negative for no limit.
+         */
+        GamePregenerator(std::shared_ptr<CentipedeSettings> settings_ptr, unsigned int firstSeed, int games = -1)
+            : settings_ptr(settings_ptr), placement(settings_ptr->getThreadPlacement(ThreadRole::pregenerationThread))
+        {
+            this->ready_ptr = nullptr;
+            this->nextSeed = firstSeed;
+            this->remainingGames = games;
+            this->stopped = false;
+            this->generator_thread = std::thread(&GamePregenerator::runGenerator, this);
+        }
+
+        ~GamePregenerator()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->stopped = true;
+            }
+            this->stateChanged.notify_all();
+            this->generator_thread.join();
+        }
+
+        /**
+         * Returns the state of the next new game and starts preparing the one after it.
+         * Waits only if the previous game was taken a moment ago and this one isn't ready yet.
+         * Throws a logic_error, if all games of a limited pregenerator are taken.
+         */
+        std::shared_ptr<SaveState> take()
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            if(this->ready_ptr == nullptr && this->remainingGames == 0)
+            {
+                throw std::logic_error("The pregenerator has no games left.");
+            }
+            this->stateChanged.wait(lock, [this]() { return this->ready_ptr != nullptr; });
+            auto state_ptr = this->ready_ptr;
+            this->ready_ptr = nullptr;
+            this->stateChanged.notify_all();
+            return state_ptr;
+        }
+
+        /**
+         * Returns true if the next game is prepared, so that take() doesn't wait.
+         */
+        bool isReady()
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->ready_ptr != nullptr;
+        }
+};
+
+#endif
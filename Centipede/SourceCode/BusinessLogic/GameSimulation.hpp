@@ -0,0 +1,655 @@
+#ifndef GAME_SIMULATION_HPP
+#define GAME_SIMULATION_HPP
+#include "Heatmap.hpp"
+#include "../Input/IInputBufferReader.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../GameObjects/Bullet.hpp"
+#include "../Common/CentipedeSpeed.hpp"
+#include "../Common/Tuple.hpp"
+#include "../Common/GamePhase.hpp"
+#include "../Common/Utils.hpp"
+#include "../../lib/perf_lib.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+enum ScoreType : int
+{
+    centipedeHit,
+    mushroomKill,
+    roundEnd
+};
+
+/**
+ * The rules of the game, applied gametick by gametick on a SaveState.
+ * Knows nothing about clocks, output or menus, so the same game can run live, headless or from a replay.
+ * Given the same SaveState and the same inputs, it always produces the same game.
+ */
+class GameSimulation
+{
+    private:
+        std::shared_ptr<SaveState> saveState_ptr;
+        // Measures the phases of every gametick if set.
+        std::shared_ptr<PhaseProfiler> profiler_ptr;
+        // Counts deaths, hits and mushrooms per cell if set.
+        std::shared_ptr<Heatmap> heatmap_ptr;
+        // The starship moved outside of path 1 within the current gametick.
+        bool starshipMovedInGametick;
+        // Cells the centipedes moved within the current gametick.
+        int centipedeStepsInGametick;
+
+        /**
+         * Determines wheather a path with the given slowdown should be executed within the current gametick.
+         */
+        bool executePathForGametick(int gameTick, int moduloSlowdown)
+        {
+            return gameTick % moduloSlowdown == 0;
+        }
+
+        // //////////////////////////////////////////////////
+        // High Level Logic Methods
+        // //////////////////////////////////////////////////
+
+        /**
+         * Handles all starship and bullet actions.
+         * This is path 1, executed after a constant gametick delay.
+         * With immediate starship input the starship leaves this path and may move in any gametick instead.
+         * The second starship, if any, is steered by the second input. The bullets of both are moved together.
+         */
+        void handlePlayerControlledEntities(IInputBufferReader &input, IInputBufferReader *secondInput, std::shared_ptr<SaveState> saveState_ptr)
+        {
+            auto settings_ptr = saveState_ptr->getSettings();
+            auto starshipModuloGametickSlowdown = settings_ptr->getStarshipModuloGametickSlowdown();
+            auto currentGameTick = saveState_ptr->getGameTick();
+            auto starship_ptr = saveState_ptr->getStarship();
+            auto secondStarship_ptr = saveState_ptr->getSecondStarship();
+            auto mushroomMap_ptr = saveState_ptr->getMushroomMap();
+            auto immediateStarshipInput = settings_ptr->getImmediateStarshipInput();
+            if(immediateStarshipInput)
+            {
+                auto cooldown = settings_ptr->getStarshipMoveCooldown();
+                this->moveStarshipIfReady(input, starship_ptr, mushroomMap_ptr, currentGameTick, cooldown);
+                if(secondStarship_ptr != nullptr)
+                {
+                    this->moveStarshipIfReady(*secondInput, secondStarship_ptr, mushroomMap_ptr, currentGameTick, cooldown);
+                }
+            }
+            if(!executePathForGametick(currentGameTick, starshipModuloGametickSlowdown)){
+                // Player controlled entities won't move this gametick-> skip path.
+                return;
+            }
+
+            auto bullets_ptr = saveState_ptr->getBullets();
+            spawnBulletIfNecessary(input, starship_ptr, bullets_ptr);
+            if(secondStarship_ptr != nullptr)
+            {
+                spawnBulletIfNecessary(*secondInput, secondStarship_ptr, bullets_ptr);
+            }
+            moveBullets(bullets_ptr);
+            collideBulletsMushrooms(bullets_ptr, mushroomMap_ptr);
+            if(!immediateStarshipInput)
+            {
+                moveStarshipIfNecessary(input, starship_ptr, mushroomMap_ptr);
+                if(secondStarship_ptr != nullptr)
+                {
+                    moveStarshipIfNecessary(*secondInput, secondStarship_ptr, mushroomMap_ptr);
+                }
+            }
+        }
+        
+        /**
+         * Handles centipede movement.
+         * This is path 2, executed as often as the current centipede speed demands:
+         * slow centipedes skip gameticks, fast ones move several cells within one.
+         */
+        void handleCentipedes(std::shared_ptr<SaveState> saveState_ptr)
+        {
+            auto currentGameTick = saveState_ptr->getGameTick();
+            this->centipedeStepsInGametick = getCentipedeStepsInGametick(currentGameTick, saveState_ptr->getCurrentCentipedeSpeed());
+            if(this->centipedeStepsInGametick == 0){
+                // Centiepedes won't move this gametick-> skip path.
+                return;
+            }
+
+            auto centipedes_ptr = saveState_ptr->getCentipedes();
+            auto bullets_ptr = saveState_ptr->getBullets();
+            auto mushroomMap_ptr = saveState_ptr->getMushroomMap();
+            auto settings_ptr = saveState_ptr->getSettings();
+            for(int step = 0; step < this->centipedeStepsInGametick; step++)
+            {
+                if(step > 0)
+                {
+                    // Collisions of the cell before, so that fast centipedes can't jump over bullets or the starship.
+                    // The last cell is checked with the global collisions.
+                    this->collideBulletsCentipedes(centipedes_ptr, bullets_ptr, mushroomMap_ptr);
+                    this->collidePlayersCentipedes(centipedes_ptr, saveState_ptr);
+                }
+                moveCentipedes(centipedes_ptr, mushroomMap_ptr, settings_ptr);
+            }
+        }
+
+        /**
+         * Handles collisions with objects of both pathes at once: bullet-centipede and player-centipede.
+         */
+        void handleGlobalCollisions(std::shared_ptr<SaveState> saveState_ptr)
+        {
+            auto settings_ptr = saveState_ptr->getSettings();
+            auto starshipModuloGametickSlowdown = saveState_ptr->getSettings()->getStarshipModuloGametickSlowdown();
+            auto currentGameTick = saveState_ptr->getGameTick();
+
+            // Collision can only be skipped, if neither path was executed and the starship didn't move on its own.
+            if(!executePathForGametick(currentGameTick, starshipModuloGametickSlowdown)
+               && this->centipedeStepsInGametick == 0
+               && !this->starshipMovedInGametick){
+                return;
+            }
+
+            auto centipedes_ptr = saveState_ptr->getCentipedes();
+            auto bullets_ptr = saveState_ptr->getBullets();
+            auto mushroomMap_ptr = saveState_ptr->getMushroomMap();
+            
+            this->collideBulletsCentipedes(centipedes_ptr, bullets_ptr, mushroomMap_ptr);
+            this->collidePlayersCentipedes(centipedes_ptr, saveState_ptr);
+        }
+
+        /**
+         * Determines wheather the round continues or a new has to be started.
+         */
+        bool continueRound(std::shared_ptr<CentipedeList> centipedes_ptr)
+        {
+            // A round continues, while there are still centipedes left.
+            return centipedes_ptr->size() > 0;
+        }
+
+        /**
+         * Gives the points for the round end, unless the starship got hit within the round.
+         */
+        void finishRound(std::shared_ptr<SaveState> saveState_ptr)
+        {
+            if(saveState_ptr->getCurrentRound() > 0 && !saveState_ptr->hasDiedInRound())
+            {
+                this->increaseScore(ScoreType::roundEnd);
+            }
+            if(this->heatmap_ptr != nullptr && saveState_ptr->getCurrentRound() > 0)
+            {
+                this->heatmap_ptr->recordMushrooms(*(saveState_ptr->getMushroomMap()));
+            }
+        }
+
+        /**
+         * Adjusts centipede-lenght and speed and spawns a new centipede to start the next round.
+         */
+        void startNextRound(std::shared_ptr<SaveState> saveState_ptr)
+        {
+            saveState_ptr->incrementCurrentRound();
+            saveState_ptr->setDiedInRound(false);
+            
+            auto currentRound = saveState_ptr->getCurrentRound();
+            auto settings_ptr = saveState_ptr->getSettings();
+
+            // Calculate and set new speed.
+            saveState_ptr->setCurrentCentipedeSpeed(calculateCentipedeSpeed(settings_ptr, currentRound));
+
+            // Calculate Size.
+            auto currentSize = this->calculateCentipedeSize(settings_ptr, currentRound);
+
+            // Evaluate initial position and movement
+            auto movingDirection = this->getRandomCentipedeMovingDirection();
+            auto line = settings_ptr->getCentipedeSpawnLine();
+            auto column = settings_ptr->getCentipedeSpawnColumn();
+
+            CentipedeHead newCentipede(line, column, movingDirection, settings_ptr, currentSize);
+            saveState_ptr->getCentipedes()->push_back(newCentipede);
+        }
+
+        /**
+         * Speed of the centipedes in the round, in 1/centipedeSpeedScale cells per gametick.
+         * Every speedup takes one gametick off the slowdown, until they move every gametick.
+         * Beyond that every speedup adds the initial speed, up to the maximum cells per gametick.
+         */
+        static int calculateCentipedeSpeed(std::shared_ptr<CentipedeSettings> settings_ptr, int currentRound)
+        {
+            auto initialSlowdown = std::max(settings_ptr->getInitialCentipedeModuloGametickSlowdown(), 1);
+            auto numberOfSpeedups = currentRound / settings_ptr->getCentipedeSpeedIncrementRoundModuloSlowdown();
+            auto currentSlowdown = initialSlowdown - (numberOfSpeedups * settings_ptr->getCentipedeSpeedIncrementAmount());
+            if(currentSlowdown >= 1)
+            {
+                return getCentipedeSpeedForSlowdown(currentSlowdown);
+            }
+            auto speedupsBeyondEveryGametick = (int64_t) 1 - currentSlowdown;
+            auto speed = centipedeSpeedScale + speedupsBeyondEveryGametick * getCentipedeSpeedForSlowdown(initialSlowdown);
+            return (int) std::min<int64_t>(speed, (int64_t) settings_ptr->getMaxCentipedeCellsPerGametick() * centipedeSpeedScale);
+        }
+
+        int calculateCentipedeSize(std::shared_ptr<CentipedeSettings> settings_ptr, int currentRound)
+        {
+            auto initialSize = settings_ptr->getInitialCentipedeSize();
+            auto numberOfSizeIncrements = currentRound / settings_ptr->getCentipedeSizeIncrementRoundModuloSlowdown();
+            auto currentSize = initialSize + (numberOfSizeIncrements * settings_ptr->getCentipedeSizeIncrementAmount());
+            return currentSize;
+        }
+
+        CentipedeMovingDirection getRandomCentipedeMovingDirection()
+        {
+            auto goLeft = rollRandomWithChance(1, 2, this->saveState_ptr->getRandom());
+            if(goLeft) 
+            {
+                return CentipedeMovingDirection::cLeft;
+            }
+            // go right.
+            return CentipedeMovingDirection::cRight;
+        }
+
+        // //////////////////////////////////////////////////
+        // Low Level Logic Methods
+        // //////////////////////////////////////////////////
+
+        /**
+         * Increases the score according to the type this is called for.
+         */
+        void increaseScore(ScoreType type)
+        {
+            auto saveState_ptr = this->saveState_ptr;
+            auto settings_ptr = saveState_ptr->getSettings();
+            switch(type)
+            {
+                case centipedeHit:
+                {
+                    saveState_ptr->addToScore(settings_ptr->getPointsForCentipedeHit());
+                    break;
+                }
+                case mushroomKill:
+                {
+                    saveState_ptr->addToScore(settings_ptr->getPointsForMushroomKill());
+                    break;
+                }
+                case roundEnd:
+                {
+                    saveState_ptr->addToScore(settings_ptr->getPointsForRoundEnd());
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Spawns a bullet if required button was pressed.
+         */
+        void spawnBulletIfNecessary(IInputBufferReader &input, 
+                                    std::shared_ptr<Starship> starship_ptr, 
+                                    std::shared_ptr<BulletVector> bullets_ptr)
+        {
+            auto shot = input.getAndResetShot();
+            if(shot)
+            {
+                bullets_ptr->push_back(starship_ptr->shoot());
+            }
+        }
+
+        /**
+         * Moves all bullets one line up.
+         */
+        void moveBullets(std::shared_ptr<BulletVector> bullets_ptr)
+        {
+            auto bullet_ptr = bullets_ptr->begin();
+            while(bullet_ptr != bullets_ptr->end())
+            {
+                auto hasMoved = bullet_ptr->move();
+                if(!hasMoved)
+                {
+                    // Bullet has reached top.
+                    bullet_ptr = bullets_ptr->erase(bullet_ptr);
+                    continue;
+                }
+                bullet_ptr++;
+            }
+        }
+
+        /**
+         * Takes Care of Collisions between bullets and mushrooms.
+         */
+        void collideBulletsMushrooms(std::shared_ptr<BulletVector> bullets_ptr,
+                                     std::shared_ptr<MushroomMap> mushroomMap_ptr)
+        {
+            // no simple for loop because vector may be edited while looping through.
+            auto bullet_ptr = bullets_ptr->begin();
+            while(bullet_ptr != bullets_ptr->end())
+            {
+                if(mushroomMap_ptr->collide(*bullet_ptr))
+                {
+                    // Check if Mushroom was killed
+                    if(mushroomMap_ptr->getMushroom(bullet_ptr->getPosition().getLine(), bullet_ptr->getPosition().getColumn()) == 0)
+                    {
+                        this->increaseScore(ScoreType::mushroomKill);
+                    }
+                    // Collision bullet & mushroom -> remove bullet.
+                    bullet_ptr = bullets_ptr->erase(bullet_ptr);
+                    // no increment here, since bullet_ptr already points to the following element.
+                    continue;
+                }
+                // No collision, bullet remains in list.
+                // check next bullet.
+                bullet_ptr++;
+            }
+        }
+
+        /**
+         * Moves the starship if any direction was set by button press.
+         */
+        void moveStarshipIfNecessary(IInputBufferReader &input,
+                                     std::shared_ptr<Starship> starship_ptr,
+                                     std::shared_ptr<MushroomMap> mushroomMap_ptr)
+        {
+            auto direction = input.getAndResetDirection();
+            if(direction == Direction::none)
+            {
+                // no direction was picked.
+                return;
+            }
+
+            // valid direction was picked.
+            starship_ptr->move(direction, *mushroomMap_ptr);
+        }
+
+        /**
+         * Moves the starship as soon as a direction was picked, unless it moved less than the cooldown ago.
+         * A direction picked during the cooldown stays in the input and is applied when the cooldown is over.
+         */
+        void moveStarshipIfReady(IInputBufferReader &input,
+                                 std::shared_ptr<Starship> starship_ptr,
+                                 std::shared_ptr<MushroomMap> mushroomMap_ptr,
+                                 int currentGameTick,
+                                 int cooldown)
+        {
+            if(currentGameTick < starship_ptr->getNextMoveGameTick())
+            {
+                return;
+            }
+            auto direction = input.getAndResetDirection();
+            if(direction == Direction::none)
+            {
+                return;
+            }
+            if(starship_ptr->move(direction, *mushroomMap_ptr))
+            {
+                starship_ptr->setNextMoveGameTick(currentGameTick + cooldown);
+                this->starshipMovedInGametick = true;
+            }
+        }
+
+        // //////////////////////////////////////////////////
+
+        /**
+         * Moves all centipedes if possible.
+         */
+        void moveCentipedes(std::shared_ptr<CentipedeList> centipedes_ptr,
+                            std::shared_ptr<MushroomMap> mushroomMap_ptr,
+                            std::shared_ptr<CentipedeSettings> settings_ptr)
+        {
+            auto centipede_ptr = centipedes_ptr->begin();
+            while(centipede_ptr != centipedes_ptr->end())
+            {
+                centipede_ptr->move(*mushroomMap_ptr, *centipedes_ptr, settings_ptr);
+                centipede_ptr++;
+            }
+        }
+
+        // //////////////////////////////////////////////////
+
+        /**
+         * Handles collisions between bullets and centipedes.
+         */
+        void collideBulletsCentipedes(std::shared_ptr<CentipedeList> centipedes_ptr,
+                                      std::shared_ptr<BulletVector> bullets_ptr,
+                                      std::shared_ptr<MushroomMap> mushroomMap_ptr)
+        {
+            auto centipede_ptr = centipedes_ptr->begin();
+            while(centipede_ptr != centipedes_ptr->end())
+            {
+                // Indicator wheather the head was hit.
+                bool headHit = false;
+                // Check bullets.
+                // No simple "for" loop because list may be edited while looping through.
+                auto bullet_ptr = bullets_ptr->begin();
+                while(bullet_ptr != bullets_ptr->end())
+                {
+                    auto collisionResult = centipede_ptr->collide(*bullet_ptr, mushroomMap_ptr);
+                    auto hitIndicator = collisionResult.getItem1();
+                    auto splitOfTail_ptr = collisionResult.getItem2();
+                    if(hitIndicator == CentipedeHit::noHit)
+                    {
+                        // Nothing left to do, just continue checking the others.
+                        ++bullet_ptr;
+                        continue;
+                    }
+
+                    if(this->heatmap_ptr != nullptr)
+                    {
+                        auto hitPosition = bullet_ptr->getPosition();
+                        this->heatmap_ptr->record(HeatmapLayer::centipedeHitLayer, hitPosition.getLine(), hitPosition.getColumn());
+                    }
+                    // Bullet has hit -> remove from list.
+                    bullet_ptr = bullets_ptr->erase(bullet_ptr);
+                    // Update score
+                    this->increaseScore(ScoreType::centipedeHit);
+
+                    // Create new centipede from split of tail if necessary.
+                    if(splitOfTail_ptr != nullptr)
+                    {
+                        // Appended behind the others, the iterators of the list stay valid.
+                        centipedes_ptr->emplace_back(splitOfTail_ptr);
+                    }
+
+                    if(hitIndicator == CentipedeHit::tailHit)
+                    {
+                        // Nothing left to do, just continue checking the others.
+                        // bullet_ptr already points to next item.
+                        continue;
+                    }
+
+                    // The head of the Centipede was hit -> return true and do NOT continue checking more bullets.
+                    headHit = true;
+                    break;
+                }
+
+                if(headHit)
+                {
+                    // Head needs to be removed.
+                    centipede_ptr = centipedes_ptr->erase(centipede_ptr);
+                    continue;
+                }
+
+                // No hit or only tail hit -> continue regulary.
+                ++centipede_ptr;
+            }
+        }
+
+        /**
+         * Handles collisions between centipedes and the starship.
+         */
+        void collidePlayerCentipedes(std::shared_ptr<CentipedeList> centipedes_ptr,
+                                     std::shared_ptr<Starship> starship_ptr)
+        {
+            auto starshipPosition = starship_ptr->getPosition();
+            for(auto &centipede : *centipedes_ptr)
+            {
+                if(!centipede.isAtPosition(starshipPosition))
+                {
+                    // No collision, game continues running.
+                    continue;
+                }
+
+                if(this->heatmap_ptr != nullptr)
+                {
+                    this->heatmap_ptr->record(HeatmapLayer::starshipDeathLayer, starshipPosition.getLine(), starshipPosition.getColumn());
+                }
+                // Collision player & centipede -> lose game.
+                this->loseLive();
+                // All centipedes are gone now, no need to check the others.
+                return;
+            }
+        }
+
+        /**
+         * Handles collisions between centipedes and both starships. The players share their lives,
+         * a hit of either one ends the round for both.
+         */
+        void collidePlayersCentipedes(std::shared_ptr<CentipedeList> centipedes_ptr, std::shared_ptr<SaveState> saveState_ptr)
+        {
+            this->collidePlayerCentipedes(centipedes_ptr, saveState_ptr->getStarship());
+            auto secondStarship_ptr = saveState_ptr->getSecondStarship();
+            if(secondStarship_ptr != nullptr)
+            {
+                this->collidePlayerCentipedes(centipedes_ptr, secondStarship_ptr);
+            }
+        }
+
+        /**
+         * Runs one gametick for one or, with a second input, two players.
+         */
+        void runGametick(IInputBufferReader &input, IInputBufferReader *secondInput)
+        {
+            auto saveState_ptr = this->saveState_ptr;
+            if(this->roundEnded())
+            {
+                this->finishRound(saveState_ptr);
+                this->startNextRound(saveState_ptr);
+            }
+
+            saveState_ptr->incrementGameTick();
+            this->starshipMovedInGametick = false;
+            auto profiler = this->profiler_ptr.get();
+            {
+                ProfiledPhase phase(profiler, GamePhase::playerPhase);
+                this->handlePlayerControlledEntities(input, secondInput, saveState_ptr);
+            }
+            {
+                ProfiledPhase phase(profiler, GamePhase::centipedePhase);
+                this->handleCentipedes(saveState_ptr);
+            }
+            {
+                ProfiledPhase phase(profiler, GamePhase::collisionPhase);
+                this->handleGlobalCollisions(saveState_ptr);
+            }
+        }
+
+        /**
+         * Decreases player health by 1, kills all centipedes and lets the round end without getting points.
+         */
+        void loseLive()
+        {
+            // Decrease health.
+            this->saveState_ptr->loseLive();
+            // This makes shure that no points for the round end are gained.
+            this->saveState_ptr->setDiedInRound(true);
+            // Remove all enemies.
+            this->saveState_ptr->getCentipedes()->clear();
+        }
+
+    public:
+        GameSimulation(std::shared_ptr<SaveState> saveState_ptr,
+                       std::shared_ptr<PhaseProfiler> profiler_ptr = nullptr,
+                       std::shared_ptr<Heatmap> heatmap_ptr = nullptr)
+        {
+            this->saveState_ptr = saveState_ptr;
+            this->profiler_ptr = profiler_ptr;
+            this->heatmap_ptr = heatmap_ptr;
+            this->starshipMovedInGametick = false;
+            this->centipedeStepsInGametick = 0;
+        }
+
+        /**
+         * Creates the state of a new game, all random decisions of the game are derived from the seed.
+         * With two players the second starship starts two columns right of the first one, or left at the right edge.
+         */
+        static std::shared_ptr<SaveState> createNewGame(std::shared_ptr<CentipedeSettings> settings_ptr, unsigned int seed, int players = 1)
+        {
+            auto bullets_ptr = std::make_shared<BulletVector>();
+            auto starship_ptr = std::make_shared<Starship>(settings_ptr->getInitialStarshipLine(),
+                                                           settings_ptr->getInitialStarshipColumn(),
+                                                           settings_ptr);
+            auto mushroomMap_ptr = std::make_shared<MushroomMap>(settings_ptr, true, seed);
+            auto centipedes_ptr = std::make_shared<CentipedeList>();
+            int currentCentipedeSpeed = calculateCentipedeSpeed(settings_ptr, 0);
+            int currentRound = 0;
+            int score = 0;
+            int lives = settings_ptr->getInitialPlayerHealth();
+            auto state_ptr = std::make_shared<SaveState>(settings_ptr,
+                                                         bullets_ptr,
+                                                         starship_ptr,
+                                                         mushroomMap_ptr,
+                                                         centipedes_ptr,
+                                                         currentCentipedeSpeed,
+                                                         currentRound,
+                                                         score,
+                                                         lives,
+                                                         seed);
+            if(players > 1)
+            {
+                auto column = settings_ptr->getInitialStarshipColumn() + 2;
+                if(column >= settings_ptr->getPlayingFieldWidth())
+                {
+                    column = settings_ptr->getInitialStarshipColumn() - 2;
+                }
+                state_ptr->setSecondStarship(std::make_shared<Starship>(settings_ptr->getInitialStarshipLine(), column, settings_ptr));
+            }
+            return state_ptr;
+        }
+
+        std::shared_ptr<SaveState> getSaveState()
+        {
+            return this->saveState_ptr;
+        }
+
+        /**
+         * Returns false if the player has no lives left.
+         */
+        bool alive()
+        {
+            return this->saveState_ptr->getLives() > 0;
+        }
+
+        /**
+         * Returns true if there are no centipedes left, the next gametick starts a new round.
+         */
+        bool roundEnded()
+        {
+            return !this->continueRound(this->saveState_ptr->getCentipedes());
+        }
+
+        /**
+         * Runs one gametick.
+         * If the previous round has ended, it is finished and the next one is started first.
+         * Shots are only read on gameticks in which bullets move, directions only when the starship may move.
+         */
+        void executeGametick(IInputBufferReader &input)
+        {
+            this->runGametick(input, nullptr);
+        }
+
+        /**
+         * Runs one gametick of a two player game, the second input steers the second starship.
+         * The first starship always acts first, so both players get the same game from the same inputs.
+         */
+        void executeGametick(IInputBufferReader &input, IInputBufferReader &secondInput)
+        {
+            if(this->saveState_ptr->getSecondStarship() == nullptr)
+            {
+                throw std::logic_error("The game has no second starship.");
+            }
+            this->runGametick(input, &secondInput);
+        }
+
+        /**
+         * Ends the game by taking all remaining lives.
+         */
+        void quit()
+        {
+            while(this->alive())
+            {
+                this->loseLive();
+            }
+        }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,204 @@
+#ifndef HEATMAP_HPP
+#define HEATMAP_HPP
+#include "../Common/CentipedeSettings.hpp"
+#include "../GameObjects/MushroomMap.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * What a Heatmap counts per cell.
+ */
+enum HeatmapLayer : int
+{
+    // The starship was hit by a centipede here.
+    starshipDeathLayer,
+    // A bullet hit a centipede here.
+    centipedeHitLayer,
+    // A mushroom stood here at the end of a round.
+    mushroomLayer,
+    heatmapLayerCount
+};
+
+/**
+ * Statistics per cell of the playing field over many games, e.g. for balancing.
+ * A Heatmap is filled by one thread only: every worker of a batch fills its own, they are merged afterwards.
+ */
+class Heatmap
+{
+    private:
+        int lines;
+        int columns;
+        // Layer by layer, each line by line.
+        std::vector<uint64_t> cells;
+        uint64_t games;
+        uint64_t rounds;
+
+        size_t getIndex(HeatmapLayer layer, int line, int column)
+        {
+            return ((size_t) layer * this->lines + line) * this->columns + column;
+        }
+
+        /**
+         * Adds the given lines of every layer of the other heatmaps.
+         */
+        void addLines(std::vector<Heatmap*> &heatmaps, int fromLine, int toLine)
+        {
+            for(int layer = 0; layer < HeatmapLayer::heatmapLayerCount; layer++)
+            {
+                auto from = this->getIndex((HeatmapLayer) layer, fromLine, 0);
+                auto to = this->getIndex((HeatmapLayer) layer, toLine, 0);
+                for(auto heatmap : heatmaps)
+                {
+                    auto source = heatmap->cells.data();
+                    auto target = this->cells.data();
+                    for(auto cell = from; cell < to; cell++)
+                    {
+                        target[cell] += source[cell];
+                    }
+                }
+            }
+        }
+
+    public:
+        Heatmap(int lines, int columns)
+            : lines(lines), columns(columns), cells((size_t) HeatmapLayer::heatmapLayerCount * lines * columns, 0)
+        {
+            this->games = 0;
+            this->rounds = 0;
+        }
+
+        /**
+         * Heatmap in the size of the playing field, like the MushroomMap.
+         */
+        Heatmap(std::shared_ptr<CentipedeSettings> settings_ptr)
+            : Heatmap(settings_ptr->getPlayingFieldHeight(), settings_ptr->getPlayingFieldWidth())
+        {
+        }
+
+        int getLines()
+        {
+            return this->lines;
+        }
+
+        int getColumns()
+        {
+            return this->columns;
+        }
+
+        uint64_t get(HeatmapLayer layer, int line, int column)
+        {
+            return this->cells[this->getIndex(layer, line, column)];
+        }
+
+        /**
+         * Returns the highest count of the layer.
+         */
+        uint64_t getMaximum(HeatmapLayer layer)
+        {
+            auto first = this->cells.begin() + this->getIndex(layer, 0, 0);
+            return *std::max_element(first, first + (size_t) this->lines * this->columns);
+        }
+
+        uint64_t getGames()
+        {
+            return this->games;
+        }
+
+        uint64_t getRounds()
+        {
+            return this->rounds;
+        }
+
+        /**
+         * Counts an event at the cell, events outside of the field are ignored.
+         */
+        void record(HeatmapLayer layer, int line, int column)
+        {
+            if(line < 0 || line >= this->lines || column < 0 || column >= this->columns)
+            {
+                return;
+            }
+            this->cells[this->getIndex(layer, line, column)]++;
+        }
+
+        /**
+         * Counts every cell with a mushroom at the end of a round.
+         */
+        void recordMushrooms(MushroomMap &mushroomMap)
+        {
+            for(int line = 0; line < this->lines; line++)
+            {
+                auto row = this->cells.data() + this->getIndex(HeatmapLayer::mushroomLayer, line, 0);
+                for(int column = 0; column < this->columns; column++)
+                {
+                    row[column] += mushroomMap.getMushroom(line, column) > 0;
+                }
+            }
+            this->rounds++;
+        }
+
+        void recordGame()
+        {
+            this->games++;
+        }
+
+        /**
+         * Adds the other heatmaps to this one. The lines are split into bands, each band is added by its own thread,
+         * so that no two threads write the same cell. Up to the given number of threads, 0 for one per hardware thread.
+         */
+        void merge(std::vector<Heatmap*> &heatmaps, int threads = 0)
+        {
+            for(auto heatmap : heatmaps)
+            {
+                if(heatmap->lines != this->lines || heatmap->columns != this->columns)
+                {
+                    throw std::logic_error("Only heatmaps of the same size can be merged.");
+                }
+                this->games += heatmap->games;
+                this->rounds += heatmap->rounds;
+            }
+            threads = threads > 0 ? threads : (int) std::thread::hardware_concurrency();
+            auto bands = std::min(std::max(threads, 1), std::max(this->lines, 1));
+            auto linesPerBand = (this->lines + bands - 1) / bands;
+            std::vector<std::thread> workers;
+            for(int band = 1; band < bands && band * linesPerBand < this->lines; band++)
+            {
+                workers.emplace_back(&Heatmap::addLines, this, std::ref(heatmaps), band * linesPerBand,
+                                     std::min((band + 1) * linesPerBand, this->lines));
+            }
+            this->addLines(heatmaps, 0, std::min(linesPerBand, this->lines));
+            for(auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        /**
+         * Writes one row per cell: layer, line, column, count.
+         */
+        void writeCsv(std::ostream &output)
+        {
+            const std::string layerNames[] = { "starship_deaths", "centipede_hits", "mushrooms" };
+            output << "layer,line,column,count\n";
+            for(int layer = 0; layer < HeatmapLayer::heatmapLayerCount; layer++)
+            {
+                for(int line = 0; line < this->lines; line++)
+                {
+                    for(int column = 0; column < this->columns; column++)
+                    {
+                        output << layerNames[layer] << ',' << line << ',' << column << ','
+                               << this->get((HeatmapLayer) layer, line, column) << '\n';
+                    }
+                }
+            }
+        }
+};
+
+#endif
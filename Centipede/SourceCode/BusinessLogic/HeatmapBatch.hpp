@@ -0,0 +1,123 @@
+#ifndef HEATMAP_BATCH_HPP
+#define HEATMAP_BATCH_HPP
+#include "GameSimulation.hpp"
+#include "Heatmap.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../Common/SessionMemoryPool.hpp"
+#include "../Input/ReplayInputBuffer.hpp"
+#include "../Input/ScriptedPlayer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * Plays a batch of headless games with the ScriptedPlayer on several threads and counts what happened where.
+ * Every worker counts into its own Heatmap without any synchronization,
+ * the heatmaps are merged by the same number of threads once all games are played.
+ */
+class HeatmapBatch
+{
+    private:
+        std::shared_ptr<CentipedeSettings> settings_ptr;
+        int games;
+        int threads;
+        int maxGameTicks;
+        unsigned int firstSeed;
+        InputPolicy policy;
+        std::atomic<int> nextGame;
+        std::atomic<long> gameTicks;
+
+        void playGames(std::shared_ptr<Heatmap> heatmap_ptr)
+        {
+            ReplayInputBuffer input;
+            long playedGameTicks = 0;
+            while(true)
+            {
+                auto game = this->nextGame.fetch_add(1, std::memory_order_relaxed);
+                if(game >= this->games)
+                {
+                    break;
+                }
+                // Every game is a session with its own pool, like in the game.
+                SessionMemory sessionMemory;
+                SessionMemoryScope sessionMemoryScope(sessionMemory);
+                auto saveState_ptr = GameSimulation::createNewGame(this->settings_ptr, this->firstSeed + game);
+                GameSimulation simulation(saveState_ptr, nullptr, heatmap_ptr);
+                ScriptedPlayer player(this->firstSeed + game, this->policy);
+                while(simulation.alive() && saveState_ptr->getGameTick() < this->maxGameTicks)
+                {
+                    input.setInput(player.nextInput(*saveState_ptr));
+                    simulation.executeGametick(input);
+                }
+                playedGameTicks += saveState_ptr->getGameTick();
+                heatmap_ptr->recordGame();
+            }
+            this->gameTicks.fetch_add(playedGameTicks, std::memory_order_relaxed);
+        }
+
+    public:
+        /**
+         * Batch of the given number of games, played by up to the given number of threads, 0 for one per hardware thread.
+         * Games end when they are lost or after maxGameTicks, game i is played with the seed firstSeed + i.
+         */
+        HeatmapBatch(int games, int threads, int maxGameTicks, unsigned int firstSeed, InputPolicy policy = InputPolicy::autopilotPolicy)
+            : nextGame(0), gameTicks(0)
+        {
+            this->settings_ptr = std::make_shared<CentipedeSettings>();
+            this->games = games;
+            this->threads = threads > 0 ? threads : std::max(1, (int) std::thread::hardware_concurrency());
+            this->maxGameTicks = maxGameTicks;
+            this->firstSeed = firstSeed;
+            this->policy = policy;
+        }
+
+        /**
+         * Plays all games and returns the merged heatmap.
+         */
+        std::shared_ptr<Heatmap> run()
+        {
+            this->nextGame = 0;
+            this->gameTicks = 0;
+            std::vector<std::shared_ptr<Heatmap>> heatmaps;
+            for(int worker = 0; worker < this->threads; worker++)
+            {
+                heatmaps.push_back(std::make_shared<Heatmap>(this->settings_ptr));
+            }
+            std::vector<std::thread> workers;
+            for(int worker = 1; worker < this->threads; worker++)
+            {
+                workers.emplace_back(&HeatmapBatch::playGames, this, heatmaps[worker]);
+            }
+            this->playGames(heatmaps[0]);
+            for(auto &worker : workers)
+            {
+                worker.join();
+            }
+
+            auto merged_ptr = std::make_shared<Heatmap>(this->settings_ptr);
+            std::vector<Heatmap*> parts;
+            for(auto &heatmap_ptr : heatmaps)
+            {
+                parts.push_back(heatmap_ptr.get());
+            }
+            merged_ptr->merge(parts, this->threads);
+            return merged_ptr;
+        }
+
+        /**
+         * Gameticks played by the last run.
+         */
+        long getGameTicks()
+        {
+            return this->gameTicks;
+        }
+
+        int getThreads()
+        {
+            return this->threads;
+        }
+};
+
+#endif
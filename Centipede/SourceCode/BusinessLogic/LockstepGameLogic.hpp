@@ -0,0 +1,107 @@
+#ifndef LOCKSTEP_GAME_LOGIC_HPP
+#define LOCKSTEP_GAME_LOGIC_HPP
+#include "GameSimulation.hpp"
+#include "RollbackSession.hpp"
+#include "../Input/IInputBufferReader.hpp"
+#include "../Network/ILockstepLink.hpp"
+#include "../Common/IUI.hpp"
+#include "../Common/ITheme.hpp"
+#include "../Common/SessionMemoryPool.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Runs a two player game in lockstep with another process, see RollbackSession.
+ * There is no breakout menu, the game can't be paused for the other player: 'q' quits the game for both.
+ * Lockstep games are neither recorded nor autosaved.
+ */
+class LockstepGameLogic
+{
+    private:
+        std::shared_ptr<IInputBufferReader> inputBuffer_ptr;
+        std::shared_ptr<IUI> ui_ptr;
+        std::shared_ptr<ITheme> theme_ptr;
+        std::shared_ptr<CentipedeSettings> settings_ptr;
+        std::shared_ptr<ILockstepLink> link_ptr;
+        unsigned int seed;
+        int localPlayer;
+
+        /**
+         * Displays the score, or that the other player left.
+         */
+        void showResult(RollbackSession &session)
+        {
+            std::string title = session.isAbandoned() ? "Connection lost" : "Game Over";
+            std::vector<std::string> text;
+            text.push_back("Your score was " + std::to_string(session.getSaveState()->getScore()));
+            if(session.isAbandoned())
+            {
+                text.push_back("The other player left the game.");
+            }
+            std::vector<std::string> options;
+            this->ui_ptr->displayMenu(title, ConsoleColour::Red, text, options, -1, *(this->theme_ptr), *(this->settings_ptr));
+        }
+
+    public:
+        /**
+         * The local player is 0 on the side that hosts the game and 1 on the side that joined it.
+         */
+        LockstepGameLogic(std::shared_ptr<IInputBufferReader> inputBuffer_ptr,
+                          std::shared_ptr<IUI> ui_ptr,
+                          std::shared_ptr<ITheme> theme_ptr,
+                          std::shared_ptr<CentipedeSettings> settings_ptr,
+                          std::shared_ptr<ILockstepLink> link_ptr,
+                          unsigned int seed,
+                          int localPlayer)
+        {
+            this->inputBuffer_ptr = inputBuffer_ptr;
+            this->ui_ptr = ui_ptr;
+            this->theme_ptr = theme_ptr;
+            this->settings_ptr = settings_ptr;
+            this->link_ptr = link_ptr;
+            this->seed = seed;
+            this->localPlayer = localPlayer;
+        }
+
+        /**
+         * Plays the game until it is over on both sides or the other player is gone.
+         * A gametick is simulated per tick of the clock. The gameticks, that were held up while waiting for the other player,
+         * are simulated right away once its inputs arrive, so that the game is back on the schedule of the clock.
+         */
+        void play()
+        {
+            SessionMemory sessionMemory;
+            SessionMemoryScope sessionMemoryScope(sessionMemory);
+            auto saveState_ptr = GameSimulation::createNewGame(this->settings_ptr, this->seed, 2);
+            RollbackSession session(saveState_ptr, this->link_ptr, this->localPlayer, this->settings_ptr->getLockstepMaxRollbackTicks());
+            auto gameTickLength = std::chrono::milliseconds(this->settings_ptr->getGameTickLength());
+            auto nextGameTick = std::chrono::steady_clock::now() + gameTickLength;
+            while(!session.isFinished() && !session.isAbandoned())
+            {
+                std::this_thread::sleep_until(nextGameTick);
+                auto advanced = false;
+                while(nextGameTick <= std::chrono::steady_clock::now() && session.advance(*(this->inputBuffer_ptr)))
+                {
+                    advanced = true;
+                    nextGameTick += gameTickLength;
+                    if(saveState_ptr->getCentipedes()->empty() && saveState_ptr->hasDiedInRound())
+                    {
+                        // Delay after a starship got hit, the other side takes the same break at the same gametick.
+                        nextGameTick += std::chrono::milliseconds(this->settings_ptr->getLiveLostBreakTime());
+                    }
+                }
+                if(!advanced)
+                {
+                    // Waiting for the other player, asks again a gametick later.
+                    std::this_thread::sleep_for(gameTickLength);
+                }
+                this->ui_ptr->displayImage(*saveState_ptr, *(this->settings_ptr), *(this->theme_ptr));
+            }
+            this->showResult(session);
+        }
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef REPLAY_PLAYER_HPP
+#define REPLAY_PLAYER_HPP
+#include "GameSimulation.hpp"
+#include "../Input/ReplayInputBuffer.hpp"
+#include "../Input/TickInput.hpp"
+#include "../Persistence/ReplayReader.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../Common/IUI.hpp"
+#include "../Common/ITheme.hpp"
+#include "../Common/GamePhase.hpp"
+#include "../Common/SessionMemoryPool.hpp"
+#include "../../lib/perf_lib.hpp"
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * Restores any gametick of a recorded game and plays it back from there.
+ */
+class ReplayPlayer
+{
+    private:
+        std::shared_ptr<ReplayReader> reader_ptr;
+        std::shared_ptr<IUI> ui_ptr;
+        std::shared_ptr<ITheme> theme_ptr;
+        std::shared_ptr<PhaseProfiler> profiler_ptr;
+
+        /**
+         * Runs the simulation with the recorded inputs up to the given gametick or until the game has ended.
+         * Calls afterGametick after every gametick.
+         */
+        void simulateUntil(GameSimulation &simulation, int gameTick, std::function<void(GameSimulation&)> afterGametick)
+        {
+            auto saveState_ptr = simulation.getSaveState();
+            auto inputs = this->reader_ptr->readInputs(saveState_ptr->getGameTick() + 1, gameTick);
+            ReplayInputBuffer input;
+            size_t nextInput = 0;
+            while(simulation.alive() && saveState_ptr->getGameTick() < gameTick)
+            {
+                auto currentGameTick = saveState_ptr->getGameTick() + 1;
+                bool quit = false;
+                input.clear();
+                if(nextInput < inputs.size() && inputs[nextInput].getGameTick() == currentGameTick)
+                {
+                    input.setInput(inputs[nextInput]);
+                    quit = inputs[nextInput].getQuit();
+                    nextInput++;
+                }
+                simulation.executeGametick(input);
+                if(quit)
+                {
+                    simulation.quit();
+                }
+                afterGametick(simulation);
+            }
+        }
+
+    public:
+        ReplayPlayer(std::shared_ptr<ReplayReader> reader_ptr,
+                     std::shared_ptr<IUI> ui_ptr,
+                     std::shared_ptr<ITheme> theme_ptr,
+                     std::shared_ptr<PhaseProfiler> profiler_ptr = nullptr)
+        {
+            this->reader_ptr = reader_ptr;
+            this->ui_ptr = ui_ptr;
+            this->theme_ptr = theme_ptr;
+            this->profiler_ptr = profiler_ptr;
+        }
+
+        /**
+         * Returns the state after the given gametick.
+         * Loads the nearest keyframe before it and replays at most one keyframe interval of gameticks.
+         */
+        std::shared_ptr<SaveState> seek(int gameTick)
+        {
+            auto saveState_ptr = this->reader_ptr->loadKeyframe(gameTick);
+            GameSimulation simulation(saveState_ptr);
+            this->simulateUntil(simulation, gameTick, [](GameSimulation&){});
+            return saveState_ptr;
+        }
+
+        /**
+         * Shows the recorded game from the given gametick on and returns the number of gameticks played.
+         * Paced plays in the speed of the game, otherwise every gametick is shown as fast as possible.
+         */
+        int play(int fromGameTick, bool paced = true)
+        {
+            // The playback is a session of its own, like a game.
+            SessionMemory sessionMemory;
+            SessionMemoryScope sessionMemoryScope(sessionMemory);
+            auto saveState_ptr = this->seek(fromGameTick);
+            auto settings_ptr = saveState_ptr->getSettings();
+            auto ui_ptr = this->ui_ptr;
+            auto theme_ptr = this->theme_ptr;
+            auto profiler = this->profiler_ptr.get();
+            GameSimulation simulation(saveState_ptr, this->profiler_ptr);
+            ui_ptr->displayImage(*saveState_ptr, *settings_ptr, *theme_ptr);
+
+            auto startGameTick = saveState_ptr->getGameTick();
+            auto nextGametick = std::chrono::steady_clock::now();
+            auto gameTickLength = std::chrono::milliseconds(settings_ptr->getGameTickLength());
+            this->simulateUntil(simulation, this->reader_ptr->getLastGameTick(), [&](GameSimulation &simulation)
+            {
+                if(paced)
+                {
+                    nextGametick += gameTickLength;
+                    std::this_thread::sleep_until(nextGametick);
+                }
+                {
+                    ProfiledPhase render(profiler, GamePhase::renderPhase);
+                    ui_ptr->displayImage(*saveState_ptr, *settings_ptr, *theme_ptr);
+                }
+                if(paced && simulation.roundEnded() && saveState_ptr->hasDiedInRound())
+                {
+                    // Same delay as in the game after the starship got hit.
+                    std::this_thread::sleep_for(std::chrono::milliseconds(settings_ptr->getLiveLostBreakTime()));
+                    nextGametick = std::chrono::steady_clock::now();
+                }
+            });
+            return saveState_ptr->getGameTick() - startGameTick;
+        }
+};
+
+#endif
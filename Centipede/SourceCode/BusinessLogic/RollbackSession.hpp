@@ -0,0 +1,265 @@
+#ifndef ROLLBACK_SESSION_HPP
+#define ROLLBACK_SESSION_HPP
+#include "GameSimulation.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../Input/IInputBufferReader.hpp"
+#include "../Input/LatchedInputBuffer.hpp"
+#include "../Input/TickInput.hpp"
+#include "../Network/ILockstepLink.hpp"
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * One side of a two player game, played in lockstep with the other side over an ILockstepLink.
+ * Both sides simulate the whole game from the same seed and exchange only their inputs.
+ *
+ * The local side doesn't wait for the input of the other player: it predicts, that the other player does nothing,
+ * which is what players do in most gameticks. When an input arrives for a gametick that was already simulated,
+ * the game is rolled back to the snapshot taken before that gametick and simulated again up to the current one.
+ * The local side runs at most maxRollbackTicks ahead of the last confirmed input of the other player, it waits beyond that.
+ * Snapshots are taken into preallocated states, so taking one doesn't allocate except for the centipedes.
+ */
+class RollbackSession
+{
+    private:
+        static constexpr int playerCount = 2;
+
+        std::shared_ptr<SaveState> saveState_ptr;
+        GameSimulation simulation;
+        std::shared_ptr<ILockstepLink> link_ptr;
+        int localPlayer;
+        int remotePlayer;
+        int maxRollbackTicks;
+        // Input of both players, that the game didn't read yet.
+        std::array<LatchedInputBuffer, playerCount> inputBuffers;
+        // The state before gametick t and the input not read by then, both in slot t % size.
+        std::vector<std::shared_ptr<SaveState>> snapshots;
+        std::vector<std::array<LatchedInputBuffer, playerCount>> snapshotInputBuffers;
+        // Inputs of both players by gametick, as far as they are still needed for a rollback.
+        std::array<std::map<int, TickInput>, playerCount> inputs;
+        std::vector<TickInput> received;
+        // Last gametick that was simulated.
+        int lastGameTick;
+        // Last gametick of which the input of the other player is known.
+        int confirmedGameTick;
+        bool connected;
+
+        long rollbacks;
+        long resimulatedGameTicks;
+        long stalls;
+
+        /**
+         * Returns the input of the player in the gametick, the prediction "nothing" if it is not known yet.
+         */
+        TickInput getInput(int player, int gameTick)
+        {
+            auto input = this->inputs[player].find(gameTick);
+            if(input == this->inputs[player].end())
+            {
+                return TickInput(gameTick, Direction::none, false, false);
+            }
+            return input->second;
+        }
+
+        /**
+         * Takes a snapshot and simulates the gametick with the inputs known or predicted.
+         */
+        void simulateGameTick(int gameTick)
+        {
+            auto slot = gameTick % this->snapshots.size();
+            this->snapshots[slot]->copyFrom(*(this->saveState_ptr));
+            this->snapshotInputBuffers[slot] = this->inputBuffers;
+
+            auto quit = false;
+            for(int player = 0; player < playerCount; player++)
+            {
+                auto input = this->getInput(player, gameTick);
+                this->inputBuffers[player].add(input);
+                quit = quit || input.getQuit();
+            }
+            this->simulation.executeGametick(this->inputBuffers[0], this->inputBuffers[1]);
+            if(quit)
+            {
+                this->simulation.quit();
+            }
+            this->lastGameTick = gameTick;
+        }
+
+        /**
+         * Goes back to the state before the gametick and simulates again up to the last gametick, or until the game is over.
+         */
+        void rollBack(int gameTick)
+        {
+            auto slot = gameTick % this->snapshots.size();
+            this->saveState_ptr->copyFrom(*(this->snapshots[slot]));
+            this->inputBuffers = this->snapshotInputBuffers[slot];
+            auto lastGameTick = this->lastGameTick;
+            this->lastGameTick = gameTick - 1;
+            for(auto resimulated = gameTick; resimulated <= lastGameTick && this->simulation.alive(); resimulated++)
+            {
+                this->simulateGameTick(resimulated);
+                this->resimulatedGameTicks++;
+            }
+            this->rollbacks++;
+        }
+
+        /**
+         * Takes over the inputs of the other player, that arrived, and rolls back if one of them was mispredicted.
+         */
+        void poll()
+        {
+            this->received.clear();
+            this->connected = this->link_ptr->receive(this->received) && this->connected;
+            auto firstMispredicted = this->lastGameTick + 1;
+            for(auto &input : this->received)
+            {
+                auto gameTick = input.getGameTick();
+                if(gameTick != this->confirmedGameTick + 1)
+                {
+                    throw std::logic_error("Input of gametick " + std::to_string(gameTick) + " arrived out of order.");
+                }
+                this->inputs[this->remotePlayer].emplace(gameTick, input);
+                this->confirmedGameTick = gameTick;
+                // Simulated gameticks after the last confirmed one were predicted as empty.
+                if(gameTick <= this->lastGameTick && !input.isEmpty())
+                {
+                    firstMispredicted = std::min(firstMispredicted, gameTick);
+                }
+            }
+            if(firstMispredicted <= this->lastGameTick)
+            {
+                this->rollBack(firstMispredicted);
+            }
+            // A rollback never goes back to a confirmed gametick.
+            auto needed = std::min(this->confirmedGameTick, this->lastGameTick);
+            for(auto &playerInputs : this->inputs)
+            {
+                playerInputs.erase(playerInputs.begin(), playerInputs.upper_bound(needed));
+            }
+        }
+
+    public:
+        /**
+         * Continues the game of the state, which needs a second starship. The local player steers the first starship with 0,
+         * the second one with 1, the other side plays the other one.
+         */
+        RollbackSession(std::shared_ptr<SaveState> saveState_ptr,
+                        std::shared_ptr<ILockstepLink> link_ptr,
+                        int localPlayer,
+                        int maxRollbackTicks)
+            : saveState_ptr(saveState_ptr), simulation(saveState_ptr), link_ptr(link_ptr)
+        {
+            if(saveState_ptr->getSecondStarship() == nullptr || localPlayer < 0 || localPlayer >= playerCount || maxRollbackTicks < 1)
+            {
+                throw std::logic_error("A lockstep game needs two starships, player 0 or 1 and at least one gametick of rollback.");
+            }
+            this->localPlayer = localPlayer;
+            this->remotePlayer = 1 - localPlayer;
+            this->maxRollbackTicks = maxRollbackTicks;
+            for(int slot = 0; slot <= maxRollbackTicks; slot++)
+            {
+                this->snapshots.push_back(saveState_ptr->clone());
+            }
+            this->snapshotInputBuffers.resize(this->snapshots.size());
+            this->lastGameTick = saveState_ptr->getGameTick();
+            this->confirmedGameTick = this->lastGameTick;
+            this->connected = true;
+            this->rollbacks = 0;
+            this->resimulatedGameTicks = 0;
+            this->stalls = 0;
+        }
+
+        /**
+         * Takes over what arrived from the other player and simulates the next gametick with the local input.
+         * Returns false if the game couldn't go on: it is over, the other player is too far behind or gone.
+         * The local input is only read, when the gametick is simulated.
+         */
+        bool advance(IInputBufferReader &localInput)
+        {
+            this->poll();
+            if(!this->simulation.alive())
+            {
+                return false;
+            }
+            auto gameTick = this->lastGameTick + 1;
+            // Without the other player only the gameticks of which its input arrived can be played.
+            if(!this->connected && gameTick > this->confirmedGameTick)
+            {
+                return false;
+            }
+            if(gameTick - this->confirmedGameTick > this->maxRollbackTicks)
+            {
+                this->stalls++;
+                return false;
+            }
+            // After a rollback ended the game early, the inputs already sent are used again.
+            if(this->inputs[this->localPlayer].count(gameTick) == 0)
+            {
+                auto direction = localInput.getAndResetDirection();
+                auto shot = localInput.getAndResetShot();
+                auto quit = localInput.getAndResetBreakoutMenu();
+                TickInput input(gameTick, direction, shot, quit);
+                this->inputs[this->localPlayer].emplace(gameTick, input);
+                this->link_ptr->send(input);
+            }
+            this->simulateGameTick(gameTick);
+            return true;
+        }
+
+        /**
+         * Returns true once the game is over with all inputs up to its end confirmed, a rollback can't change it anymore.
+         */
+        bool isFinished()
+        {
+            return !this->simulation.alive() && this->confirmedGameTick >= this->lastGameTick;
+        }
+
+        /**
+         * Returns true if the other player is gone before the game could be finished.
+         */
+        bool isAbandoned()
+        {
+            auto canCatchUp = this->simulation.alive() && this->lastGameTick < this->confirmedGameTick;
+            return !this->connected && !this->isFinished() && !canCatchUp;
+        }
+
+        std::shared_ptr<SaveState> getSaveState()
+        {
+            return this->saveState_ptr;
+        }
+
+        int getLastGameTick()
+        {
+            return this->lastGameTick;
+        }
+
+        int getConfirmedGameTick()
+        {
+            return this->confirmedGameTick;
+        }
+
+        long getRollbacks()
+        {
+            return this->rollbacks;
+        }
+
+        long getResimulatedGameTicks()
+        {
+            return this->resimulatedGameTicks;
+        }
+
+        /**
+         * Returns how often the session waited for the other player.
+         */
+        long getStalls()
+        {
+            return this->stalls;
+        }
+};
+
+#endif
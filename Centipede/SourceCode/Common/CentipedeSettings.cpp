@@ -24,8 +24,29 @@ CentipedeSettings::CentipedeSettings()
     
     this->gameTickLength = 10;
     this->starshipModuloGametickSlowdown = 4;
+    this->immediateStarshipInput = true;
+    this->starshipMoveCooldown = 4;
     this->initialCentipedeModuloGametickSlowdown = 8;
     this->centipedeSpeedIncrementAmount = 1;
     this->centipedeSpeedIncrementRoundModuloSlowdown = 5;
+    this->maxCentipedeCellsPerGametick = 4;
     this->liveLostBreakTime = 500;
+
+    this->adaptiveOutputBandwidth = true;
+    this->theme = "auto";
+    this->replayRecordingPath = "";
+    this->replayKeyframeInterval = 500;
+    this->autosavePath = "";
+    this->autosaveIntervalSeconds = 5;
+    this->autosaveEveryRound = true;
+    this->stateMirrorPath = "";
+    this->performanceCounters = false;
+    this->memoryReport = false;
+    this->lockstepMaxRollbackTicks = 8;
+    for(int role = 0; role < ThreadRole::threadRoleCount; role++)
+    {
+        this->threadCpus[role] = -1;
+        this->threadRealtimePriorities[role] = 0;
+        this->threadNiceLevels[role] = 0;
+    }
 }
\ No newline at end of file
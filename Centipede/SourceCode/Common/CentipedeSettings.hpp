@@ -1,5 +1,8 @@
 #ifndef CENTIPEDE_SETTINGS_HPP
 #define CENTIPEDE_SETTINGS_HPP
+#include "ThreadRole.hpp"
+#include "../../lib/thread_lib.hpp"
+#include <string>
 
 class CentipedeSettings
 {
@@ -28,10 +31,43 @@ class CentipedeSettings
 
         int gameTickLength;
         int starshipModuloGametickSlowdown;
+        // Move the starship in the gametick after the key press instead of the next starship gametick, at most once per cooldown.
+        bool immediateStarshipInput;
+        int starshipMoveCooldown;
         int initialCentipedeModuloGametickSlowdown;
         int centipedeSpeedIncrementAmount;
         int centipedeSpeedIncrementRoundModuloSlowdown;
+        // Centipedes faster than one cell per gametick move several cells within a gametick, but never more than this.
+        int maxCentipedeCellsPerGametick;
         int liveLostBreakTime;
+
+        // Drop frames and degrade the output, when the terminal can't keep up.
+        bool adaptiveOutputBandwidth;
+        // One of "auto", "standard", "ascii", "compact" or "monochrome". Can be overwritten by the command line.
+        std::string theme;
+        // File the game is recorded to, nothing is recorded if empty. Can be overwritten by the command line.
+        std::string replayRecordingPath;
+        // Gameticks between two full states in a replay, a seek replays at most this many gameticks.
+        int replayKeyframeInterval;
+        // File the running game is saved to in the background, nothing is saved if empty. Can be overwritten by the command line.
+        std::string autosavePath;
+        // Seconds between two autosaves, 0 to save only at the start of each round.
+        int autosaveIntervalSeconds;
+        bool autosaveEveryRound;
+        // File the state of every gametick is mirrored to for crash forensics, nothing is mirrored if empty. Can be overwritten by the command line.
+        std::string stateMirrorPath;
+        // Measure hardware counters per phase of a gametick and print them after the game. Can be overwritten by the command line.
+        bool performanceCounters;
+        // Print the live and peak memory of every subsystem after the game. Can be overwritten by the command line.
+        bool memoryReport;
+        // Gameticks a lockstep game runs ahead of the confirmed input of the other player, it waits beyond that.
+        // Every gametick more costs a snapshot, and a late input of the other player re-simulates up to this many gameticks.
+        int lockstepMaxRollbackTicks;
+        // Placement of each thread role: cpu (-1 for any), SCHED_FIFO priority (0 for normal scheduling) and nice level.
+        // Applied as far as the game is permitted to. Can be overwritten by the command line.
+        int threadCpus[ThreadRole::threadRoleCount];
+        int threadRealtimePriorities[ThreadRole::threadRoleCount];
+        int threadNiceLevels[ThreadRole::threadRoleCount];
     
     public:
         CentipedeSettings();
@@ -112,6 +148,18 @@ class CentipedeSettings
         {
             return this->starshipModuloGametickSlowdown;
         }
+        bool getImmediateStarshipInput()
+        {
+            return this->immediateStarshipInput;
+        }
+        void setImmediateStarshipInput(bool immediateStarshipInput)
+        {
+            this->immediateStarshipInput = immediateStarshipInput;
+        }
+        int getStarshipMoveCooldown()
+        {
+            return this->starshipMoveCooldown;
+        }
         int getInitialCentipedeModuloGametickSlowdown()
         {
             return this->initialCentipedeModuloGametickSlowdown;
@@ -124,10 +172,117 @@ class CentipedeSettings
         {
             return this->centipedeSpeedIncrementRoundModuloSlowdown;
         }
+        int getMaxCentipedeCellsPerGametick()
+        {
+            return this->maxCentipedeCellsPerGametick;
+        }
         int getLiveLostBreakTime()
         {
             return this->liveLostBreakTime;
         }
+
+        bool getAdaptiveOutputBandwidth()
+        {
+            return this->adaptiveOutputBandwidth;
+        }
+        std::string getTheme()
+        {
+            return this->theme;
+        }
+        std::string getReplayRecordingPath()
+        {
+            return this->replayRecordingPath;
+        }
+        void setReplayRecordingPath(std::string replayRecordingPath)
+        {
+            this->replayRecordingPath = replayRecordingPath;
+        }
+        int getReplayKeyframeInterval()
+        {
+            return this->replayKeyframeInterval;
+        }
+        std::string getAutosavePath()
+        {
+            return this->autosavePath;
+        }
+        void setAutosavePath(std::string autosavePath)
+        {
+            this->autosavePath = autosavePath;
+        }
+        int getAutosaveIntervalSeconds()
+        {
+            return this->autosaveIntervalSeconds;
+        }
+        bool getAutosaveEveryRound()
+        {
+            return this->autosaveEveryRound;
+        }
+        std::string getStateMirrorPath()
+        {
+            return this->stateMirrorPath;
+        }
+        void setStateMirrorPath(std::string stateMirrorPath)
+        {
+            this->stateMirrorPath = stateMirrorPath;
+        }
+        bool getPerformanceCounters()
+        {
+            return this->performanceCounters;
+        }
+        void setPerformanceCounters(bool performanceCounters)
+        {
+            this->performanceCounters = performanceCounters;
+        }
+        bool getMemoryReport()
+        {
+            return this->memoryReport;
+        }
+        void setMemoryReport(bool memoryReport)
+        {
+            this->memoryReport = memoryReport;
+        }
+
+        int getLockstepMaxRollbackTicks()
+        {
+            return this->lockstepMaxRollbackTicks;
+        }
+
+        int getThreadCpu(ThreadRole role)
+        {
+            return this->threadCpus[role];
+        }
+        void setThreadCpu(ThreadRole role, int cpu)
+        {
+            this->threadCpus[role] = cpu;
+        }
+        int getThreadRealtimePriority(ThreadRole role)
+        {
+            return this->threadRealtimePriorities[role];
+        }
+        void setThreadRealtimePriority(ThreadRole role, int priority)
+        {
+            this->threadRealtimePriorities[role] = priority;
+        }
+        int getThreadNiceLevel(ThreadRole role)
+        {
+            return this->threadNiceLevels[role];
+        }
+        void setThreadNiceLevel(ThreadRole role, int niceLevel)
+        {
+            this->threadNiceLevels[role] = niceLevel;
+        }
+        /**
+         * Returns the placement of the given thread, named "centi-<role>" for debuggers and profilers.
+         * The game runs on the main thread, which keeps the name of the program.
+         */
+        ThreadPlacement getThreadPlacement(ThreadRole role)
+        {
+            auto name = role == ThreadRole::gameThread ? "centipede" : "centi-" + getThreadRoleNames()[role];
+            return ThreadPlacement(name,
+                                   this->threadCpus[role],
+                                   this->threadRealtimePriorities[role],
+                                   this->threadNiceLevels[role]);
+        }
 };
 
 #endif
\ No newline at end of file
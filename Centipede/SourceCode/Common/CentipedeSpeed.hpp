@@ -0,0 +1,32 @@
+#ifndef CENTIPEDE_SPEED_HPP
+#define CENTIPEDE_SPEED_HPP
+#include <cstdint>
+
+/**
+ * Speeds of the centipedes are given in 1/centipedeSpeedScale cells per gametick.
+ * 5040 is divisible by every slowdown up to 10, so "one cell every n gameticks" stays exact.
+ */
+constexpr int centipedeSpeedScale = 5040;
+
+/**
+ * Returns the speed, at which a centipede moves one cell every given number of gameticks.
+ */
+inline int getCentipedeSpeedForSlowdown(int moduloGametickSlowdown)
+{
+    return centipedeSpeedScale / (moduloGametickSlowdown > 0 ? moduloGametickSlowdown : 1);
+}
+
+/**
+ * Returns the number of cells centipedes of the given speed move within the gametick, 0 or more.
+ * The accumulated distance is gameTick * speed, its whole cells are the steps taken so far.
+ * Derived from the gametick, the fraction of a cell needs no state of its own, and
+ * one cell every n gameticks moves exactly in the gameticks divisible by n.
+ */
+inline int getCentipedeStepsInGametick(int gameTick, int speed)
+{
+    auto distance = (int64_t) gameTick * speed;
+    auto previousDistance = distance - speed;
+    return (int) (distance / centipedeSpeedScale - previousDistance / centipedeSpeedScale);
+}
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef GAME_PHASE_HPP
+#define GAME_PHASE_HPP
+#include <string>
+#include <vector>
+
+/**
+ * Phases of a gametick, that are measured separately by the PhaseProfiler.
+ */
+enum GamePhase : int
+{
+    playerPhase,
+    centipedePhase,
+    collisionPhase,
+    renderPhase
+};
+
+inline std::vector<std::string> getGamePhaseNames()
+{
+    return { "player path", "centipede path", "collisions", "render" };
+}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef GAME_RANDOM_HPP
+#define GAME_RANDOM_HPP
+#include <cstdint>
+#include <random>
+
+/**
+ * Random generator of a game, draws the same numbers as a std::mt19937 with the same seed.
+ * It counts its draws, so that the seed and the count are enough to restore it,
+ * instead of the 5 KB of the state of the Mersenne Twister.
+ */
+class GameRandom
+{
+    private:
+        std::mt19937 engine;
+        uint32_t seed;
+        uint64_t draws;
+
+    public:
+        using result_type = std::mt19937::result_type;
+
+        static constexpr result_type min()
+        {
+            return std::mt19937::min();
+        }
+
+        static constexpr result_type max()
+        {
+            return std::mt19937::max();
+        }
+
+        GameRandom(uint32_t seed)
+            : engine(seed)
+        {
+            this->seed = seed;
+            this->draws = 0;
+        }
+
+        /**
+         * Generator in the state after the given number of draws from the seed.
+         * Games draw a few numbers per round, so skipping them costs next to nothing.
+         */
+        static GameRandom restore(uint32_t seed, uint64_t draws)
+        {
+            GameRandom random(seed);
+            random.engine.discard(draws);
+            random.draws = draws;
+            return random;
+        }
+
+        result_type operator()()
+        {
+            this->draws++;
+            return this->engine();
+        }
+
+        uint32_t getSeed()
+        {
+            return this->seed;
+        }
+
+        uint64_t getDraws()
+        {
+            return this->draws;
+        }
+};
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef MEMORY_ACCOUNTING_HPP
+#define MEMORY_ACCOUNTING_HPP
+#include "SessionMemoryPool.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Parts of the game, whose heap memory is accounted separately.
+ */
+enum MemorySubsystem : int
+{
+    mushroomMemory,
+    centipedeMemory,
+    bulletMemory,
+    renderMemory,
+    inputMemory,
+    recordingMemory,
+    memorySubsystemCount
+};
+
+inline std::vector<std::string> getMemorySubsystemNames()
+{
+    return { "mushroom map", "centipedes", "bullets", "render", "input", "recording" };
+}
+
+/**
+ * Counters of one subsystem, shared by all threads and sessions of the process.
+ */
+class MemoryCounters
+{
+    public:
+        std::atomic<int64_t> liveBytes{0};
+        std::atomic<int64_t> peakBytes{0};
+        std::atomic<int64_t> liveAllocations{0};
+        std::atomic<int64_t> totalAllocations{0};
+};
+
+/**
+ * Live bytes and allocations of every subsystem, fed by the AccountedAllocator.
+ */
+class MemoryAccount
+{
+    private:
+        static MemoryCounters &getCounters(MemorySubsystem subsystem)
+        {
+            static MemoryCounters counters[MemorySubsystem::memorySubsystemCount];
+            return counters[subsystem];
+        }
+
+    public:
+        static void recordAllocation(MemorySubsystem subsystem, size_t bytes)
+        {
+            auto &counters = getCounters(subsystem);
+            auto liveBytes = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + (int64_t) bytes;
+            auto peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+            while(liveBytes > peakBytes && !counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+            {
+            }
+            counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void recordDeallocation(MemorySubsystem subsystem, size_t bytes)
+        {
+            auto &counters = getCounters(subsystem);
+            counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        static int64_t getLiveBytes(MemorySubsystem subsystem)
+        {
+            return getCounters(subsystem).liveBytes.load(std::memory_order_relaxed);
+        }
+
+        static int64_t getPeakBytes(MemorySubsystem subsystem)
+        {
+            return getCounters(subsystem).peakBytes.load(std::memory_order_relaxed);
+        }
+
+        static int64_t getLiveAllocations(MemorySubsystem subsystem)
+        {
+            return getCounters(subsystem).liveAllocations.load(std::memory_order_relaxed);
+        }
+
+        static int64_t getTotalAllocations(MemorySubsystem subsystem)
+        {
+            return getCounters(subsystem).totalAllocations.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Table with the live and peak bytes and the allocations of every subsystem.
+         */
+        static std::string report()
+        {
+            auto names = getMemorySubsystemNames();
+            std::ostringstream text;
+            text << std::left << std::setw(16) << "subsystem" << std::right << std::setw(14) << "live bytes"
+                 << std::setw(14) << "peak bytes" << std::setw(14) << "live allocs" << std::setw(14) << "total allocs" << "\n";
+            int64_t liveBytes = 0;
+            for(int subsystem = 0; subsystem < MemorySubsystem::memorySubsystemCount; subsystem++)
+            {
+                auto accounted = (MemorySubsystem) subsystem;
+                liveBytes += getLiveBytes(accounted);
+                text << std::left << std::setw(16) << names[subsystem] << std::right
+                     << std::setw(14) << getLiveBytes(accounted) << std::setw(14) << getPeakBytes(accounted)
+                     << std::setw(14) << getLiveAllocations(accounted) << std::setw(14) << getTotalAllocations(accounted) << "\n";
+            }
+            text << std::left << std::setw(16) << "total" << std::right << std::setw(14) << liveBytes << "\n";
+            return text.str();
+        }
+};
+
+/**
+ * Allocator for the containers of a subsystem, accounts every allocation.
+ * Allocates from the SessionMemoryPool of the session running on the thread, if there is one, else from the global heap.
+ */
+template <typename TValue, MemorySubsystem subsystem>
+class AccountedAllocator
+{
+    static_assert(alignof(TValue) <= alignof(std::max_align_t), "Blocks are aligned like the global heap.");
+
+    public:
+        using value_type = TValue;
+
+        template <typename TOther>
+        struct rebind
+        {
+            using other = AccountedAllocator<TOther, subsystem>;
+        };
+
+        AccountedAllocator() noexcept
+        {
+        }
+
+        template <typename TOther>
+        AccountedAllocator(const AccountedAllocator<TOther, subsystem>&) noexcept
+        {
+        }
+
+        TValue *allocate(size_t count)
+        {
+            auto memory = static_cast<TValue*>(SessionMemoryPool::allocate(count * sizeof(TValue)));
+            MemoryAccount::recordAllocation(subsystem, count * sizeof(TValue));
+            return memory;
+        }
+
+        void deallocate(TValue *memory, size_t count) noexcept
+        {
+            MemoryAccount::recordDeallocation(subsystem, count * sizeof(TValue));
+            SessionMemoryPool::deallocate(memory);
+        }
+
+        template <typename TOther>
+        bool operator==(const AccountedAllocator<TOther, subsystem>&) const noexcept
+        {
+            return true;
+        }
+
+        template <typename TOther>
+        bool operator!=(const AccountedAllocator<TOther, subsystem>&) const noexcept
+        {
+            return false;
+        }
+};
+
+/**
+ * Vector and string, whose memory is accounted to the given subsystem.
+ */
+template <typename TValue, MemorySubsystem subsystem>
+using AccountedVector = std::vector<TValue, AccountedAllocator<TValue, subsystem>>;
+
+template <MemorySubsystem subsystem>
+using AccountedString = std::basic_string<char, std::char_traits<char>, AccountedAllocator<char, subsystem>>;
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef SESSION_MEMORY_POOL_HPP
+#define SESSION_MEMORY_POOL_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+/**
+ * Pool of the memory of one game session, e.g. its game objects and rendered frames.
+ * Blocks are carved from big chunks and recycled in free lists of their size class, without any lock:
+ * a pool is installed on one thread at a time, the one running the session.
+ * Blocks freed by other threads, e.g. by the autosave, are handed back through a lock-free list.
+ * When the session ends, all chunks are released at once with the last block, that is still in use.
+ */
+class SessionMemoryPool
+{
+    private:
+        // In front of every block: the pool it belongs to, nullptr for the global heap.
+        struct alignas(16) BlockHeader
+        {
+            SessionMemoryPool *pool;
+            uint32_t sizeClass;
+        };
+
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        static constexpr size_t headerSize = sizeof(BlockHeader);
+        static constexpr size_t classGranularity = 16;
+        static constexpr int sizeClasses = 64;
+        // Bigger blocks come from the global heap, they are rare and would waste space in the chunks.
+        static constexpr size_t maxBlockSize = sizeClasses * classGranularity;
+        static constexpr size_t chunkSize = 64 * 1024;
+
+        FreeBlock *freeLists[sizeClasses];
+        std::atomic<FreeBlock*> remoteFrees;
+        std::vector<char*> chunks;
+        char *chunkCursor;
+        char *chunkEnd;
+        // Blocks in use plus one reference of the session, the pool deletes itself when it drops to 0.
+        std::atomic<int64_t> references;
+
+        static SessionMemoryPool *&getCurrentOnThread()
+        {
+            thread_local SessionMemoryPool *current = nullptr;
+            return current;
+        }
+
+        static BlockHeader *getHeader(void *memory)
+        {
+            return reinterpret_cast<BlockHeader*>(static_cast<char*>(memory) - headerSize);
+        }
+
+        SessionMemoryPool()
+        {
+            for(int sizeClass = 0; sizeClass < sizeClasses; sizeClass++)
+            {
+                this->freeLists[sizeClass] = nullptr;
+            }
+            this->remoteFrees.store(nullptr, std::memory_order_relaxed);
+            this->chunkCursor = nullptr;
+            this->chunkEnd = nullptr;
+            this->references.store(1, std::memory_order_relaxed);
+        }
+
+        ~SessionMemoryPool()
+        {
+            for(auto chunk : this->chunks)
+            {
+                ::operator delete(chunk);
+            }
+        }
+
+        void dropReference()
+        {
+            if(this->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete this;
+            }
+        }
+
+        /**
+         * Moves the blocks freed by other threads into the free lists.
+         */
+        void takeRemoteFrees()
+        {
+            auto block = this->remoteFrees.exchange(nullptr, std::memory_order_acquire);
+            while(block != nullptr)
+            {
+                auto next = block->next;
+                auto sizeClass = getHeader(block)->sizeClass;
+                block->next = this->freeLists[sizeClass];
+                this->freeLists[sizeClass] = block;
+                block = next;
+            }
+        }
+
+        void *carveBlock(uint32_t sizeClass)
+        {
+            auto blockSize = headerSize + (sizeClass + 1) * classGranularity;
+            if(this->chunkCursor == nullptr || this->chunkCursor + blockSize > this->chunkEnd)
+            {
+                auto chunk = static_cast<char*>(::operator new(chunkSize));
+                this->chunks.push_back(chunk);
+                this->chunkCursor = chunk;
+                this->chunkEnd = chunk + chunkSize;
+            }
+            auto header = reinterpret_cast<BlockHeader*>(this->chunkCursor);
+            this->chunkCursor += blockSize;
+            header->pool = this;
+            header->sizeClass = sizeClass;
+            return reinterpret_cast<char*>(header) + headerSize;
+        }
+
+        void *allocateBlock(size_t bytes)
+        {
+            auto sizeClass = (uint32_t) ((bytes + classGranularity - 1) / classGranularity) - 1;
+            if(this->freeLists[sizeClass] == nullptr)
+            {
+                this->takeRemoteFrees();
+            }
+            this->references.fetch_add(1, std::memory_order_relaxed);
+            auto block = this->freeLists[sizeClass];
+            if(block == nullptr)
+            {
+                return this->carveBlock(sizeClass);
+            }
+            this->freeLists[sizeClass] = block->next;
+            return block;
+        }
+
+        void deallocateBlock(void *memory)
+        {
+            auto block = static_cast<FreeBlock*>(memory);
+            if(getCurrentOnThread() == this)
+            {
+                auto sizeClass = getHeader(memory)->sizeClass;
+                block->next = this->freeLists[sizeClass];
+                this->freeLists[sizeClass] = block;
+            }
+            else
+            {
+                block->next = this->remoteFrees.load(std::memory_order_relaxed);
+                while(!this->remoteFrees.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+            this->dropReference();
+        }
+
+        friend class SessionMemory;
+        friend class SessionMemoryScope;
+
+    public:
+        SessionMemoryPool(const SessionMemoryPool&) = delete;
+        SessionMemoryPool &operator=(const SessionMemoryPool&) = delete;
+
+        /**
+         * Allocates from the pool installed on this thread, from the global heap if there is none.
+         */
+        static void *allocate(size_t bytes)
+        {
+            auto pool = getCurrentOnThread();
+            if(pool != nullptr && bytes > 0 && bytes <= maxBlockSize)
+            {
+                return pool->allocateBlock(bytes);
+            }
+            auto header = static_cast<BlockHeader*>(::operator new(headerSize + bytes));
+            header->pool = nullptr;
+            return reinterpret_cast<char*>(header) + headerSize;
+        }
+
+        /**
+         * Gives the memory back to where it came from, on any thread.
+         */
+        static void deallocate(void *memory)
+        {
+            auto header = getHeader(memory);
+            if(header->pool == nullptr)
+            {
+                ::operator delete(header);
+                return;
+            }
+            header->pool->deallocateBlock(memory);
+        }
+
+        /**
+         * Pool installed on the calling thread, nullptr if it allocates from the global heap.
+         */
+        static SessionMemoryPool *getCurrent()
+        {
+            return getCurrentOnThread();
+        }
+
+        /**
+         * Bytes of the chunks, that the pool got from the global heap so far.
+         */
+        size_t getChunkBytes()
+        {
+            return this->chunks.size() * chunkSize;
+        }
+};
+
+/**
+ * Memory of one session, owned by whoever hosts it. Ending the session releases the pool:
+ * right away if nothing of the session is left, else with the last block freed, e.g. of an autosave still being written.
+ */
+class SessionMemory
+{
+    private:
+        SessionMemoryPool *pool;
+
+    public:
+        SessionMemory()
+        {
+            this->pool = new SessionMemoryPool();
+        }
+
+        ~SessionMemory()
+        {
+            this->pool->dropReference();
+        }
+
+        SessionMemory(const SessionMemory&) = delete;
+        SessionMemory &operator=(const SessionMemory&) = delete;
+
+        SessionMemoryPool &getPool()
+        {
+            return *(this->pool);
+        }
+};
+
+/**
+ * Lets the calling thread allocate from the memory of the session, until the scope is left.
+ * Scopes can be nested, e.g. a worker running one session after another.
+ */
+class SessionMemoryScope
+{
+    private:
+        SessionMemoryPool *previous;
+
+    public:
+        SessionMemoryScope(SessionMemory &memory)
+        {
+            this->previous = SessionMemoryPool::getCurrentOnThread();
+            SessionMemoryPool::getCurrentOnThread() = &memory.getPool();
+        }
+
+        ~SessionMemoryScope()
+        {
+            SessionMemoryPool::getCurrentOnThread() = this->previous;
+        }
+
+        SessionMemoryScope(const SessionMemoryScope&) = delete;
+        SessionMemoryScope &operator=(const SessionMemoryScope&) = delete;
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef THREAD_ROLE_HPP
+#define THREAD_ROLE_HPP
+#include <string>
+#include <vector>
+
+/**
+ * Threads of the game, each with its own placement in the settings.
+ */
+enum ThreadRole : int
+{
+    gameThread,
+    clockThread,
+    inputThread,
+    autosaveThread,
+    pregenerationThread,
+    threadRoleCount
+};
+
+inline std::vector<std::string> getThreadRoleNames()
+{
+    return { "game", "clock", "input", "autosave", "pregen" };
+}
+
+#endif
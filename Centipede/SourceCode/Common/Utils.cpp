@@ -0,0 +1,33 @@
+#include "Utils.hpp"
+
+bool lineOutOfBounds(int line, std::shared_ptr<CentipedeSettings> settings_ptr)
+{
+    if(line < 0) return true;
+    if(line >= settings_ptr->getPlayingFieldHeight()) return true;
+    return false;
+}
+
+bool columnOutOfBounds(int column, std::shared_ptr<CentipedeSettings> settings_ptr)
+{
+    if(column < 0) return true;
+    if(column >= settings_ptr->getPlayingFieldWidth()) return true;
+    return false;
+}
+
+bool rollRandomWithChance(int dividend, int divisor)
+{
+    auto random = GetRandomNumberBetween(1, divisor);
+    return random <= dividend;
+}
+
+bool rollRandomWithChance(int dividend, int divisor, std::mt19937 &generator)
+{
+    std::uniform_int_distribution<> distribution(1, divisor);
+    return distribution(generator) <= dividend;
+}
+
+bool rollRandomWithChance(int dividend, int divisor, GameRandom &generator)
+{
+    std::uniform_int_distribution<> distribution(1, divisor);
+    return distribution(generator) <= dividend;
+}
@@ -2,6 +2,7 @@
 #define BULLET_HPP
 #include "Position.hpp"
 #include "../Common/CentipedeSettings.hpp"
+#include "../Common/MemoryAccounting.hpp"
 #include "Position.hpp"
 #include <memory>
 
@@ -38,4 +39,9 @@ class Bullet
         }
 };
 
+/**
+ * The flying bullets of a game, accounted as bullet memory.
+ */
+using BulletVector = AccountedVector<Bullet, MemorySubsystem::bulletMemory>;
+
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef CENTIPEDE_BODY_HPP
 #define CENTIPEDE_BODY_HPP
 #include "CentipedePart.hpp"
+#include "../Common/MemoryAccounting.hpp"
 
 class CentipedeBody : public CentipedePart
 {
@@ -11,20 +12,22 @@ public:
 	{
 	}
 
+	/**
+	 * Creates a body part, whose memory is accounted to the centipedes.
+	 */
+	static std::shared_ptr<CentipedeBody> create(Position position, std::shared_ptr<CentipedeBody> tail_ptr, CentipedeMovingDirection direction)
+	{
+		return std::allocate_shared<CentipedeBody>(AccountedAllocator<CentipedeBody, MemorySubsystem::centipedeMemory>(), position, tail_ptr, direction);
+	}
+
 	// Hier wird bewusst die Position kopiert!!
 	/**
 	 * Sets the position pointer and the moving direction of the centipede body.
 	 */
 	void move(Position position, CentipedeMovingDirection direction)
 	{
-		// Pull tail
-		if(this->tail_ptr != nullptr)
-		{
-			std::reinterpret_pointer_cast<CentipedeBody>(this->tail_ptr)->move(this->position, this->movingDirection);
-		}
-		// Then move to new position
-		this->position = position;
-		this->movingDirection = direction;
+		// Move to the new position and pull the tail.
+		this->follow(position, direction);
 	}
 };
 
@@ -5,7 +5,18 @@
 #include "Position.hpp"
 #include "../Common/Directions.hpp"
 #include "../Common/Utils.hpp"
+#include "../Common/MemoryAccounting.hpp"
+#include <list>
 #include <memory>
+#include <vector>
+
+class CentipedeHead;
+
+/**
+ * Centipedes of the game. Splits append new centipedes without moving the others,
+ * so iterators stay valid as handles while the list changes.
+ */
+using CentipedeList = std::list<CentipedeHead, AccountedAllocator<CentipedeHead, MemorySubsystem::centipedeMemory>>;
 
 class CentipedeHead : public CentipedePart
 {
@@ -27,21 +38,23 @@ class CentipedeHead : public CentipedePart
 			}
 		}
 
-		bool freeOfCentipede(int line, int column, std::vector<CentipedeHead> &centipedeList)
+		bool freeOfCentipede(int line, int column, CentipedeList &centipedeList)
 		{
-			bool noCentipede = true;
-			for(auto centipede : centipedeList)
+			for(auto &centipede : centipedeList)
 			{
 				// no need to filter centipede List for own, since this centipede never wants to go to a location it is already in.
-				noCentipede = noCentipede && !centipede.isAtPosition(line, column);
+				if(centipede.isAtPosition(line, column))
+				{
+					return false;
+				}
 			}
-			return noCentipede;
+			return true;
 		}
 
 		/**
 		* Checks wheter the next position is taken from a mushroom or another centipede.
 		*/
-		bool isValidPosition(int line, int column, MushroomMap& mushroomMap, std::vector<CentipedeHead> &centipedeList)
+		bool isValidPosition(int line, int column, MushroomMap& mushroomMap, CentipedeList &centipedeList)
 		{
 			if(mushroomMap.getMushroom(line, column) != 0)
 			{
@@ -52,7 +65,7 @@ class CentipedeHead : public CentipedePart
 			return this->freeOfCentipede(line, column, centipedeList);
 		}
 
-		bool changeLane(std::vector<CentipedeHead> &centipedeList, std::shared_ptr<CentipedeSettings> settings_ptr)
+		bool changeLane(CentipedeList &centipedeList, std::shared_ptr<CentipedeSettings> settings_ptr)
 		{
 			auto line = this->position.getLine();
 			auto column = this->position.getColumn();
@@ -87,7 +100,7 @@ class CentipedeHead : public CentipedePart
 
 			for (int centipedePartCount = 1; centipedePartCount < bodySize; centipedePartCount++)
 			{
-				tail_ptr = std::make_shared<CentipedeBody>(this->position, tail_ptr, direction);
+				tail_ptr = CentipedeBody::create(this->position, tail_ptr, direction);
 			}
 
 			this->tail_ptr = tail_ptr;
@@ -95,16 +108,37 @@ class CentipedeHead : public CentipedePart
 
 		/**
 		* Constructor for Centipede part after hit with bullet.
+		* The first part of the split of tail becomes the head, the parts behind it are taken over without copying.
 		*/
-		CentipedeHead(std::shared_ptr<CentipedeBody> splitOfTail_ptr)
+		CentipedeHead(std::shared_ptr<CentipedePart> splitOfTail_ptr)
 			: CentipedePart(splitOfTail_ptr->getPosition(), splitOfTail_ptr->getMovingDirection(), splitOfTail_ptr->getTail())
 		{
 		}
 
+		/**
+		* Copies the centipede including its entire tail, the copy shares no body part with this one.
+		*/
+		CentipedeHead clone()
+		{
+			std::vector<std::shared_ptr<CentipedePart>> parts;
+			for(auto tail_ptr = this->tail_ptr; tail_ptr != nullptr; tail_ptr = tail_ptr->getTail())
+			{
+				parts.push_back(tail_ptr);
+			}
+			std::shared_ptr<CentipedeBody> tail_ptr = nullptr;
+			for(auto part = parts.rbegin(); part != parts.rend(); part++)
+			{
+				tail_ptr = CentipedeBody::create((*part)->getPosition(), tail_ptr, (*part)->getMovingDirection());
+			}
+			CentipedeHead copy(*this);
+			copy.tail_ptr = tail_ptr;
+			return copy;
+		}
+
 		/**
 		* Checks wheter the centipede head meets a mushroom.
 		*/
-		bool move(MushroomMap &mushroomMap, std::vector<CentipedeHead> &centipedeList, std::shared_ptr<CentipedeSettings> settings_ptr)
+		bool move(MushroomMap &mushroomMap, CentipedeList &centipedeList, std::shared_ptr<CentipedeSettings> settings_ptr)
 		{
 			int line = this->position.getLine();
 			int column = this->position.getColumn();
@@ -139,7 +173,7 @@ class CentipedeHead : public CentipedePart
 
 			// Pull tail if moved.
 			if(moved && this->tail_ptr != nullptr){
-				std::reinterpret_pointer_cast<CentipedeBody>(this->tail_ptr)->move(savedPosition, savedMovingDirection);
+				this->tail_ptr->follow(savedPosition, savedMovingDirection);
 			}
 
 			return moved;
@@ -7,6 +7,7 @@
 #include "MushroomMap.hpp"
 #include "../Common/Tuple.hpp"
 #include <memory>
+#include <utility>
 
 enum CentipedeHit : int 
 {
@@ -39,36 +40,32 @@ class CentipedePart
 		*/
 		bool isAtPosition(Position &position)
 		{
-			bool directHit = this->position.equals(position);
-			if(this->tail_ptr == nullptr)
-			{
-				return directHit;
-			}
-			// Has Tail
-			return directHit || this->tail_ptr->isAtPosition(position);
+			return this->isAtPosition(position.getLine(), position.getColumn());
 		}
 
 		/**
-		* Checks wheter the CentipedePart has the same position like the Starship.
+		* Checks wheter the CentipedePart or any part of its tail is at the given position.
 		*/
 		bool isAtPosition(int line, int column)
 		{
-			bool directHit = this->position.equals(line, column);
-			if(this->tail_ptr == nullptr)
+			for(CentipedePart *part = this; part != nullptr; part = part->tail_ptr.get())
 			{
-				return directHit;
+				if(part->position.equals(line, column))
+				{
+					return true;
+				}
 			}
-			// Has Tail
-			return directHit || this->tail_ptr->isAtPosition(line, column);
+			return false;
 		}
 
 		/**
 		* Gives back the hit type with the Bullet and nullptr or the split of tail. Direct hit -> this CentipedePart got hit, tail hit -> a CentipedePart of the tail got hit.
+		* The hit part is dropped, the parts behind it are handed over as they are: splitting never copies a part.
 		*/
 		Tuple<CentipedeHit, std::shared_ptr<CentipedePart>> collide(Bullet &bullet, std::shared_ptr<MushroomMap> mushroomMap)
 		{
-			auto hit = bullet.getPosition().equals(this->position);
-			if(hit)
+			auto bulletPosition = bullet.getPosition();
+			if(bulletPosition.equals(this->position))
 			{
 				// Direct hit on this part of the centipede.
 				// Tail needs to become new Centipede in list.
@@ -80,24 +77,36 @@ class CentipedePart
 				return result;
 			}
 
-			// No direct hit -> check on tail.
-			if(this->tail_ptr == nullptr)
+			// No direct hit -> walk along the tail.
+			for(CentipedePart *part = this; part->tail_ptr != nullptr; part = part->tail_ptr.get())
 			{
-				// No more tail to check on -> no place to hit.
-				Tuple<CentipedeHit, std::shared_ptr<CentipedePart>> result(CentipedeHit::noHit, nullptr);
+				auto hitPart_ptr = part->tail_ptr;
+				if(!bulletPosition.equals(hitPart_ptr->position))
+				{
+					continue;
+				}
+				mushroomMap->spawnMushroom(hitPart_ptr->position.getLine(), hitPart_ptr->position.getColumn());
+				// This part is now end of the centipede.
+				part->tail_ptr = nullptr;
+				Tuple result(CentipedeHit::tailHit, hitPart_ptr->tail_ptr);
 				return result;
 			}
 
-			auto tailResult = this->tail_ptr->collide(bullet, mushroomMap);
-			if(tailResult.getItem1() == CentipedeHit::noHit || tailResult.getItem1() == CentipedeHit::tailHit)
+			// No more tail to check on -> no place to hit.
+			Tuple<CentipedeHit, std::shared_ptr<CentipedePart>> result(CentipedeHit::noHit, nullptr);
+			return result;
+		}
+
+		/**
+		* Moves this part to the given place and every part of the tail to the place of the part in front of it.
+		*/
+		void follow(Position position, CentipedeMovingDirection direction)
+		{
+			for(CentipedePart *part = this; part != nullptr; part = part->tail_ptr.get())
 			{
-				return tailResult;
+				std::swap(part->position, position);
+				std::swap(part->movingDirection, direction);
 			}
-			// tailResult == CentipedeHit::directHit:
-			// This part is now end of the centipede.
-			this->tail_ptr = nullptr;
-			Tuple result(CentipedeHit::tailHit, tailResult.getItem2());
-			return result;
 		}
 
 		/**
@@ -0,0 +1,260 @@
+#ifndef MUSHROOM_FIELD_GENERATOR_HPP
+#define MUSHROOM_FIELD_GENERATOR_HPP
+#include "../Common/CentipedeSettings.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define MUSHROOM_FIELD_GENERATOR_X86
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define MUSHROOM_FIELD_GENERATOR_NEON
+#endif
+
+/**
+ * Fills the initial mushroom field a whole row at a time.
+ * Every cell gets its own random word from a counter based hash of seed, line and column.
+ * - A mushroom spawns, if the word is below the threshold of the spawn chance.
+ * - Its initial damage is scaled from a second word of the same cell.
+ * As no cell depends on another, rows are filled 8 cells at once (AVX2 or NEON)
+ * and huge fields in parallel bands of rows, always with the same field for the same seed.
+ */
+class MushroomFieldGenerator
+{
+	private:
+		static constexpr uint32_t columnStep = 0x9E3779B9;
+		static constexpr uint32_t lineStep = 0x85EBCA6B;
+		static constexpr uint32_t damageSalt = 0x6A09E667;
+		// Fields with fewer cells are filled by the calling thread, starting threads would take longer.
+		static constexpr long parallelCells = 1 << 18;
+		static constexpr int minBandLines = 64;
+
+		uint32_t seedKey;
+		int width;
+		int spawnLines;
+		// Spawn if the upper 31 bits of the word are below, or always.
+		uint32_t spawnThreshold;
+		bool alwaysSpawn;
+		int32_t health;
+		bool useAvx2;
+
+		static uint32_t mix(uint32_t value)
+		{
+			value ^= value >> 16;
+			value *= 0x7FEB352D;
+			value ^= value >> 15;
+			value *= 0x846CA68B;
+			value ^= value >> 16;
+			return value;
+		}
+
+		uint32_t getLineKey(int line)
+		{
+			return mix(this->seedKey + (uint32_t) line * lineStep);
+		}
+
+		void generateRowScalar(uint32_t lineKey, int fromColumn, int8_t *row)
+		{
+			for(int column = fromColumn; column < this->width; column++)
+			{
+				auto word = mix(lineKey + (uint32_t) column * columnStep);
+				auto spawn = this->alwaysSpawn || (word >> 1) < this->spawnThreshold;
+				auto damage = (int32_t) (((mix(word + damageSalt) >> 16) * (uint32_t) this->health) >> 16);
+				row[column] = spawn ? this->health - damage : 0;
+			}
+		}
+
+#ifdef MUSHROOM_FIELD_GENERATOR_X86
+		__attribute__((target("avx2")))
+		static __m256i mixAvx2(__m256i value)
+		{
+			value = _mm256_xor_si256(value, _mm256_srli_epi32(value, 16));
+			value = _mm256_mullo_epi32(value, _mm256_set1_epi32(0x7FEB352D));
+			value = _mm256_xor_si256(value, _mm256_srli_epi32(value, 15));
+			value = _mm256_mullo_epi32(value, _mm256_set1_epi32((int32_t) 0x846CA68B));
+			value = _mm256_xor_si256(value, _mm256_srli_epi32(value, 16));
+			return value;
+		}
+
+		__attribute__((target("avx2")))
+		void generateRowAvx2(uint32_t lineKey, int8_t *row)
+		{
+			auto columnOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(columnStep));
+			auto eightColumns = _mm256_set1_epi32(8 * columnStep);
+			// Below 2^31 unless always spawning, like the shifted words -> signed compare.
+			auto threshold = _mm256_set1_epi32((int32_t) this->spawnThreshold);
+			auto always = _mm256_set1_epi32(this->alwaysSpawn ? -1 : 0);
+			auto health = _mm256_set1_epi32(this->health);
+			auto salt = _mm256_set1_epi32((int32_t) damageSalt);
+			// Byte 0 of every 32 bit cell, first to the bottom of each lane, then both lanes next to each other.
+			auto lowBytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			                                 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+			auto joinLanes = _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1);
+
+			auto counters = _mm256_add_epi32(_mm256_set1_epi32((int32_t) lineKey), columnOffsets);
+			int column = 0;
+			for(; column + 8 <= this->width; column += 8)
+			{
+				auto words = mixAvx2(counters);
+				auto spawn = _mm256_or_si256(always, _mm256_cmpgt_epi32(threshold, _mm256_srli_epi32(words, 1)));
+				auto damage = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(mixAvx2(_mm256_add_epi32(words, salt)), 16), health), 16);
+				auto cells = _mm256_and_si256(spawn, _mm256_sub_epi32(health, damage));
+				auto bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(cells, lowBytes), joinLanes);
+				_mm_storel_epi64((__m128i*) (row + column), _mm256_castsi256_si128(bytes));
+				counters = _mm256_add_epi32(counters, eightColumns);
+			}
+			this->generateRowScalar(lineKey, column, row);
+		}
+#endif
+
+#ifdef MUSHROOM_FIELD_GENERATOR_NEON
+		static uint32x4_t mixNeon(uint32x4_t value)
+		{
+			value = veorq_u32(value, vshrq_n_u32(value, 16));
+			value = vmulq_n_u32(value, 0x7FEB352D);
+			value = veorq_u32(value, vshrq_n_u32(value, 15));
+			value = vmulq_n_u32(value, 0x846CA68B);
+			value = veorq_u32(value, vshrq_n_u32(value, 16));
+			return value;
+		}
+
+		uint32x4_t generateCellsNeon(uint32x4_t counters)
+		{
+			auto words = mixNeon(counters);
+			auto spawn = vorrq_u32(vdupq_n_u32(this->alwaysSpawn ? 0xFFFFFFFF : 0),
+			                       vcltq_u32(vshrq_n_u32(words, 1), vdupq_n_u32(this->spawnThreshold)));
+			auto damage = vshrq_n_u32(vmulq_n_u32(vshrq_n_u32(mixNeon(vaddq_u32(words, vdupq_n_u32(damageSalt))), 16), this->health), 16);
+			return vandq_u32(spawn, vsubq_u32(vdupq_n_u32(this->health), damage));
+		}
+
+		void generateRowNeon(uint32_t lineKey, int8_t *row)
+		{
+			const uint32_t offsets[4] = { 0, columnStep, 2 * columnStep, 3 * columnStep };
+			auto counters = vaddq_u32(vdupq_n_u32(lineKey), vld1q_u32(offsets));
+			auto fourColumns = vdupq_n_u32(4 * columnStep);
+			int column = 0;
+			for(; column + 8 <= this->width; column += 8)
+			{
+				auto low = this->generateCellsNeon(counters);
+				counters = vaddq_u32(counters, fourColumns);
+				auto high = this->generateCellsNeon(counters);
+				counters = vaddq_u32(counters, fourColumns);
+				auto halves = vcombine_u16(vmovn_u32(low), vmovn_u32(high));
+				vst1_s8(row + column, vreinterpret_s8_u8(vmovn_u16(halves)));
+			}
+			this->generateRowScalar(lineKey, column, row);
+		}
+#endif
+
+	public:
+		/**
+		 * Generator for the given field dimensions, spawning with the chance dividend/divisor.
+		 */
+		MushroomFieldGenerator(unsigned int seed, int width, int spawnLines, int dividend, int divisor, int health)
+		{
+			auto chanceDividend = (uint64_t) std::max(dividend, 0);
+			auto chanceDivisor = (uint64_t) std::max(divisor, 1);
+			this->seedKey = mix(seed);
+			this->width = width;
+			this->spawnLines = spawnLines;
+			this->alwaysSpawn = chanceDividend >= chanceDivisor;
+			this->spawnThreshold = this->alwaysSpawn ? 0 : (uint32_t) ((chanceDividend << 31) / chanceDivisor);
+			this->health = health;
+			this->useAvx2 = false;
+#ifdef MUSHROOM_FIELD_GENERATOR_X86
+			this->useAvx2 = __builtin_cpu_supports("avx2");
+#endif
+		}
+
+		/**
+		 * Generator for the initial field of the settings: only above the starship, but never below the field.
+		 */
+		MushroomFieldGenerator(std::shared_ptr<CentipedeSettings> settings_ptr, unsigned int seed)
+			: MushroomFieldGenerator(seed,
+			                         settings_ptr->getPlayingFieldWidth(),
+			                         std::max(0, std::min(settings_ptr->getInitialStarshipLine(), settings_ptr->getPlayingFieldHeight())),
+			                         settings_ptr->getInitialMushroomSpawnChanceDividend(),
+			                         settings_ptr->getInitialMushroomSpawnChanceDivisor(),
+			                         settings_ptr->getInitialMushroomHealth())
+		{
+		}
+
+		/**
+		 * Number of lines from the top, that get mushrooms.
+		 */
+		int getSpawnLines()
+		{
+			return this->spawnLines;
+		}
+
+		/**
+		 * Writes the mushroom health of every column of the line into the row, 0 where there is none.
+		 * Vectorized unless scalar is requested, both give the same row.
+		 */
+		void generateRow(int line, int8_t *row, bool scalar = false)
+		{
+			auto lineKey = this->getLineKey(line);
+#if defined(MUSHROOM_FIELD_GENERATOR_X86)
+			if(this->useAvx2 && !scalar)
+			{
+				this->generateRowAvx2(lineKey, row);
+				return;
+			}
+#elif defined(MUSHROOM_FIELD_GENERATOR_NEON)
+			if(!scalar)
+			{
+				this->generateRowNeon(lineKey, row);
+				return;
+			}
+#endif
+			this->generateRowScalar(lineKey, 0, row);
+		}
+
+		/**
+		 * Fills the spawn lines of the rows, e.g. the lines of a MushroomMap.
+		 * Huge fields are split into bands of lines, each generated by its own thread.
+		 * Up to the given number of threads, 0 for one per hardware thread.
+		 */
+		template <typename TRows>
+		void generate(TRows &rows, int threads = 0)
+		{
+			auto fillBand = [this, &rows](int fromLine, int toLine)
+			{
+				for(int line = fromLine; line < toLine; line++)
+				{
+					this->generateRow(line, rows[line].data());
+				}
+			};
+
+			if((long) this->spawnLines * this->width < parallelCells)
+			{
+				fillBand(0, this->spawnLines);
+				return;
+			}
+			// Asking for the hardware threads reads the system configuration, only worth it for huge fields.
+			threads = threads > 0 ? threads : (int) std::thread::hardware_concurrency();
+			auto bands = std::min(std::max(threads, 1), std::max(this->spawnLines / minBandLines, 1));
+			if(bands < 2)
+			{
+				fillBand(0, this->spawnLines);
+				return;
+			}
+			std::vector<std::thread> workers;
+			auto linesPerBand = (this->spawnLines + bands - 1) / bands;
+			for(int band = 1; band < bands; band++)
+			{
+				workers.emplace_back(fillBand, band * linesPerBand, std::min((band + 1) * linesPerBand, this->spawnLines));
+			}
+			fillBand(0, std::min(linesPerBand, this->spawnLines));
+			for(auto &worker : workers)
+			{
+				worker.join();
+			}
+		}
+};
+
+#endif
@@ -1,9 +1,11 @@
 #ifndef MUSHROOM_MAP_HPP
 #define MUSHROOM_MAP_HPP
 #include "Bullet.hpp"
-#include "../../lib/CppRandom.hpp"
+#include "MushroomFieldGenerator.hpp"
 #include "../Common/CentipedeSettings.hpp"
+#include "../Common/MemoryAccounting.hpp"
 #include "../Common/Utils.hpp"
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <iostream>
@@ -18,7 +20,7 @@ class MushroomMap
          * smaller 0 - undefined.
          * access by mushroomMap[line][column].
          */
-        std::vector<std::vector<int8_t>> mushroomMap;
+        AccountedVector<AccountedVector<int8_t, MemorySubsystem::mushroomMemory>, MemorySubsystem::mushroomMemory> mushroomMap;
         std::shared_ptr<CentipedeSettings> settings_ptr;
 
         bool isOutOfBounds(int line, int column)
@@ -27,51 +29,23 @@ class MushroomMap
                 || columnOutOfBounds(column, this->settings_ptr);
         }
 
-        /**
-         * Spawns random mushrooms above the initial starship position.
-         */
-        void spawnRandomMushrooms()
-        {
-            auto dividend = this->settings_ptr->getInitialMushroomSpawnChanceDividend();
-            auto divisor = this->settings_ptr->getInitialMushroomSpawnChanceDivisor();
-            auto starshipSpawnLine = this->settings_ptr->getInitialStarshipLine();
-
-            for(int line = 0; line < starshipSpawnLine; line++)
-            {
-                for(int column = 0; column < this->settings_ptr->getPlayingFieldWidth(); column++)
-                {
-                    auto spawnMushroom = rollRandomWithChance(dividend, divisor);
-                    if(spawnMushroom)
-                    {
-                        this->spawnMushroom(line, column);
-                        auto initialDamage = GetRandomNumberBetween(0, this->settings_ptr->getInitialMushroomHealth() - 1);
-                        this->mushroomMap[line][column] -= initialDamage;
-                    }
-                }
-            }
-        }
-
     public:
         /**
          * Initialized map in fieldsize.
+         * Random mushrooms are only spawned above the initial starship position if requested, a restored map starts empty instead.
+         * The same seed always spawns the same mushrooms.
          */
-        MushroomMap(std::shared_ptr<CentipedeSettings> settings_ptr)
+        MushroomMap(std::shared_ptr<CentipedeSettings> settings_ptr, bool spawnRandomMushrooms = true, unsigned int seed = 0)
         {
-            // Initialize two dimensional array.
-            // first make a line with n columns.
-            std::vector<int8_t> line;
-            for(int j = 0; j < settings_ptr->getPlayingFieldWidth(); j++){
-                line.push_back(0);
-            }
-
-            // then copy and add m times to initialize mushroomMap.
-            for(int i = 0; i < settings_ptr->getPlayingFieldHeight(); i++){
-                std::vector<int8_t> lineCopy(line);
-                this->mushroomMap.push_back(lineCopy);
-            }
+            AccountedVector<int8_t, MemorySubsystem::mushroomMemory> line(settings_ptr->getPlayingFieldWidth(), 0);
+            this->mushroomMap.assign(settings_ptr->getPlayingFieldHeight(), line);
 
             this->settings_ptr = settings_ptr;
-            this->spawnRandomMushrooms();
+            if(spawnRandomMushrooms)
+            {
+                MushroomFieldGenerator generator(settings_ptr, seed);
+                generator.generate(this->mushroomMap);
+            }
         }
 
         /**
@@ -99,6 +73,18 @@ class MushroomMap
             this->mushroomMap[line][column] = this->settings_ptr->getInitialMushroomHealth();
         }
 
+        /**
+         * Sets the remaining health of the mushroom at the given coordinates, 0 removes it.
+         */
+        void setMushroom(int line, int column, int health)
+        {
+            if(isOutOfBounds(line, column))
+            {
+                return;
+            }
+            this->mushroomMap[line][column] = health;
+        }
+
         /**
          * checks wheather the current position of the bullet is a collision with a mushroom.
          * If so, it reduces the mushroom's health by one and returns true.
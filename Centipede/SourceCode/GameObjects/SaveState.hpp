@@ -2,8 +2,11 @@
 #define SAFE_STATE_HPP
 
 #include <memory>
+#include <random>
 #include <vector>
 #include "../Common/CentipedeSettings.hpp"
+#include "../Common/CentipedeSpeed.hpp"
+#include "../Common/GameRandom.hpp"
 #include "Bullet.hpp"
 #include "Starship.hpp"
 #include "MushroomMap.hpp"
@@ -14,36 +17,58 @@ class SaveState
 	private:
 		int gameTick;
 		std::shared_ptr<CentipedeSettings> settings_ptr;
-		std::shared_ptr<std::vector<Bullet>> bullets_ptr;
+		std::shared_ptr<BulletVector> bullets_ptr;
 		std::shared_ptr<Starship> starship_ptr;
+		// Starship of the second player in a lockstep game, nullptr in a single player game.
+		std::shared_ptr<Starship> secondStarship_ptr;
 		std::shared_ptr<MushroomMap> mushroomMap_ptr;
-		std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr;
-        int currentCentipedeModuloGametickSlowdown;
+		std::shared_ptr<CentipedeList> centipedes_ptr;
+		// In 1/centipedeSpeedScale cells per gametick.
+		int currentCentipedeSpeed;
 		int currentRound;
 		int score;
 		int lives;
+		bool diedInRound;
+		// Every random decision during the game is drawn from here, so a game can be replayed from any saved state.
+		GameRandom random;
+
+		std::shared_ptr<Starship> cloneStarship(std::shared_ptr<Starship> starship_ptr)
+		{
+			if(starship_ptr == nullptr)
+			{
+				return nullptr;
+			}
+			auto position = starship_ptr->getPosition();
+			auto copy_ptr = std::make_shared<Starship>(position.getLine(), position.getColumn(), this->settings_ptr);
+			copy_ptr->setNextMoveGameTick(starship_ptr->getNextMoveGameTick());
+			return copy_ptr;
+		}
 
 	public:
 		SaveState(std::shared_ptr<CentipedeSettings> settings_ptr,
-			std::shared_ptr<std::vector<Bullet>> bullets_ptr,
+			std::shared_ptr<BulletVector> bullets_ptr,
 			std::shared_ptr<Starship> starship_ptr,
 			std::shared_ptr<MushroomMap> mushroomMap_ptr,
-			std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr,
-			int currentCentipedeModuloGametickSlowdown,
+			std::shared_ptr<CentipedeList> centipedes_ptr,
+			int currentCentipedeSpeed,
 			int currentRound,
 			int score,
-			int lives)
+			int lives,
+			unsigned int randomSeed)
+			: random(randomSeed)
 		{
 			this->gameTick = 0;
 			this->settings_ptr = settings_ptr;
 			this->bullets_ptr = bullets_ptr;
 			this->starship_ptr = starship_ptr;
+			this->secondStarship_ptr = nullptr;
 			this->mushroomMap_ptr = mushroomMap_ptr;
 			this->centipedes_ptr = centipedes_ptr;
-			this->currentCentipedeModuloGametickSlowdown = currentCentipedeModuloGametickSlowdown;
+			this->currentCentipedeSpeed = currentCentipedeSpeed;
 			this->currentRound = currentRound;
 			this->score = score;
 			this->lives = lives;
+			this->diedInRound = false;
 		}
 
 		std::shared_ptr<CentipedeSettings> getSettings()
@@ -51,7 +76,7 @@ class SaveState
 			return this->settings_ptr;
 		}
 
-		std::shared_ptr<std::vector<Bullet>> getBullets()
+		std::shared_ptr<BulletVector> getBullets()
 		{
 			return this->bullets_ptr;
 		}
@@ -61,12 +86,22 @@ class SaveState
 			return this->starship_ptr;
 		}
 
+		std::shared_ptr<Starship> getSecondStarship()
+		{
+			return this->secondStarship_ptr;
+		}
+
+		void setSecondStarship(std::shared_ptr<Starship> starship_ptr)
+		{
+			this->secondStarship_ptr = starship_ptr;
+		}
+
 		std::shared_ptr<MushroomMap> getMushroomMap()
 		{
 			return this->mushroomMap_ptr;
 		}
 
-		std::shared_ptr<std::vector<CentipedeHead>> getCentipedes()
+		std::shared_ptr<CentipedeList> getCentipedes()
 		{
 			return this->centipedes_ptr;
 		}
@@ -76,6 +111,11 @@ class SaveState
 			return this->gameTick;
 		}
 
+		void setGameTick(int gameTick)
+		{
+			this->gameTick = gameTick;
+		}
+
 		void incrementGameTick()
 		{
 			this->gameTick++;
@@ -86,14 +126,14 @@ class SaveState
 			}
 		}
 
-		int getCurrentCentipedeModuloGametickSlowdown()
+		int getCurrentCentipedeSpeed()
 		{
-			return this->currentCentipedeModuloGametickSlowdown;
+			return this->currentCentipedeSpeed;
 		}
 		
-		void setCurrentCentipedeModuloGametickSlowdown(int slowdown)
+		void setCurrentCentipedeSpeed(int speed)
 		{
-			this->currentCentipedeModuloGametickSlowdown = slowdown;
+			this->currentCentipedeSpeed = speed;
 		}
 
 		int getCurrentRound()
@@ -125,6 +165,87 @@ class SaveState
 		{
 			this->lives--;
 		}
+
+		/**
+		 * Returns true if the starship got hit in the current round, which means no points for the round end.
+		 */
+		bool hasDiedInRound()
+		{
+			return this->diedInRound;
+		}
+
+		void setDiedInRound(bool diedInRound)
+		{
+			this->diedInRound = diedInRound;
+		}
+
+		GameRandom &getRandom()
+		{
+			return this->random;
+		}
+
+		void setRandom(GameRandom random)
+		{
+			this->random = random;
+		}
+
+		/**
+		 * Copies the entire state, so the copy can be used by another thread while the game goes on.
+		 * Only the settings are shared, they never change during a game.
+		 */
+		std::shared_ptr<SaveState> clone()
+		{
+			auto bullets_ptr = std::make_shared<BulletVector>(*(this->bullets_ptr));
+			auto mushroomMap_ptr = std::make_shared<MushroomMap>(*(this->mushroomMap_ptr));
+			auto centipedes_ptr = std::make_shared<CentipedeList>();
+			for(auto &centipede : *(this->centipedes_ptr))
+			{
+				centipedes_ptr->push_back(centipede.clone());
+			}
+			auto copy = std::make_shared<SaveState>(*this);
+			copy->bullets_ptr = bullets_ptr;
+			copy->starship_ptr = this->cloneStarship(this->starship_ptr);
+			copy->secondStarship_ptr = this->cloneStarship(this->secondStarship_ptr);
+			copy->mushroomMap_ptr = mushroomMap_ptr;
+			copy->centipedes_ptr = centipedes_ptr;
+			return copy;
+		}
+
+		/**
+		 * Overwrites this state with the other one, e.g. to take a snapshot or to roll back to one.
+		 * Unlike clone() it reuses the bullets, starships and mushrooms of this state, only the centipedes are copied anew.
+		 */
+		void copyFrom(SaveState &other)
+		{
+			this->gameTick = other.gameTick;
+			this->settings_ptr = other.settings_ptr;
+			*(this->bullets_ptr) = *(other.bullets_ptr);
+			this->starship_ptr->copyFrom(*(other.starship_ptr));
+			if(other.secondStarship_ptr == nullptr)
+			{
+				this->secondStarship_ptr = nullptr;
+			}
+			else if(this->secondStarship_ptr == nullptr)
+			{
+				this->secondStarship_ptr = this->cloneStarship(other.secondStarship_ptr);
+			}
+			else
+			{
+				this->secondStarship_ptr->copyFrom(*(other.secondStarship_ptr));
+			}
+			*(this->mushroomMap_ptr) = *(other.mushroomMap_ptr);
+			this->centipedes_ptr->clear();
+			for(auto &centipede : *(other.centipedes_ptr))
+			{
+				this->centipedes_ptr->push_back(centipede.clone());
+			}
+			this->currentCentipedeSpeed = other.currentCentipedeSpeed;
+			this->currentRound = other.currentRound;
+			this->score = other.score;
+			this->lives = other.lives;
+			this->diedInRound = other.diedInRound;
+			this->random = other.random;
+		}
 };
 
 #endif
\ No newline at end of file
@@ -12,6 +12,8 @@ class Starship
 private:
 	std::unique_ptr<Position> position_ptr;
 	std::shared_ptr<CentipedeSettings> settings_ptr;
+	// First gametick in which the starship may move again with immediate starship input.
+	int nextMoveGameTick;
 
 	/**
 	* Checks whether the next position is accessible for the Starship.
@@ -27,6 +29,7 @@ public:
 	{
 		this->settings_ptr = settings_ptr;
 		this->position_ptr = std::make_unique<Position>(line, column, settings_ptr);
+		this->nextMoveGameTick = 0;
 	}
 
 	/**
@@ -37,6 +40,25 @@ public:
 		return *(this->position_ptr);
 	}
 
+	int getNextMoveGameTick()
+	{
+		return this->nextMoveGameTick;
+	}
+
+	void setNextMoveGameTick(int gameTick)
+	{
+		this->nextMoveGameTick = gameTick;
+	}
+
+	/**
+	* Takes over position and cooldown of the other starship, without allocating.
+	* */
+	void copyFrom(Starship &other)
+	{
+		*(this->position_ptr) = *(other.position_ptr);
+		this->nextMoveGameTick = other.nextMoveGameTick;
+	}
+
 	/**
 	* Checks wheter the required moving direction ist possible.
 	* */
@@ -83,13 +105,13 @@ public:
 	}
 
 	/**
-	* Gives back the pointer of the bullet.
+	* Gives back the bullet, it is stored by value in the bullets of the game.
 	* */
-	std::shared_ptr<Bullet> shoot()
+	Bullet shoot()
 	{
 		int line = this->position_ptr->getLine();
 		int column = this->position_ptr->getColumn();
-		return std::make_shared<Bullet>(line, column, this->settings_ptr);
+		return Bullet(line, column, this->settings_ptr);
 	}
 };
 
@@ -4,11 +4,22 @@
 #include "../Common/Directions.hpp"
 #include "IInputBufferReader.hpp"
 #include "IInputBufferWriter.hpp"
+#include <mutex>
 
+/**
+ * Hands the key presses of the keylistener thread to the game.
+ * Directions are queued, so quick presses of different keys between two starship moves are all applied one after another.
+ */
 class InputBuffer : public IInputBufferReader, public IInputBufferWriter
 {
     private:
-        Direction direction;
+        static constexpr int directionCapacity = 4;
+
+        // Ring buffer of the directions, that weren't read yet.
+        Direction directions[directionCapacity];
+        int firstDirection;
+        int directionCount;
+        std::mutex directionMutex;
         bool shot;
         bool breakoutMenu;
 
@@ -18,20 +29,38 @@ class InputBuffer : public IInputBufferReader, public IInputBufferWriter
          */
         InputBuffer()
         {
-            direction = Direction::none;
+            firstDirection = 0;
+            directionCount = 0;
             shot = false;
             breakoutMenu = false;
         }
 
         /**
-         * sets the direction according to the parameter. Only 'up', 'down', 'left', 'right' are allowed. 'none' will throw an error. 
+         * queues the direction according to the parameter. Only 'up', 'down', 'left', 'right' are allowed. 'none' will throw an error. 
+         * A held key repeats its direction faster than the starship moves, so a direction equal to the last queued one is dropped.
+         * If the queue is full, the newest direction replaces the last queued one.
          */
         void setDirection(Direction direction) override
         {
             if(direction == Direction::none){
                 throw std::logic_error("It is not allowed to set the direction to 'none' manually.");
             }
-            this->direction = direction;
+            std::lock_guard<std::mutex> lock(this->directionMutex);
+            if(this->directionCount > 0)
+            {
+                auto &last = this->directions[(this->firstDirection + this->directionCount - 1) % directionCapacity];
+                if(last == direction)
+                {
+                    return;
+                }
+                if(this->directionCount == directionCapacity)
+                {
+                    last = direction;
+                    return;
+                }
+            }
+            this->directions[(this->firstDirection + this->directionCount) % directionCapacity] = direction;
+            this->directionCount++;
         }
 
         /**
@@ -51,12 +80,18 @@ class InputBuffer : public IInputBufferReader, public IInputBufferWriter
         }
 
         /**
-         * returns the direction and sets the buffer to 'none'. 
+         * returns the oldest queued direction and removes it, 'none' if there is none. 
          */
         Direction getAndResetDirection() override
         {
-            auto temp = this->direction;
-            this->direction = none;
+            std::lock_guard<std::mutex> lock(this->directionMutex);
+            if(this->directionCount == 0)
+            {
+                return Direction::none;
+            }
+            auto temp = this->directions[this->firstDirection];
+            this->firstDirection = (this->firstDirection + 1) % directionCapacity;
+            this->directionCount--;
             return temp;
         }
 
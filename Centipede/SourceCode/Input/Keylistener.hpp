@@ -2,6 +2,7 @@
 #define KEYLISTENER_HPP
 #include "Keylistener.hpp"
 #include "../../lib/keylib.h"
+#include "../../lib/thread_lib.hpp"
 #include <thread>
 #include <chrono>
 #include <future>
@@ -32,6 +33,10 @@ class Keylistener
          * The thread, in which the keylistener is running. 
          */
         std::shared_ptr<std::thread> keylistenerThread_ptr;
+        /**
+         * Name, cpu and scheduling of the keylistener thread.
+         */
+        ThreadPlacement placement;
 
         /**
          * Synchronized reading access on the 'running' attribute.
@@ -55,6 +60,7 @@ class Keylistener
          */
         void doPolling()
         {
+            this->placement.applyToCurrentThread();
             // Polling loop
             while(this->continuePolling()){
                 // blocking call to get next character.
@@ -82,14 +88,15 @@ class Keylistener
         }
 
         /**
-         * Starts the polling in a background-thread
+         * Starts the polling in a background-thread, placed as given as far as permitted.
          */
-        void startMultithreaded()
+        void startMultithreaded(ThreadPlacement placement = ThreadPlacement())
         {
             if(this->keylistenerThread_ptr != nullptr){
                 // already running
                 return;
             }
+            this->placement = placement;
             this->changeRunning(true);
             this->keylistenerThread_ptr = std::make_shared<std::thread>(&Keylistener::doPolling, this);
         }
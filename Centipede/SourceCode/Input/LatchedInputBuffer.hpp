@@ -0,0 +1,59 @@
+#ifndef LATCHED_INPUT_BUFFER_HPP
+#define LATCHED_INPUT_BUFFER_HPP
+
+#include "IInputBufferReader.hpp"
+#include "TickInput.hpp"
+#include "../Common/Directions.hpp"
+
+/**
+ * Input of one player in a lockstep game, fed with one TickInput per gametick.
+ * Like the live InputBuffer it keeps a direction or a shot until the game reads it, a newer direction replaces an unread one.
+ * It has no lock and is copied along with every snapshot of the game, so a re-simulated gametick reads exactly the same.
+ */
+class LatchedInputBuffer : public IInputBufferReader
+{
+    private:
+        Direction direction;
+        bool shot;
+
+    public:
+        LatchedInputBuffer()
+        {
+            this->direction = Direction::none;
+            this->shot = false;
+        }
+
+        /**
+         * Adds the input of the next gametick to what was not read yet.
+         */
+        void add(TickInput input)
+        {
+            if(input.getDirection() != Direction::none)
+            {
+                this->direction = input.getDirection();
+            }
+            this->shot = this->shot || input.getShot();
+        }
+
+        Direction getAndResetDirection() override
+        {
+            auto temp = this->direction;
+            this->direction = Direction::none;
+            return temp;
+        }
+
+        bool getAndResetShot() override
+        {
+            auto temp = this->shot;
+            this->shot = false;
+            return temp;
+        }
+
+        bool getAndResetBreakoutMenu() override
+        {
+            // Quitting is part of the TickInput, the session handles it.
+            return false;
+        }
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef RECORDING_INPUT_BUFFER_HPP
+#define RECORDING_INPUT_BUFFER_HPP
+
+#include "IInputBufferReader.hpp"
+#include "TickInput.hpp"
+#include "../Common/Directions.hpp"
+#include <memory>
+
+/**
+ * Passes the reads of the game through to another input buffer and remembers what the game got within the current gametick.
+ */
+class RecordingInputBuffer : public IInputBufferReader
+{
+    private:
+        std::shared_ptr<IInputBufferReader> inputBuffer_ptr;
+        Direction direction;
+        bool shot;
+
+    public:
+        RecordingInputBuffer(std::shared_ptr<IInputBufferReader> inputBuffer_ptr)
+            : inputBuffer_ptr(inputBuffer_ptr)
+        {
+            this->direction = Direction::none;
+            this->shot = false;
+        }
+
+        Direction getAndResetDirection() override
+        {
+            auto direction = this->inputBuffer_ptr->getAndResetDirection();
+            if(direction != Direction::none)
+            {
+                this->direction = direction;
+            }
+            return direction;
+        }
+
+        bool getAndResetShot() override
+        {
+            auto shot = this->inputBuffer_ptr->getAndResetShot();
+            this->shot = this->shot || shot;
+            return shot;
+        }
+
+        bool getAndResetBreakoutMenu() override
+        {
+            return this->inputBuffer_ptr->getAndResetBreakoutMenu();
+        }
+
+        /**
+         * Returns what the game read since the last call and starts recording the next gametick.
+         */
+        TickInput takeTickInput(int gameTick)
+        {
+            TickInput input(gameTick, this->direction, this->shot, false);
+            this->direction = Direction::none;
+            this->shot = false;
+            return input;
+        }
+};
+
+#endif
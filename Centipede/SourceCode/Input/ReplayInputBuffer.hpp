@@ -0,0 +1,63 @@
+#ifndef REPLAY_INPUT_BUFFER_HPP
+#define REPLAY_INPUT_BUFFER_HPP
+
+#include "IInputBufferReader.hpp"
+#include "TickInput.hpp"
+#include "../Common/Directions.hpp"
+
+/**
+ * Hands recorded input to the game, one gametick at a time.
+ */
+class ReplayInputBuffer : public IInputBufferReader
+{
+    private:
+        Direction direction;
+        bool shot;
+
+    public:
+        ReplayInputBuffer()
+        {
+            this->direction = Direction::none;
+            this->shot = false;
+        }
+
+        /**
+         * Sets the input for the next gametick, anything not read from the previous one is dropped.
+         */
+        void setInput(TickInput input)
+        {
+            this->direction = input.getDirection();
+            this->shot = input.getShot();
+        }
+
+        /**
+         * Sets no input for the next gametick.
+         */
+        void clear()
+        {
+            this->direction = Direction::none;
+            this->shot = false;
+        }
+
+        Direction getAndResetDirection() override
+        {
+            auto temp = this->direction;
+            this->direction = Direction::none;
+            return temp;
+        }
+
+        bool getAndResetShot() override
+        {
+            auto temp = this->shot;
+            this->shot = false;
+            return temp;
+        }
+
+        bool getAndResetBreakoutMenu() override
+        {
+            // The breakout menu is not part of a replay, only quitting is.
+            return false;
+        }
+};
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef SCRIPTED_PLAYER_HPP
+#define SCRIPTED_PLAYER_HPP
+
+#include "TickInput.hpp"
+#include "../Common/Directions.hpp"
+#include "../Common/Utils.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include <cstdlib>
+#include <random>
+
+/**
+ * Ways the ScriptedPlayer decides its inputs.
+ */
+enum InputPolicy : int
+{
+    autopilotPolicy,
+    randomPolicy
+};
+
+/**
+ * Plays the game without a human: follows the lowest centipede and shoots when below it, with some randomness.
+ * Or presses random keys, which reaches states the autopilot avoids.
+ * Used for workloads that should look like real games, e.g. training replays and soak runs.
+ */
+class ScriptedPlayer
+{
+    private:
+        std::mt19937 random;
+        InputPolicy policy;
+
+        /**
+         * Returns the column of the centipede head closest to the starship, -1 if there is none.
+         */
+        int getTargetColumn(SaveState &state)
+        {
+            int targetLine = -1;
+            int targetColumn = -1;
+            for(auto &centipede : *(state.getCentipedes()))
+            {
+                auto position = centipede.getPosition();
+                if(position.getLine() > targetLine)
+                {
+                    targetLine = position.getLine();
+                    targetColumn = position.getColumn();
+                }
+            }
+            return targetColumn;
+        }
+
+    public:
+        ScriptedPlayer(unsigned int seed, InputPolicy policy = InputPolicy::autopilotPolicy)
+            : random(seed), policy(policy)
+        {
+        }
+
+        /**
+         * Decides the input for the gametick following the given state.
+         */
+        TickInput nextInput(SaveState &state)
+        {
+            auto gameTick = state.getGameTick() + 1;
+            if(this->policy == InputPolicy::randomPolicy)
+            {
+                return TickInput(gameTick, (Direction) (this->random() % 5), rollRandomWithChance(1, 2, this->random), false);
+            }
+            auto starshipColumn = state.getStarship()->getPosition().getColumn();
+            auto targetColumn = this->getTargetColumn(state);
+
+            auto direction = Direction::none;
+            if(rollRandomWithChance(1, 10, this->random))
+            {
+                direction = (Direction) (this->random() % 5);
+            }
+            else if(targetColumn >= 0 && targetColumn < starshipColumn)
+            {
+                direction = Direction::left;
+            }
+            else if(targetColumn > starshipColumn)
+            {
+                direction = Direction::right;
+            }
+
+            auto aligned = targetColumn >= 0 && std::abs(targetColumn - starshipColumn) <= 1;
+            auto shot = aligned || rollRandomWithChance(1, 4, this->random);
+            return TickInput(gameTick, direction, shot, false);
+        }
+};
+
+#endif
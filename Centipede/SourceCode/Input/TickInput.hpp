@@ -0,0 +1,60 @@
+#ifndef TICK_INPUT_HPP
+#define TICK_INPUT_HPP
+
+#include "../Common/Directions.hpp"
+
+/**
+ * Everything the player did, that affected the game within one gametick.
+ */
+class TickInput
+{
+    private:
+        int gameTick;
+        Direction direction;
+        bool shot;
+        bool quit;
+
+    public:
+        TickInput(int gameTick, Direction direction, bool shot, bool quit)
+            : gameTick(gameTick), direction(direction), shot(shot), quit(quit)
+        {
+        }
+
+        int getGameTick()
+        {
+            return this->gameTick;
+        }
+
+        Direction getDirection()
+        {
+            return this->direction;
+        }
+
+        bool getShot()
+        {
+            return this->shot;
+        }
+
+        /**
+         * Returns true if the game was quit via the breakout menu after this gametick.
+         */
+        bool getQuit()
+        {
+            return this->quit;
+        }
+
+        void setQuit(bool quit)
+        {
+            this->quit = quit;
+        }
+
+        /**
+         * Returns true if nothing happened in this gametick.
+         */
+        bool isEmpty()
+        {
+            return this->direction == Direction::none && !this->shot && !this->quit;
+        }
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef I_LOCKSTEP_LINK_HPP
+#define I_LOCKSTEP_LINK_HPP
+
+#include "../Input/TickInput.hpp"
+#include <vector>
+
+/**
+ * Carries the inputs of a lockstep game between the two players, in the order of their gameticks.
+ */
+class ILockstepLink
+{
+    public:
+        /**
+         * Sends the input of the local player for one gametick.
+         */
+        virtual void send(TickInput input) = 0;
+
+        /**
+         * Appends the inputs of the other player, that arrived since the last call, without waiting.
+         * Returns false once the other player is gone.
+         */
+        virtual bool receive(std::vector<TickInput> &inputs) = 0;
+};
+
+#endif
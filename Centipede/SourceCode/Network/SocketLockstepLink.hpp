@@ -0,0 +1,169 @@
+#ifndef SOCKET_LOCKSTEP_LINK_HPP
+#define SOCKET_LOCKSTEP_LINK_HPP
+
+#include "ILockstepLink.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../Input/TickInput.hpp"
+#include "../Persistence/ReplayFormat.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/socket_lib.hpp"
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Lockstep link to another process on the same machine over a Unix domain socket.
+ *
+ * Handshake: the host sends magic "CLSP", u32 version, u32 seed and an i32 per setting, that the simulation or its clock reads.
+ *            The joining player checks, that both play with the same settings, otherwise the game states drift apart.
+ * Inputs:    i32 gametick, u8 direction | flags (shot, quit) << 4, like in a replay.
+ */
+class SocketLockstepLink : public ILockstepLink
+{
+    private:
+        static constexpr uint32_t magic = 0x50534C43; // "CLSP"
+        static constexpr uint32_t version = 2;
+        static constexpr size_t settingsCount = 25;
+        static constexpr size_t handshakeSize = 4 * (3 + settingsCount);
+        static constexpr size_t inputSize = 4 + 1;
+        static constexpr int joinTimeoutMilliseconds = 10000;
+
+        std::unique_ptr<LocalSocket> socket_ptr;
+        unsigned int seed;
+        // Bytes received, but not decoded yet.
+        std::vector<char> received;
+        bool connected;
+
+        SocketLockstepLink(std::unique_ptr<LocalSocket> socket_ptr, unsigned int seed)
+            : socket_ptr(std::move(socket_ptr)), seed(seed)
+        {
+            this->connected = true;
+        }
+
+        static void writeSettings(BinaryWriter &writer, CentipedeSettings &settings)
+        {
+            int32_t values[] = {
+                settings.getPlayingFieldHeight(),
+                settings.getPlayingFieldWidth(),
+                settings.getInitialPlayerHealth(),
+                settings.getInitialMushroomHealth(),
+                settings.getInitialMushroomSpawnChanceDividend(),
+                settings.getInitialMushroomSpawnChanceDivisor(),
+                settings.getInitialStarshipLine(),
+                settings.getInitialStarshipColumn(),
+                settings.getCentipedeSpawnLine(),
+                settings.getCentipedeSpawnColumn(),
+                settings.getInitialCentipedeSize(),
+                settings.getCentipedeSizeIncrementAmount(),
+                settings.getCentipedeSizeIncrementRoundModuloSlowdown(),
+                settings.getPointsForCentipedeHit(),
+                settings.getPointsForMushroomKill(),
+                settings.getPointsForRoundEnd(),
+                settings.getGameTickLength(),
+                settings.getStarshipModuloGametickSlowdown(),
+                settings.getImmediateStarshipInput() ? 1 : 0,
+                settings.getStarshipMoveCooldown(),
+                settings.getInitialCentipedeModuloGametickSlowdown(),
+                settings.getCentipedeSpeedIncrementAmount(),
+                settings.getCentipedeSpeedIncrementRoundModuloSlowdown(),
+                settings.getMaxCentipedeCellsPerGametick(),
+                settings.getLiveLostBreakTime()
+            };
+            static_assert(sizeof(values) / sizeof(values[0]) == settingsCount, "Every setting is part of the handshake.");
+            for(auto value : values)
+            {
+                writer.write<int32_t>(value);
+            }
+        }
+
+    public:
+        /**
+         * Waits at the path for the other player and sends the seed of the game.
+         */
+        static std::shared_ptr<SocketLockstepLink> host(std::string path, unsigned int seed, CentipedeSettings &settings)
+        {
+            auto socket_ptr = LocalSocket::listen(path);
+            BinaryWriter writer;
+            writer.write<uint32_t>(magic);
+            writer.write<uint32_t>(version);
+            writer.write<uint32_t>(seed);
+            writeSettings(writer, settings);
+            if(!socket_ptr->sendAll(writer.getBytes().data(), writer.getSize()))
+            {
+                throw std::logic_error("The other player left before the game started.");
+            }
+            return std::shared_ptr<SocketLockstepLink>(new SocketLockstepLink(std::move(socket_ptr), seed));
+        }
+
+        /**
+         * Connects to the player waiting at the path and takes over the seed of the game.
+         * Throws a logic_error if nobody answers or the other player uses other settings.
+         */
+        static std::shared_ptr<SocketLockstepLink> join(std::string path, CentipedeSettings &settings)
+        {
+            auto socket_ptr = LocalSocket::connect(path, joinTimeoutMilliseconds);
+            std::vector<char> bytes;
+            while(bytes.size() < handshakeSize)
+            {
+                if(!socket_ptr->waitForData(joinTimeoutMilliseconds) || !socket_ptr->receiveAvailable(bytes))
+                {
+                    throw std::logic_error("The other player didn't start the game.");
+                }
+            }
+            BinaryReader reader(bytes.data(), handshakeSize);
+            if(reader.read<uint32_t>() != magic || reader.read<uint32_t>() != version)
+            {
+                throw std::logic_error("The other player runs another version of the game.");
+            }
+            auto seed = reader.read<uint32_t>();
+            BinaryWriter expected;
+            writeSettings(expected, settings);
+            if(std::string(reader.readBytes(expected.getSize()), expected.getSize()) != std::string(expected.getBytes().begin(), expected.getBytes().end()))
+            {
+                throw std::logic_error("The other player uses other settings.");
+            }
+            auto link_ptr = std::shared_ptr<SocketLockstepLink>(new SocketLockstepLink(std::move(socket_ptr), seed));
+            // Inputs sent right after the handshake.
+            link_ptr->received.assign(bytes.begin() + handshakeSize, bytes.end());
+            return link_ptr;
+        }
+
+        unsigned int getSeed()
+        {
+            return this->seed;
+        }
+
+        void send(TickInput input) override
+        {
+            uint8_t flags = (input.getShot() ? ReplayFormat::shotFlag : 0) | (input.getQuit() ? ReplayFormat::quitFlag : 0);
+            BinaryWriter writer;
+            writer.write<int32_t>(input.getGameTick());
+            writer.write<uint8_t>(input.getDirection() | (flags << ReplayFormat::flagsShift));
+            // A broken connection shows up on the next receive.
+            this->connected = this->connected && this->socket_ptr->sendAll(writer.getBytes().data(), writer.getSize());
+        }
+
+        bool receive(std::vector<TickInput> &inputs) override
+        {
+            if(this->connected)
+            {
+                this->connected = this->socket_ptr->receiveAvailable(this->received);
+            }
+            auto complete = this->received.size() / inputSize * inputSize;
+            BinaryReader reader(this->received.data(), complete);
+            while(reader.getRemaining() > 0)
+            {
+                auto gameTick = reader.read<int32_t>();
+                auto directionAndFlags = reader.read<uint8_t>();
+                auto direction = (Direction) (directionAndFlags & ((1 << ReplayFormat::flagsShift) - 1));
+                auto flags = directionAndFlags >> ReplayFormat::flagsShift;
+                inputs.emplace_back(gameTick, direction, (flags & ReplayFormat::shotFlag) != 0, (flags & ReplayFormat::quitFlag) != 0);
+            }
+            this->received.erase(this->received.begin(), this->received.begin() + complete);
+            return this->connected;
+        }
+};
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef AUTOSAVER_HPP
+#define AUTOSAVER_HPP
+#include "CompressedBlock.hpp"
+#include "SaveStateSerializer.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Writes snapshots of a running game to disk on a background thread.
+ * The game thread only hands over a copy of the state, serializing and syncing to disk happen in the background.
+ * If the writer falls behind, only the newest snapshot is written.
+ * The file is replaced atomically, after a crash it contains either the previous or the new snapshot.
+ * The state is stored as one CompressedBlock behind magic and version.
+ */
+class Autosaver
+{
+	private:
+		static constexpr uint32_t fileMagic = 0x56415343; // "CSAV"
+		static constexpr uint32_t version = 4;
+
+		std::string filepath;
+		SaveStateSerializer serializer;
+		ThreadPlacement placement;
+		std::mutex mutex;
+		std::condition_variable snapshotAvailable;
+		std::condition_variable snapshotWritten;
+		// Newest snapshot, that is not yet written.
+		std::shared_ptr<SaveState> pending_ptr;
+		bool writing;
+		bool stopped;
+		int failedWrites;
+		std::thread writer_thread;
+
+		void write(SaveState &snapshot)
+		{
+			BinaryWriter writer;
+			writer.write<uint32_t>(fileMagic);
+			writer.write<uint32_t>(version);
+			BinaryWriter state;
+			this->serializer.serialize(snapshot, state);
+			CompressedBlock::write(state, writer);
+			File file(this->filepath);
+			file.replaceAllBytesDurably(writer.getSize(), writer.getBytes().data());
+		}
+
+		void runWriter()
+		{
+			this->placement.applyToCurrentThread();
+			std::unique_lock<std::mutex> lock(this->mutex);
+			while(true)
+			{
+				this->snapshotAvailable.wait(lock, [this]() { return this->pending_ptr != nullptr || this->stopped; });
+				if(this->pending_ptr == nullptr)
+				{
+					return;
+				}
+				auto snapshot_ptr = this->pending_ptr;
+				this->pending_ptr = nullptr;
+				this->writing = true;
+				lock.unlock();
+
+				try
+				{
+					this->write(*snapshot_ptr);
+				}
+				catch(const std::exception&)
+				{
+					// Keep the game running, the next snapshot might succeed.
+					lock.lock();
+					this->failedWrites++;
+					lock.unlock();
+				}
+
+				lock.lock();
+				this->writing = false;
+				this->snapshotWritten.notify_all();
+			}
+		}
+
+	public:
+		Autosaver(std::string filepath, std::shared_ptr<CentipedeSettings> settings_ptr)
+			: filepath(filepath), serializer(settings_ptr), placement(settings_ptr->getThreadPlacement(ThreadRole::autosaveThread))
+		{
+			this->pending_ptr = nullptr;
+			this->writing = false;
+			this->stopped = false;
+			this->failedWrites = 0;
+			this->writer_thread = std::thread(&Autosaver::runWriter, this);
+		}
+
+		~Autosaver()
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->stopped = true;
+			}
+			this->snapshotAvailable.notify_all();
+			this->writer_thread.join();
+		}
+
+		/**
+		 * Hands a snapshot over to the background thread. It must not be used by the caller afterwards.
+		 */
+		void save(std::shared_ptr<SaveState> snapshot_ptr)
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->pending_ptr = snapshot_ptr;
+			}
+			this->snapshotAvailable.notify_one();
+		}
+
+		/**
+		 * Blocks until every snapshot handed over so far is written.
+		 */
+		void waitUntilWritten()
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->snapshotWritten.wait(lock, [this]() { return this->pending_ptr == nullptr && !this->writing; });
+		}
+
+		/**
+		 * Removes the autosave, e.g. because the game was finished and can't be continued anymore.
+		 */
+		void discard()
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->pending_ptr = nullptr;
+			this->snapshotWritten.wait(lock, [this]() { return !this->writing; });
+			std::remove(this->filepath.c_str());
+		}
+
+		int getFailedWrites()
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			return this->failedWrites;
+		}
+
+		/**
+		 * Restores the game of an autosave file.
+		 */
+		static std::shared_ptr<SaveState> load(std::string filepath, std::shared_ptr<CentipedeSettings> settings_ptr)
+		{
+			MappedFile file(filepath);
+			BinaryReader reader(file.getData(), file.getSize());
+			if(reader.read<uint32_t>() != fileMagic || reader.read<uint32_t>() != version)
+			{
+				throw std::logic_error("File is no autosave of this version.");
+			}
+			auto state = CompressedBlock::read(reader);
+			BinaryReader stateReader(state.data(), state.size());
+			SaveStateSerializer serializer(settings_ptr);
+			return serializer.deserialize(stateReader);
+		}
+};
+
+#endif
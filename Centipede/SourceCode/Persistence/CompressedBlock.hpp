@@ -0,0 +1,49 @@
+#ifndef COMPRESSED_BLOCK_HPP
+#define COMPRESSED_BLOCK_HPP
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Part of a file, that is stored compressed by the BlockCodec:
+ * u32 length of the bytes, u32 length of the compressed bytes, compressed bytes.
+ * Every block can be decompressed on its own, e.g. a single keyframe of a replay.
+ */
+class CompressedBlock
+{
+	public:
+		/**
+		 * Appends the bytes of the content compressed to the writer.
+		 */
+		static void write(BinaryWriter &content, BinaryWriter &writer)
+		{
+			std::vector<char> compressed;
+			BlockCodec::compress(content.getBytes().data(), content.getSize(), compressed);
+			writer.write<uint32_t>(content.getSize());
+			writer.write<uint32_t>(compressed.size());
+			writer.writeBytes(compressed.data(), compressed.size());
+		}
+
+		/**
+		 * Reads a block written by write() and returns its decompressed bytes.
+		 * Throws a logic_error if the block is incomplete or corrupt.
+		 */
+		static std::vector<char> read(BinaryReader &reader)
+		{
+			auto length = reader.read<uint32_t>();
+			auto compressedLength = reader.read<uint32_t>();
+			auto compressed = reader.readBytes(compressedLength);
+			// One byte of a length expands to at most 255 bytes, anything longer is corrupt and not worth allocating.
+			if(length > (uint64_t) compressedLength * 255 + 16)
+			{
+				throw std::logic_error("The compressed block is corrupt.");
+			}
+			std::vector<char> content(length);
+			BlockCodec::decompress(compressed, compressedLength, content.data(), length);
+			return content;
+		}
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef REPLAY_FORMAT_HPP
+#define REPLAY_FORMAT_HPP
+#include <cstdint>
+
+/**
+ * Layout of a replay file:
+ *
+ * Header:   magic "CRPL", u32 version, i32 field height, i32 field width, i32 keyframe interval
+ * Blocks:   u8 block type, u32 payload length, payload
+ *           - keyframe: i32 gametick, CompressedBlock of the serialized SaveState after that gametick
+ *           - inputs:   CompressedBlock of: varint count, per input: varint gametick - previous gametick,
+ *                       u8 direction | flags (shot, quit) << 4
+ * Index:    u32 count, per keyframe: i32 gametick, u64 offset of its block
+ * Trailer:  u64 offset of the index, magic "CRIX"
+ *
+ * Every keyframe block is followed by the inputs up to the next keyframe.
+ * The gametick of a keyframe stays uncompressed, so that the blocks can be scanned without decompressing them.
+ * A file without trailer (e.g. after a crash) is still readable, the index is then rebuilt by scanning the blocks.
+ */
+class ReplayFormat
+{
+	public:
+		static constexpr uint32_t fileMagic = 0x4C505243; // "CRPL"
+		static constexpr uint32_t indexMagic = 0x58495243; // "CRIX"
+		static constexpr uint32_t version = 4;
+		static constexpr size_t headerSize = 4 + 4 + 4 + 4 + 4;
+		static constexpr size_t blockHeaderSize = 1 + 4;
+		static constexpr size_t trailerSize = 8 + 4;
+		static constexpr int flagsShift = 4;
+		static constexpr uint8_t shotFlag = 1;
+		static constexpr uint8_t quitFlag = 2;
+};
+
+enum ReplayBlockType : uint8_t
+{
+	keyframeBlock = 1,
+	inputBlock = 2
+};
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef REPLAY_READER_HPP
+#define REPLAY_READER_HPP
+#include "CompressedBlock.hpp"
+#include "ReplayFormat.hpp"
+#include "SaveStateSerializer.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../Common/Directions.hpp"
+#include "../Common/Tuple.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../Input/TickInput.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Reads a replay file written by the ReplayRecorder.
+ * The file is mapped into memory, only the blocks needed for a request are decoded.
+ */
+class ReplayReader
+{
+	private:
+		std::shared_ptr<MappedFile> file_ptr;
+		SaveStateSerializer serializer;
+		int keyframeInterval;
+		// End of the blocks, either the start of the index or the end of the last complete block.
+		size_t blocksEnd;
+		int lastGameTick;
+		// Gametick and block offset of every keyframe, ascending.
+		std::vector<Tuple<int32_t, uint64_t>> keyframes;
+
+		void readHeader(BinaryReader &reader, std::shared_ptr<CentipedeSettings> settings_ptr)
+		{
+			if(reader.read<uint32_t>() != ReplayFormat::fileMagic)
+			{
+				throw std::logic_error("File is no replay.");
+			}
+			if(reader.read<uint32_t>() != ReplayFormat::version)
+			{
+				throw std::logic_error("Replay was written by an incompatible version.");
+			}
+			auto height = reader.read<int32_t>();
+			auto width = reader.read<int32_t>();
+			if(height != settings_ptr->getPlayingFieldHeight() || width != settings_ptr->getPlayingFieldWidth())
+			{
+				throw std::logic_error("Replay was recorded on a playing field of different size.");
+			}
+			this->keyframeInterval = reader.read<int32_t>();
+		}
+
+		/**
+		 * Reads the index from the end of the file, returns false if there is none.
+		 */
+		bool readIndex()
+		{
+			auto size = this->file_ptr->getSize();
+			if(size < ReplayFormat::headerSize + ReplayFormat::trailerSize)
+			{
+				return false;
+			}
+			BinaryReader reader(this->file_ptr->getData(), size);
+			reader.seek(size - ReplayFormat::trailerSize);
+			auto indexOffset = reader.read<uint64_t>();
+			if(reader.read<uint32_t>() != ReplayFormat::indexMagic || indexOffset < ReplayFormat::headerSize || indexOffset >= size)
+			{
+				return false;
+			}
+			reader.seek(indexOffset);
+			auto count = reader.read<uint32_t>();
+			for(uint32_t keyframe = 0; keyframe < count; keyframe++)
+			{
+				auto gameTick = reader.read<int32_t>();
+				auto offset = reader.read<uint64_t>();
+				this->keyframes.push_back(Tuple<int32_t, uint64_t>(gameTick, offset));
+			}
+			this->blocksEnd = indexOffset;
+			return true;
+		}
+
+		/**
+		 * Rebuilds the index by walking over all blocks, e.g. if the recording game crashed.
+		 * A block cut off at the end of the file is ignored.
+		 */
+		void scanBlocks()
+		{
+			auto size = this->file_ptr->getSize();
+			BinaryReader reader(this->file_ptr->getData(), size);
+			size_t offset = ReplayFormat::headerSize;
+			while(size - offset >= ReplayFormat::blockHeaderSize)
+			{
+				reader.seek(offset);
+				auto type = reader.read<uint8_t>();
+				auto length = reader.read<uint32_t>();
+				if(length > reader.getRemaining() || (type != ReplayBlockType::keyframeBlock && type != ReplayBlockType::inputBlock))
+				{
+					break;
+				}
+				if(type == ReplayBlockType::keyframeBlock)
+				{
+					this->keyframes.push_back(Tuple<int32_t, uint64_t>(reader.read<int32_t>(), offset));
+				}
+				offset += ReplayFormat::blockHeaderSize + length;
+			}
+			this->blocksEnd = offset;
+		}
+
+		/**
+		 * Returns the position of the last keyframe at or before the given gametick.
+		 */
+		size_t findKeyframe(int gameTick)
+		{
+			if(this->keyframes.empty() || this->keyframes.front().getItem1() > gameTick)
+			{
+				throw std::logic_error("Replay has no keyframe before gametick " + std::to_string(gameTick) + ".");
+			}
+			// Last keyframe with a gametick <= the requested one, a quit can lead to two keyframes of the same gametick.
+			size_t low = 0;
+			size_t high = this->keyframes.size();
+			while(high - low > 1)
+			{
+				auto middle = (low + high) / 2;
+				if(this->keyframes[middle].getItem1() <= gameTick)
+				{
+					low = middle;
+				}
+				else
+				{
+					high = middle;
+				}
+			}
+			return low;
+		}
+
+		void readInputBlock(BinaryReader &reader, int fromGameTick, int toGameTick, std::vector<TickInput> &inputs)
+		{
+			auto content = CompressedBlock::read(reader);
+			BinaryReader inputReader(content.data(), content.size());
+			auto count = inputReader.readVarint();
+			uint32_t previousGameTick = 0;
+			for(uint64_t input = 0; input < count; input++)
+			{
+				auto gameTick = (int32_t) (previousGameTick + (uint32_t) inputReader.readVarint());
+				previousGameTick = gameTick;
+				auto directionAndFlags = inputReader.read<uint8_t>();
+				auto direction = (Direction) (directionAndFlags & ((1 << ReplayFormat::flagsShift) - 1));
+				auto flags = directionAndFlags >> ReplayFormat::flagsShift;
+				if(gameTick < fromGameTick || gameTick > toGameTick)
+				{
+					continue;
+				}
+				inputs.push_back(TickInput(gameTick,
+										   direction,
+										   (flags & ReplayFormat::shotFlag) != 0,
+										   (flags & ReplayFormat::quitFlag) != 0));
+			}
+		}
+
+	public:
+		ReplayReader(std::string filepath, std::shared_ptr<CentipedeSettings> settings_ptr)
+			: serializer(settings_ptr)
+		{
+			this->file_ptr = std::make_shared<MappedFile>(filepath);
+			if(this->file_ptr->getSize() < ReplayFormat::headerSize)
+			{
+				throw std::logic_error("File is no replay.");
+			}
+			BinaryReader reader(this->file_ptr->getData(), this->file_ptr->getSize());
+			this->readHeader(reader, settings_ptr);
+			if(!this->readIndex())
+			{
+				this->scanBlocks();
+			}
+			if(this->keyframes.empty())
+			{
+				throw std::logic_error("Replay contains no keyframe.");
+			}
+
+			this->lastGameTick = this->keyframes.back().getItem1();
+			auto inputs = this->readInputs(this->lastGameTick, INT32_MAX);
+			if(!inputs.empty())
+			{
+				this->lastGameTick = inputs.back().getGameTick();
+			}
+		}
+
+		int getKeyframeInterval()
+		{
+			return this->keyframeInterval;
+		}
+
+		int getKeyframeCount()
+		{
+			return this->keyframes.size();
+		}
+
+		/**
+		 * Returns the last gametick, that is contained in the replay.
+		 */
+		int getLastGameTick()
+		{
+			return this->lastGameTick;
+		}
+
+		/**
+		 * Restores the state of the last keyframe at or before the given gametick.
+		 */
+		std::shared_ptr<SaveState> loadKeyframe(int gameTick)
+		{
+			auto offset = this->keyframes[this->findKeyframe(gameTick)].getItem2();
+			BinaryReader reader(this->file_ptr->getData(), this->blocksEnd);
+			reader.seek(offset);
+			if(reader.read<uint8_t>() != ReplayBlockType::keyframeBlock)
+			{
+				throw std::logic_error("Replay index points to no keyframe.");
+			}
+			reader.read<uint32_t>();
+			reader.read<int32_t>();
+			auto state = CompressedBlock::read(reader);
+			BinaryReader stateReader(state.data(), state.size());
+			return this->serializer.deserialize(stateReader);
+		}
+
+		/**
+		 * Returns the recorded inputs from the first up to the last given gametick, both included.
+		 */
+		std::vector<TickInput> readInputs(int fromGameTick, int toGameTick)
+		{
+			std::vector<TickInput> inputs;
+			if(fromGameTick > toGameTick)
+			{
+				return inputs;
+			}
+			// Inputs are stored behind the keyframe that precedes them.
+			auto first = fromGameTick <= this->keyframes.front().getItem1() ? 0 : this->findKeyframe(fromGameTick - 1);
+			BinaryReader reader(this->file_ptr->getData(), this->blocksEnd);
+			size_t offset = this->keyframes[first].getItem2();
+			while(this->blocksEnd - offset >= ReplayFormat::blockHeaderSize)
+			{
+				reader.seek(offset);
+				auto type = reader.read<uint8_t>();
+				auto length = reader.read<uint32_t>();
+				if(type == ReplayBlockType::keyframeBlock && reader.read<int32_t>() > toGameTick)
+				{
+					break;
+				}
+				if(type == ReplayBlockType::inputBlock)
+				{
+					this->readInputBlock(reader, fromGameTick, toGameTick, inputs);
+				}
+				offset += ReplayFormat::blockHeaderSize + length;
+			}
+			return inputs;
+		}
+};
+
+#endif
@@ -0,0 +1,184 @@
+#ifndef REPLAY_RECORDER_HPP
+#define REPLAY_RECORDER_HPP
+#include "CompressedBlock.hpp"
+#include "ReplayFormat.hpp"
+#include "SaveStateSerializer.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../Common/MemoryAccounting.hpp"
+#include "../Common/Tuple.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../Input/TickInput.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Writes a running game into a seekable replay file: the inputs of every gametick
+ * and a keyframe of the entire state every keyframeInterval gameticks.
+ */
+class ReplayRecorder
+{
+	private:
+		File file;
+		SaveStateSerializer serializer;
+		int keyframeInterval;
+		uint64_t fileSize;
+		int lastKeyframeTick;
+		bool closed;
+		// Inputs since the last keyframe.
+		AccountedVector<TickInput, MemorySubsystem::recordingMemory> pendingInputs;
+		// Gametick and block offset of every keyframe written so far.
+		AccountedVector<Tuple<int32_t, uint64_t>, MemorySubsystem::recordingMemory> index;
+
+		void appendToFile(BinaryWriter &writer)
+		{
+			this->file.appendBytes(writer.getSize(), writer.getBytes().data());
+			this->fileSize += writer.getSize();
+		}
+
+		void appendBlock(ReplayBlockType type, BinaryWriter &payload)
+		{
+			BinaryWriter block;
+			block.write<uint8_t>(type);
+			block.write<uint32_t>(payload.getSize());
+			block.writeBytes(payload.getBytes().data(), payload.getSize());
+			this->appendToFile(block);
+		}
+
+		void writePendingInputs()
+		{
+			if(this->pendingInputs.empty())
+			{
+				return;
+			}
+			BinaryWriter inputs;
+			inputs.writeVarint(this->pendingInputs.size());
+			uint32_t previousGameTick = 0;
+			for(auto &input : this->pendingInputs)
+			{
+				uint8_t flags = 0;
+				if(input.getShot()) flags |= ReplayFormat::shotFlag;
+				if(input.getQuit()) flags |= ReplayFormat::quitFlag;
+				// Inputs are ascending, the distance to the previous one mostly fits into a byte.
+				inputs.writeVarint((uint32_t) input.getGameTick() - previousGameTick);
+				inputs.write<uint8_t>(input.getDirection() | (flags << ReplayFormat::flagsShift));
+				previousGameTick = input.getGameTick();
+			}
+			BinaryWriter payload;
+			CompressedBlock::write(inputs, payload);
+			this->appendBlock(ReplayBlockType::inputBlock, payload);
+			this->pendingInputs.clear();
+		}
+
+		void writeIndex()
+		{
+			BinaryWriter footer;
+			uint64_t indexOffset = this->fileSize;
+			footer.write<uint32_t>(this->index.size());
+			for(auto &keyframe : this->index)
+			{
+				footer.write<int32_t>(keyframe.getItem1());
+				footer.write<uint64_t>(keyframe.getItem2());
+			}
+			footer.write<uint64_t>(indexOffset);
+			footer.write<uint32_t>(ReplayFormat::indexMagic);
+			this->appendToFile(footer);
+		}
+
+	public:
+		/**
+		 * Creates the replay file, an existing file is overwritten.
+		 */
+		ReplayRecorder(std::string filepath, std::shared_ptr<CentipedeSettings> settings_ptr, int keyframeInterval)
+			: file(filepath), serializer(settings_ptr), keyframeInterval(keyframeInterval)
+		{
+			this->fileSize = 0;
+			this->lastKeyframeTick = -1;
+			this->closed = false;
+
+			BinaryWriter header;
+			header.write<uint32_t>(ReplayFormat::fileMagic);
+			header.write<uint32_t>(ReplayFormat::version);
+			header.write<int32_t>(settings_ptr->getPlayingFieldHeight());
+			header.write<int32_t>(settings_ptr->getPlayingFieldWidth());
+			header.write<int32_t>(keyframeInterval);
+			this->file.writeAllBytes(header.getSize(), header.getBytes().data());
+			this->fileSize = header.getSize();
+		}
+
+		~ReplayRecorder()
+		{
+			if(!this->closed)
+			{
+				// Without final state, the file is still readable up to the last written block.
+				this->writePendingInputs();
+				this->writeIndex();
+			}
+		}
+
+		/**
+		 * Writes the entire state as keyframe, the inputs since the previous keyframe are written before.
+		 */
+		void recordKeyframe(SaveState &state)
+		{
+			this->writePendingInputs();
+			BinaryWriter serializedState;
+			this->serializer.serialize(state, serializedState);
+			BinaryWriter payload;
+			payload.write<int32_t>(state.getGameTick());
+			CompressedBlock::write(serializedState, payload);
+			this->index.push_back(Tuple<int32_t, uint64_t>(state.getGameTick(), this->fileSize));
+			this->appendBlock(ReplayBlockType::keyframeBlock, payload);
+			this->lastKeyframeTick = state.getGameTick();
+		}
+
+		/**
+		 * Records the input of the gametick, that led to the given state.
+		 */
+		void recordGametick(TickInput input, SaveState &state)
+		{
+			if(!input.isEmpty())
+			{
+				this->pendingInputs.push_back(input);
+			}
+			if(state.getGameTick() % this->keyframeInterval == 0)
+			{
+				this->recordKeyframe(state);
+			}
+		}
+
+		/**
+		 * Records that the game was quit after the given gametick.
+		 */
+		void recordQuit(int gameTick)
+		{
+			if(!this->pendingInputs.empty() && this->pendingInputs.back().getGameTick() == gameTick)
+			{
+				this->pendingInputs.back().setQuit(true);
+				return;
+			}
+			this->pendingInputs.push_back(TickInput(gameTick, Direction::none, false, true));
+		}
+
+		/**
+		 * Writes the final state and the index. Nothing can be recorded afterwards.
+		 */
+		void close(SaveState &finalState)
+		{
+			if(this->closed)
+			{
+				return;
+			}
+			// A quit after the last keyframe changed the state without a gametick.
+			if(finalState.getGameTick() != this->lastKeyframeTick || !this->pendingInputs.empty())
+			{
+				this->recordKeyframe(finalState);
+			}
+			this->writeIndex();
+			this->closed = true;
+		}
+};
+
+#endif
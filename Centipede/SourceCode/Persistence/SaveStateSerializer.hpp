@@ -0,0 +1,207 @@
+#ifndef SAVE_STATE_SERIALIZER_HPP
+#define SAVE_STATE_SERIALIZER_HPP
+#include "../../lib/binary_lib.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../Common/Directions.hpp"
+#include "../Common/GameRandom.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include "../GameObjects/CentipedeHead.hpp"
+#include "../GameObjects/CentipedeBody.hpp"
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Converts a SaveState to bytes and back.
+ * The settings are not part of the bytes, a state can only be restored with settings of the same playing field size.
+ */
+class SaveStateSerializer
+{
+	private:
+		// Games draw a few numbers per round, restoring a corrupt count must not skip billions of them.
+		static constexpr uint64_t maxRandomDraws = 1 << 24;
+
+		std::shared_ptr<CentipedeSettings> settings_ptr;
+
+		void serializeCentipede(CentipedeHead &centipede, BinaryWriter &writer)
+		{
+			// Count first, the number of segments is written in front of them.
+			uint32_t segmentCount = 1;
+			for(auto tail = centipede.getTail(); tail != nullptr; tail = tail->getTail())
+			{
+				segmentCount++;
+			}
+			writer.write<uint32_t>(segmentCount);
+
+			writer.write<int32_t>(centipede.getPosition().getLine());
+			writer.write<int32_t>(centipede.getPosition().getColumn());
+			writer.write<uint8_t>(centipede.getMovingDirection());
+			for(auto tail = centipede.getTail(); tail != nullptr; tail = tail->getTail())
+			{
+				writer.write<int32_t>(tail->getPosition().getLine());
+				writer.write<int32_t>(tail->getPosition().getColumn());
+				writer.write<uint8_t>(tail->getMovingDirection());
+			}
+		}
+
+		CentipedeHead deserializeCentipede(BinaryReader &reader)
+		{
+			auto segmentCount = reader.read<uint32_t>();
+			if(segmentCount == 0)
+			{
+				throw std::logic_error("A saved centipede needs at least a head.");
+			}
+			std::vector<Position> positions;
+			std::vector<CentipedeMovingDirection> directions;
+			for(uint32_t segment = 0; segment < segmentCount; segment++)
+			{
+				auto line = reader.read<int32_t>();
+				auto column = reader.read<int32_t>();
+				positions.push_back(Position(line, column, this->settings_ptr));
+				directions.push_back((CentipedeMovingDirection) reader.read<uint8_t>());
+			}
+
+			// Link the segments from the end of the tail to the head.
+			std::shared_ptr<CentipedeBody> tail_ptr = nullptr;
+			for(int segment = segmentCount - 1; segment >= 0; segment--)
+			{
+				tail_ptr = CentipedeBody::create(positions[segment], tail_ptr, directions[segment]);
+			}
+			return CentipedeHead(tail_ptr);
+		}
+
+	public:
+		SaveStateSerializer(std::shared_ptr<CentipedeSettings> settings_ptr)
+			: settings_ptr(settings_ptr)
+		{
+		}
+
+		/**
+		 * Appends the entire state to the writer.
+		 */
+		void serialize(SaveState &state, BinaryWriter &writer)
+		{
+			writer.write<int32_t>(state.getGameTick());
+			writer.write<int32_t>(state.getCurrentCentipedeSpeed());
+			writer.write<int32_t>(state.getCurrentRound());
+			writer.write<int32_t>(state.getScore());
+			writer.write<int32_t>(state.getLives());
+			writer.write<uint8_t>(state.hasDiedInRound());
+			writer.write<uint32_t>(state.getRandom().getSeed());
+			writer.write<uint64_t>(state.getRandom().getDraws());
+
+			// Mushrooms
+			auto height = this->settings_ptr->getPlayingFieldHeight();
+			auto width = this->settings_ptr->getPlayingFieldWidth();
+			auto mushroomMap_ptr = state.getMushroomMap();
+			writer.write<int32_t>(height);
+			writer.write<int32_t>(width);
+			for(int line = 0; line < height; line++)
+			{
+				for(int column = 0; column < width; column++)
+				{
+					writer.write<int8_t>(mushroomMap_ptr->getMushroom(line, column));
+				}
+			}
+
+			// Starship
+			auto starshipPosition = state.getStarship()->getPosition();
+			writer.write<int32_t>(starshipPosition.getLine());
+			writer.write<int32_t>(starshipPosition.getColumn());
+			writer.write<int32_t>(state.getStarship()->getNextMoveGameTick());
+
+			// Bullets
+			auto bullets_ptr = state.getBullets();
+			writer.write<uint32_t>(bullets_ptr->size());
+			for(auto bullet : *bullets_ptr)
+			{
+				writer.write<int32_t>(bullet.getPosition().getLine());
+				writer.write<int32_t>(bullet.getPosition().getColumn());
+			}
+
+			// Centipedes
+			auto centipedes_ptr = state.getCentipedes();
+			writer.write<uint32_t>(centipedes_ptr->size());
+			for(auto &centipede : *centipedes_ptr)
+			{
+				this->serializeCentipede(centipede, writer);
+			}
+		}
+
+		/**
+		 * Reads a state written by serialize().
+		 * Throws a logic_error if the data is incomplete or was saved for another playing field size.
+		 */
+		std::shared_ptr<SaveState> deserialize(BinaryReader &reader)
+		{
+			auto gameTick = reader.read<int32_t>();
+			auto currentCentipedeSpeed = reader.read<int32_t>();
+			auto currentRound = reader.read<int32_t>();
+			auto score = reader.read<int32_t>();
+			auto lives = reader.read<int32_t>();
+			auto diedInRound = reader.read<uint8_t>() != 0;
+			auto randomSeed = reader.read<uint32_t>();
+			auto randomDraws = reader.read<uint64_t>();
+			if(randomDraws > maxRandomDraws)
+			{
+				throw std::logic_error("The saved state has drawn implausibly many random numbers.");
+			}
+
+			// Mushrooms
+			auto height = reader.read<int32_t>();
+			auto width = reader.read<int32_t>();
+			if(height != this->settings_ptr->getPlayingFieldHeight() || width != this->settings_ptr->getPlayingFieldWidth())
+			{
+				throw std::logic_error("The saved state was made for another playing field size.");
+			}
+			auto mushroomMap_ptr = std::make_shared<MushroomMap>(this->settings_ptr, false);
+			for(int line = 0; line < height; line++)
+			{
+				for(int column = 0; column < width; column++)
+				{
+					mushroomMap_ptr->setMushroom(line, column, reader.read<int8_t>());
+				}
+			}
+
+			// Starship
+			auto starshipLine = reader.read<int32_t>();
+			auto starshipColumn = reader.read<int32_t>();
+			auto starship_ptr = std::make_shared<Starship>(starshipLine, starshipColumn, this->settings_ptr);
+			starship_ptr->setNextMoveGameTick(reader.read<int32_t>());
+
+			// Bullets
+			auto bullets_ptr = std::make_shared<BulletVector>();
+			auto bulletCount = reader.read<uint32_t>();
+			for(uint32_t bullet = 0; bullet < bulletCount; bullet++)
+			{
+				auto line = reader.read<int32_t>();
+				auto column = reader.read<int32_t>();
+				bullets_ptr->push_back(Bullet(line, column, this->settings_ptr));
+			}
+
+			// Centipedes
+			auto centipedes_ptr = std::make_shared<CentipedeList>();
+			auto centipedeCount = reader.read<uint32_t>();
+			for(uint32_t centipede = 0; centipede < centipedeCount; centipede++)
+			{
+				centipedes_ptr->push_back(this->deserializeCentipede(reader));
+			}
+
+			auto state_ptr = std::make_shared<SaveState>(this->settings_ptr,
+														 bullets_ptr,
+														 starship_ptr,
+														 mushroomMap_ptr,
+														 centipedes_ptr,
+														 currentCentipedeSpeed,
+														 currentRound,
+														 score,
+														 lives,
+														 0);
+			state_ptr->setGameTick(gameTick);
+			state_ptr->setDiedInRound(diedInRound);
+			state_ptr->setRandom(GameRandom::restore(randomSeed, randomDraws));
+			return state_ptr;
+		}
+};
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef STATE_MIRROR_HPP
+#define STATE_MIRROR_HPP
+#include "SaveStateSerializer.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include "../Common/CentipedeSettings.hpp"
+#include "../GameObjects/SaveState.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Mirrors the running game into a memory mapped file after every gametick, for crash forensics.
+ * The game thread copies the state into the mapping, there is no system call per gametick. If the process crashes
+ * or gets killed, the kernel still writes the mapped pages: the file holds the state of the last complete gametick.
+ * A power loss isn't covered, that is what the Autosaver syncs to disk for.
+ * The file is removed when the game ends normally, a file left behind belongs to a crashed game.
+ *
+ * The layout is fixed for the playing field size:
+ * Header: magic, version, slot size, active slot (0, 1 or none yet)
+ * Slots:  two times the length of the state and the state itself, padded to the slot size
+ * A gametick is written into the inactive slot, which becomes active afterwards. Being killed while writing
+ * leaves the previous gametick intact.
+ */
+class StateMirror
+{
+	private:
+		static constexpr uint32_t fileMagic = 0x52494D43; // "CMIR"
+		static constexpr uint32_t version = 1;
+		static constexpr uint32_t noSlot = 0xFFFFFFFF;
+		static constexpr size_t headerSize = 16;
+		static constexpr size_t activeSlotOffset = 12;
+
+		std::string filepath;
+		SaveStateSerializer serializer;
+		std::unique_ptr<SharedMappedFile> file_ptr;
+		size_t slotSize;
+		std::atomic<uint32_t> *activeSlot_ptr;
+		BinaryWriter writer;
+		int skippedGameTicks;
+
+		/**
+		 * Upper bound of a serialized state: the counters plus every cell with a mushroom, a bullet and a centipede of its own.
+		 */
+		static size_t getSlotSize(CentipedeSettings &settings)
+		{
+			size_t cells = settings.getPlayingFieldHeight() * settings.getPlayingFieldWidth();
+			return sizeof(uint32_t) + 64 + cells * (1 + 8 + 4 + 9);
+		}
+
+		char *getSlot(uint32_t slot)
+		{
+			return this->file_ptr->getData() + headerSize + slot * this->slotSize;
+		}
+
+	public:
+		/**
+		 * Creates or replaces the file, it holds no gametick until the first update.
+		 */
+		StateMirror(std::string filepath, std::shared_ptr<CentipedeSettings> settings_ptr)
+			: filepath(filepath), serializer(settings_ptr)
+		{
+			static_assert(std::atomic<uint32_t>::is_always_lock_free, "The active slot has to be a plain word in the file.");
+			this->slotSize = getSlotSize(*settings_ptr);
+			this->file_ptr = std::make_unique<SharedMappedFile>(filepath, headerSize + 2 * this->slotSize);
+			auto header = this->file_ptr->getData();
+			uint32_t values[] = { fileMagic, version, (uint32_t) this->slotSize };
+			std::memcpy(header, values, sizeof(values));
+			this->activeSlot_ptr = new (header + activeSlotOffset) std::atomic<uint32_t>(noSlot);
+			this->skippedGameTicks = 0;
+		}
+
+		StateMirror(const StateMirror&) = delete;
+		StateMirror& operator=(const StateMirror&) = delete;
+
+		/**
+		 * Copies the state into the inactive slot and makes it the active one.
+		 * A state, that doesn't fit into a slot, is skipped and the previous one stays active.
+		 */
+		void update(SaveState &state)
+		{
+			this->writer.clear();
+			this->serializer.serialize(state, this->writer);
+			uint32_t length = this->writer.getSize();
+			if(sizeof(length) + length > this->slotSize)
+			{
+				this->skippedGameTicks++;
+				return;
+			}
+			auto slot = this->activeSlot_ptr->load(std::memory_order_relaxed) == 0 ? 1u : 0u;
+			auto slot_ptr = this->getSlot(slot);
+			std::memcpy(slot_ptr, &length, sizeof(length));
+			std::memcpy(slot_ptr + sizeof(length), this->writer.getBytes().data(), length);
+			// The slot has to be complete, before it becomes the active one.
+			this->activeSlot_ptr->store(slot, std::memory_order_release);
+		}
+
+		/**
+		 * Removes the file, e.g. because the game ended normally and there is nothing to investigate.
+		 */
+		void discard()
+		{
+			this->file_ptr = nullptr;
+			std::remove(this->filepath.c_str());
+		}
+
+		int getSkippedGameTicks()
+		{
+			return this->skippedGameTicks;
+		}
+
+		/**
+		 * Checks by the magic, whether the file is a state mirror, e.g. to tell it apart from an autosave.
+		 */
+		static bool isStateMirror(std::string filepath)
+		{
+			std::ifstream file(filepath, std::ios::binary);
+			uint32_t magic = 0;
+			file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+			return file.good() && magic == fileMagic;
+		}
+
+		/**
+		 * Restores the state of the last complete gametick, e.g. of a crashed game.
+		 */
+		static std::shared_ptr<SaveState> load(std::string filepath, std::shared_ptr<CentipedeSettings> settings_ptr)
+		{
+			MappedFile file(filepath);
+			BinaryReader reader(file.getData(), file.getSize());
+			if(reader.read<uint32_t>() != fileMagic || reader.read<uint32_t>() != version)
+			{
+				throw std::logic_error("File is no state mirror of this version.");
+			}
+			auto slotSize = reader.read<uint32_t>();
+			auto activeSlot = reader.read<uint32_t>();
+			if(activeSlot == noSlot)
+			{
+				throw std::logic_error("The state mirror holds no gametick yet.");
+			}
+			if(activeSlot > 1)
+			{
+				throw std::logic_error("The state mirror is corrupted.");
+			}
+			reader.seek(headerSize + activeSlot * slotSize);
+			auto length = reader.read<uint32_t>();
+			if(sizeof(length) + length > slotSize)
+			{
+				throw std::logic_error("The state mirror is corrupted.");
+			}
+			BinaryReader stateReader(reader.readBytes(length), length);
+			SaveStateSerializer serializer(settings_ptr);
+			return serializer.deserialize(stateReader);
+		}
+};
+
+#endif
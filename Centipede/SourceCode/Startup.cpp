@@ -1,25 +1,241 @@
 #include "BusinessLogic/GameLogic.hpp"
+#include "BusinessLogic/LockstepGameLogic.hpp"
 #include "BusinessLogic/MenuLogic.hpp"
+#include "BusinessLogic/ReplayPlayer.hpp"
+#include "Persistence/Autosaver.hpp"
+#include "Persistence/ReplayReader.hpp"
+#include "Persistence/StateMirror.hpp"
 #include "UI/ConsoleOutput.hpp"
 #include "UI/StandardTheme.hpp"
 #include "UI/StandardThemeWindows.hpp"
+#include "UI/MonochromeTheme.hpp"
+#include "UI/CompactTheme.hpp"
+#include "UI/FileTheme.hpp"
 #include "Input/IInputBufferReader.hpp"
 #include "Input/InputBuffer.hpp"
 #include "Input/Keycodes.hpp"
+#include "Network/SocketLockstepLink.hpp"
 #include "Common/Directions.hpp"
+#include "Common/CentipedeSettings.hpp"
+#include "Common/MemoryAccounting.hpp"
+#include "Common/ThreadRole.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
 
-int main(int argc, char** argv){
-    // Initialize Objects
-    auto ui_ptr = std::make_shared<ConsoleOutput>();
+/**
+ * Returns the value of the command line option "--<name> <value>" or "--<name>=<value>".
+ * Returns the fallback if the option is not given.
+ */
+std::string getOption(int argc, char** argv, std::string name, std::string fallback)
+{
+    std::string option = "--" + name;
+    for(int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if(argument == option && i + 1 < argc)
+        {
+            return argv[i + 1];
+        }
+        if(argument.rfind(option + "=", 0) == 0)
+        {
+            return argument.substr(option.size() + 1);
+        }
+    }
+    return fallback;
+}
+
+/**
+ * Returns the values of all occurrences of the command line option "--<name> <value>" or "--<name>=<value>".
+ */
+std::vector<std::string> getOptions(int argc, char** argv, std::string name)
+{
+    std::vector<std::string> values;
+    std::string option = "--" + name;
+    for(int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if(argument == option && i + 1 < argc)
+        {
+            values.push_back(argv[++i]);
+        }
+        else if(argument.rfind(option + "=", 0) == 0)
+        {
+            values.push_back(argument.substr(option.size() + 1));
+        }
+    }
+    return values;
+}
+
+/**
+ * Returns true if the command line contains the option "--<name>".
+ */
+bool hasFlag(int argc, char** argv, std::string name)
+{
+    std::string option = "--" + name;
+    for(int i = 1; i < argc; i++)
+    {
+        if(option == argv[i])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Overwrites the thread placements of the settings with the options "--thread-cpu <role>=<cpu>",
+ * "--thread-realtime <role>=<priority>" and "--thread-nice <role>=<nice level>", each of them can be repeated.
+ * Returns false if an option names an unknown role.
+ */
+bool applyThreadOptions(int argc, char** argv, std::shared_ptr<CentipedeSettings> settings_ptr)
+{
+    auto roleNames = getThreadRoleNames();
+    std::vector<std::string> optionNames = { "thread-cpu", "thread-realtime", "thread-nice" };
+    for(auto &optionName : optionNames)
+    {
+        for(auto &option : getOptions(argc, argv, optionName))
+        {
+            auto separator = option.find('=');
+            auto role = std::find(roleNames.begin(), roleNames.end(), option.substr(0, separator));
+            if(separator == std::string::npos || role == roleNames.end())
+            {
+                std::cerr << "Invalid --" << optionName << " '" << option << "', use <role>=<value> with role game, clock, input, autosave or pregen." << std::endl;
+                return false;
+            }
+            auto threadRole = (ThreadRole) (role - roleNames.begin());
+            auto value = std::stoi(option.substr(separator + 1));
+            if(optionName == "thread-cpu") settings_ptr->setThreadCpu(threadRole, value);
+            if(optionName == "thread-realtime") settings_ptr->setThreadRealtimePriority(threadRole, value);
+            if(optionName == "thread-nice") settings_ptr->setThreadNiceLevel(threadRole, value);
+        }
+    }
+    return true;
+}
+
+/**
+ * Creates the theme with the given name, "auto" picks the default theme of the platform.
+ * Names ending in .theme are theme files, see FileTheme. Returns nullptr for unknown names.
+ */
+std::shared_ptr<ITheme> createTheme(std::string name)
+{
+    if(name == "auto")
+    {
 #if defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    auto theme_ptr = std::make_shared<StandardThemeWindows>();
+        name = "ascii";
 #else
-    auto theme_ptr = std::make_shared<StandardTheme>();
+        name = "standard";
 #endif
-    auto inputBuffer_ptr = std::make_shared<InputBuffer>();
+    }
+    if(name == "standard") return std::make_shared<StandardTheme>();
+    if(name == "ascii") return std::make_shared<StandardThemeWindows>();
+    if(name == "compact") return std::make_shared<CompactTheme>();
+    if(name == "monochrome") return std::make_shared<MonochromeTheme>();
+    if(name.size() > 6 && name.substr(name.size() - 6) == ".theme") return FileTheme::load(name);
+    return nullptr;
+}
+
+int main(int argc, char** argv){
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    settings_ptr->setReplayRecordingPath(getOption(argc, argv, "record", settings_ptr->getReplayRecordingPath()));
+    settings_ptr->setPerformanceCounters(settings_ptr->getPerformanceCounters() || hasFlag(argc, argv, "perf-counters"));
+    settings_ptr->setMemoryReport(settings_ptr->getMemoryReport() || hasFlag(argc, argv, "memory-report"));
+    // Classic input: the starship only moves on every starship gametick, like before immediate input.
+    settings_ptr->setImmediateStarshipInput(settings_ptr->getImmediateStarshipInput() && !hasFlag(argc, argv, "tick-aligned-input"));
+    if(!applyThreadOptions(argc, argv, settings_ptr))
+    {
+        return 1;
+    }
+    auto resumePath = getOption(argc, argv, "resume", "");
+    // A game resumed from a state mirror of a crash leaves the mirror as it is, any other resumed game keeps saving to the file it came from.
+    auto resumeFromMirror = !resumePath.empty() && StateMirror::isStateMirror(resumePath);
+    auto autosavePath = resumePath.empty() || resumeFromMirror ? settings_ptr->getAutosavePath() : resumePath;
+    settings_ptr->setAutosavePath(getOption(argc, argv, "autosave", autosavePath));
+    settings_ptr->setStateMirrorPath(getOption(argc, argv, "state-mirror", settings_ptr->getStateMirrorPath()));
+    auto replayPaths = getOptions(argc, argv, "replay");
+    auto lockstepHostPath = getOption(argc, argv, "lockstep-host", "");
+    auto lockstepJoinPath = getOption(argc, argv, "lockstep-join", "");
+
+    // Only a new game needs a field, it is generated while the theme, the console and the keylistener are set up.
+    std::unique_ptr<GamePregenerator> pregenerator_ptr = nullptr;
+    if(resumePath.empty() && replayPaths.empty() && lockstepHostPath.empty() && lockstepJoinPath.empty())
+    {
+        pregenerator_ptr = std::make_unique<GamePregenerator>(settings_ptr, std::random_device{}(), 1);
+    }
+
+    // Initialize Objects
+    auto themeName = getOption(argc, argv, "theme", settings_ptr->getTheme());
+    std::shared_ptr<ITheme> theme_ptr;
+    try
+    {
+        theme_ptr = createTheme(themeName);
+    }
+    catch(const std::logic_error &error)
+    {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    if(theme_ptr == nullptr)
+    {
+        std::cerr << "Unknown theme '" << themeName << "', use auto, standard, ascii, compact, monochrome or a .theme file." << std::endl;
+        return 1;
+    }
+    // Single byte and monochrome fallbacks for slow terminals.
+    auto asciiTheme_ptr = std::make_shared<CompactTheme>();
+    auto monochromeTheme_ptr = std::make_shared<MonochromeTheme>();
+    auto ui_ptr = std::make_shared<ConsoleOutput>(asciiTheme_ptr, monochromeTheme_ptr);
+
+    // Play back recorded games instead of starting a new one.
+    if(replayPaths.empty() && hasFlag(argc, argv, "headless"))
+    {
+        std::cerr << "--headless needs at least one --replay." << std::endl;
+        return 1;
+    }
+    if(!replayPaths.empty())
+    {
+        // Headless: as fast as possible, e.g. with the output sent to /dev/null as training workload of the optimized build.
+        auto headless = hasFlag(argc, argv, "headless");
+        auto repeat = std::stoi(getOption(argc, argv, "repeat", "1"));
+        auto fromGameTick = std::stoi(getOption(argc, argv, "from", "0"));
+        long gameTicks = 0;
+        auto start = std::chrono::steady_clock::now();
+        for(int run = 0; run < repeat; run++)
+        {
+            for(auto &replayPath : replayPaths)
+            {
+                try
+                {
+                    auto reader_ptr = std::make_shared<ReplayReader>(replayPath, settings_ptr);
+                    ReplayPlayer player(reader_ptr, ui_ptr, theme_ptr);
+                    gameTicks += player.play(fromGameTick, !headless);
+                }
+                catch(const std::exception &exception)
+                {
+                    std::cerr << "Can't play replay '" << replayPath << "': " << exception.what() << std::endl;
+                    return 1;
+                }
+            }
+        }
+        if(headless)
+        {
+            auto nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            std::cerr << "Replayed " << gameTicks << " gameticks in " << (long) (nanoseconds / 1000000) << " ms, "
+                      << (long) (nanoseconds / std::max(gameTicks, 1L)) << " ns per gametick" << std::endl;
+        }
+        if(settings_ptr->getMemoryReport())
+        {
+            std::cerr << MemoryAccount::report();
+        }
+        return 0;
+    }
+
+    auto inputBuffer_ptr = std::allocate_shared<InputBuffer>(AccountedAllocator<InputBuffer, MemorySubsystem::inputMemory>());
     auto menuLogic = std::make_shared<MenuLogic>(theme_ptr, ui_ptr, inputBuffer_ptr);
 
-    GameLogic gameLogic(inputBuffer_ptr, ui_ptr, theme_ptr, menuLogic);
+    GameLogic gameLogic(inputBuffer_ptr, ui_ptr, theme_ptr, menuLogic, settings_ptr);
 
     // Initialize Keylistener
     Keylistener keylistener;
@@ -64,8 +280,69 @@ int main(int argc, char** argv){
         inputBuffer_ptr->setBreakoutMenu();
     });
 
+    // Two player game with another process on this machine: one side hosts it at a socket path, the other one joins.
+    if(!lockstepHostPath.empty() || !lockstepJoinPath.empty())
+    {
+        std::shared_ptr<SocketLockstepLink> link_ptr;
+        try
+        {
+            if(!lockstepHostPath.empty())
+            {
+                std::cout << "Waiting for the other player at " << lockstepHostPath << " ..." << std::endl;
+                link_ptr = SocketLockstepLink::host(lockstepHostPath, std::random_device{}(), *settings_ptr);
+            }
+            else
+            {
+                link_ptr = SocketLockstepLink::join(lockstepJoinPath, *settings_ptr);
+            }
+        }
+        catch(const std::exception &exception)
+        {
+            std::cerr << "Can't start the lockstep game: " << exception.what() << std::endl;
+            return 1;
+        }
+        auto localPlayer = lockstepHostPath.empty() ? 1 : 0;
+        LockstepGameLogic lockstepGameLogic(inputBuffer_ptr, ui_ptr, theme_ptr, settings_ptr, link_ptr, link_ptr->getSeed(), localPlayer);
+        keylistener.startMultithreaded(settings_ptr->getThreadPlacement(ThreadRole::inputThread));
+        settings_ptr->getThreadPlacement(ThreadRole::gameThread).applyToCurrentThread();
+        lockstepGameLogic.play();
+        keylistener.stop();
+        return 0;
+    }
+
     // Run game
-    keylistener.startMultithreaded();
-    gameLogic.startNew();
+    std::shared_ptr<SaveState> resumedState_ptr = nullptr;
+    if(!resumePath.empty())
+    {
+        try
+        {
+            resumedState_ptr = resumeFromMirror ? StateMirror::load(resumePath, settings_ptr) : Autosaver::load(resumePath, settings_ptr);
+        }
+        catch(const std::exception &exception)
+        {
+            std::cerr << "Can't resume game '" << resumePath << "': " << exception.what() << std::endl;
+            return 1;
+        }
+    }
+
+    keylistener.startMultithreaded(settings_ptr->getThreadPlacement(ThreadRole::inputThread));
+    settings_ptr->getThreadPlacement(ThreadRole::gameThread).applyToCurrentThread();
+    if(resumedState_ptr != nullptr)
+    {
+        gameLogic.continueGame(resumedState_ptr);
+    }
+    else
+    {
+        gameLogic.startNew(*pregenerator_ptr);
+    }
     keylistener.stop();
+
+    if(gameLogic.getProfiler() != nullptr)
+    {
+        std::cout << "\r\n" << gameLogic.getProfiler()->report() << std::endl;
+    }
+    if(settings_ptr->getMemoryReport())
+    {
+        std::cout << "\r\n" << MemoryAccount::report() << std::endl;
+    }
 }
\ No newline at end of file
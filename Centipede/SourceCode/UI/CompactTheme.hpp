@@ -0,0 +1,81 @@
+#ifndef COMPACT_THEME_HPP
+#define COMPACT_THEME_HPP
+#include "MonochromeTheme.hpp"
+#include "../../lib/console_lib.hpp"
+
+/**
+ * Theme for low-bandwidth sessions: the single byte glyphs of the MonochromeTheme with a few of its own.
+ * Colours are only set once per frame, mushroom health is shown by the glyph instead of a colour sequence per cell.
+ */
+class CompactTheme
+    : public MonochromeTheme
+{
+    private:
+        AnsiExcapeCodes ansiExcapeCodes;
+        std::string backgroundColour;
+        std::string foregroundColour;
+
+    public:
+        CompactTheme()
+        {
+            this->backgroundColour = this->ansiExcapeCodes.backgroundBlack;
+            this->foregroundColour = this->ansiExcapeCodes.foregroundWhite;
+        }
+
+        std::string getColourSetupStart() override
+        {
+            return this->backgroundColour + this->foregroundColour;
+        }
+
+        std::string getColourSetupEnd() override
+        {
+            return this->ansiExcapeCodes.backgroundDefault + this->ansiExcapeCodes.foregroundDefault;
+        }
+
+        std::string getBullet() override
+        {
+            return "'";
+        }
+
+        std::string getFieldEdgeTop() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeLeft() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeBottom() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeRight() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeTopRightCorner() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeTopLeftCorner() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeBottomRightCorner() override
+        {
+            return "#";
+        }
+
+        std::string getFieldEdgeBottomLeftCorner() override
+        {
+            return "#";
+        }
+};
+
+#endif
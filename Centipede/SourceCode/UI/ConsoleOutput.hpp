@@ -1,10 +1,24 @@
 #ifndef CONSOLEOUTPUT_HPP
 #define CONSOLEOUTPUT_HPP
 #include <iostream>
+#include <chrono>
+#include <map>
+#include <string_view>
+#include <tuple>
+#include "ConsoleWriter.hpp"
+#include "OutputBandwidthMonitor.hpp"
+#include "GlyphCanvas.hpp"
+#include "GlyphTable.hpp"
+#include "GlyphRowSerializer.hpp"
+#include "ThemeAtlas.hpp"
+#include "MenuLayout.hpp"
+#include "RenderedFrame.hpp"
 #include "../../lib/console_lib.hpp"
+#include "../BusinessLogic/Heatmap.hpp"
 #include "../Common/CentipedeSettings.hpp"
 #include "../Common/ITheme.hpp"
 #include "../Common/IUI.hpp"
+#include "../Common/MemoryAccounting.hpp"
 #include "../GameObjects/SaveState.hpp"
 #include "../GameObjects/MushroomMap.hpp"
 #include "../GameObjects/CentipedeHead.hpp"
@@ -14,236 +28,282 @@
 class ConsoleOutput : public IUI
 {
 	private:
+		// Length of the windows in which the output quality is re-evaluated.
+		static constexpr int bandwidthWindowLength = 500;
+
+		ConsoleWriter writer;
+		OutputBandwidthMonitor bandwidthMonitor;
+		std::chrono::steady_clock::time_point lastFlush;
+		std::shared_ptr<ITheme> asciiTheme_ptr;
+		std::shared_ptr<ITheme> monochromeTheme_ptr;
+		/**
+		 * Lines of the last frame handed to the terminal and the theme it was drawn in.
+		 * Empty if the screen shows anything else, e.g. a menu.
+		 */
+		RenderedFrame displayedLines;
+		ITheme *displayedTheme;
+		std::shared_ptr<GlyphCanvas> canvas_ptr;
+		// Score, round and heart line of the last frame and the values they show.
+		RenderedFrame hudLines;
+		std::tuple<int, int, int, int, ThemeAtlas*> hudKey;
+		// Layout of the last menu, and whether the screen still shows it.
+		std::shared_ptr<MenuLayout> menuLayout_ptr;
+		bool isMenuDisplayed;
+		// Every theme is compiled once, on first use.
+		std::map<ITheme*, std::shared_ptr<ThemeAtlas>> atlases;
+
 		/**
 		 * Frames the given image
 		 */
-		void writeToConsole(std::string &image, ITheme &theme)
+		void writeToConsole(std::string_view image, ThemeAtlas &atlas)
 		{
 			AnsiExcapeCodes ansiExcapeCodes;
 
 			// Clear screen
-			std::cout << ansiExcapeCodes.eraseInDisplay;
+			RenderedLine output(ansiExcapeCodes.eraseInDisplay);
 			// Prepare colours
-			std::cout << theme.getColourSetupStart();
+			output += atlas.get(ThemeElement::colourSetupStartElement);
 			// Output frame of game
-			std::cout << image;
+			output += image;
 			// End colours
-			std::cout << theme.getColourSetupEnd();
+			output += atlas.get(ThemeElement::colourSetupEndElement);
+
+			this->writer.write(output);
+			this->lastFlush = std::chrono::steady_clock::now();
 		}
 
-		/**
-		 * Returns a string consisting of the exact number of white-spaces to fill the line.
-		 */
-		std::string getFillingSpaces(int numberOfColumns, int takenSpace, ITheme &theme)
+		void rememberDisplayedLines(RenderedFrame &lines)
 		{
-			std::string fillingSpaces = "";
-			// "+ 2" is necessary because of the border around the game.
-			int numberOfSpaces = (numberOfColumns + 2) - takenSpace;
-			for(int i = 0; i < numberOfSpaces; i++)
+			this->displayedLines.resize(lines.size());
+			for(size_t line = 0; line < lines.size(); line++)
 			{
-				fillingSpaces += theme.getWhiteSpace();
+				this->displayedLines[line].assign(lines[line]);
 			}
-			return fillingSpaces;
 		}
 
 		/**
-		 * Prints a text on the output. 
-		 * If it is too wide, it cuts hard at max width and continues in a new line until the entire text is printed.
+		 * Writes all lines of the frame on a cleared screen and returns the number of bytes.
 		 */
-		std::string getTextLineWithWrapping(int leftPadding, 
-											int rightPadding, 
-											int numberOfColumns, 
-											std::string &text, 
-											std::string &newLine,
-											ITheme &theme)
+		size_t writeFullFrame(RenderedFrame &lines, ITheme &theme)
 		{
-			int maxTextWidth = numberOfColumns + 2 - leftPadding - rightPadding;
-			std::string output;
-			while(text.size() > maxTextWidth)
+			this->isMenuDisplayed = false;
+			std::string_view newLine = "\r\n";
+			RenderedLine image;
+			for(auto &line : lines)
 			{
-				output += theme.getWhiteSpace() + text.substr(0, maxTextWidth) + theme.getWhiteSpace() + newLine;
-				text = text.substr(maxTextWidth);
+				image += line;
+				image += newLine;
 			}
-			output += theme.getWhiteSpace() + text + this->getFillingSpaces(numberOfColumns, text.size() + 1, theme) + newLine;
-			return output;
+			this->writeToConsole(image, this->getAtlas(theme));
+
+			this->rememberDisplayedLines(lines);
+			this->displayedTheme = &theme;
+			return image.size();
 		}
 
-		std::string decorateText(std::string &text, ConsoleTextDecoration decoration, ITheme &theme)
+		/**
+		 * Overwrites only the lines, that differ from the displayed frame, and returns the number of bytes.
+		 */
+		size_t writeChangedLines(RenderedFrame &lines, ITheme &theme)
 		{
-			AnsiExcapeCodes ansiExcapeCodes;
-			switch (decoration)
+			RenderedLine changes;
+			for(size_t line = 0; line < lines.size(); line++)
 			{
-				case ConsoleTextDecoration::Bold:
-					return ansiExcapeCodes.boldOn + text + ansiExcapeCodes.boldOff;
-				case ConsoleTextDecoration::Italics:
-					return ansiExcapeCodes.italicsOn + text + ansiExcapeCodes.italicsOff;
-				case ConsoleTextDecoration::Strikethrough:
-					return ansiExcapeCodes.strikethroughOn + text + ansiExcapeCodes.strikethroughOff;
-				case ConsoleTextDecoration::Underlined:
-					return ansiExcapeCodes.underlineOn + text + ansiExcapeCodes.underlineOff;
-				default:
-					return text;
+				if(line < this->displayedLines.size() && this->displayedLines[line] == lines[line])
+				{
+					continue;
+				}
+				changes += AnsiExcapeCodes::cursorPosition(line + 1, 1);
+				changes += lines[line];
 			}
+			if(changes.empty())
+			{
+				// Nothing changed, nothing to send.
+				return 0;
+			}
+
+			// Leave the cursor below the frame, like a full frame does.
+			auto &atlas = this->getAtlas(theme);
+			RenderedLine output(atlas.get(ThemeElement::colourSetupStartElement));
+			output += changes;
+			output += atlas.get(ThemeElement::colourSetupEndElement);
+			output += AnsiExcapeCodes::cursorPosition(lines.size() + 1, 1);
+			this->writer.write(output);
+			this->lastFlush = std::chrono::steady_clock::now();
+
+			this->rememberDisplayedLines(lines);
+			return output.size();
 		}
 
-		std::string colourText(std::string &text, ConsoleColour colour, ITheme &theme, bool background = false)
+		/**
+		 * Pushes pending output to the terminal and measures its throughput while it is saturated.
+		 */
+		void flushPendingOutput()
 		{
-			AnsiExcapeCodes ansiExcapeCodes;
-			if(background)
+			auto now = std::chrono::steady_clock::now();
+			bool wasSaturated = this->writer.hasPending();
+			auto written = this->writer.flush();
+			if(wasSaturated && this->writer.hasPending())
 			{
-				switch (colour)
-				{
-					case ConsoleColour::Black:
-						return ansiExcapeCodes.backgroundBlack + text + theme.getColourSetupStart();
-					case ConsoleColour::Blue:
-						return ansiExcapeCodes.backgroundBlue + text + theme.getColourSetupStart();
-					case ConsoleColour::Cyan:
-						return ansiExcapeCodes.backgroundCyan + text + theme.getColourSetupStart();
-					case ConsoleColour::Default:
-						return ansiExcapeCodes.backgroundDefault + text + theme.getColourSetupStart();
-					case ConsoleColour::Green:
-						return ansiExcapeCodes.backgroundGreen + text + theme.getColourSetupStart();
-					case ConsoleColour::Magenta:
-						return ansiExcapeCodes.backgroundMagenta + text + theme.getColourSetupStart();
-					case ConsoleColour::Red:
-						return ansiExcapeCodes.backgroundRed + text + theme.getColourSetupStart();
-					case ConsoleColour::White:
-						return ansiExcapeCodes.backgroundWhite + text + theme.getColourSetupStart();
-					case ConsoleColour::Yellow:
-						return ansiExcapeCodes.backgroundYellow + text + theme.getColourSetupStart();
-					default:
-						return text;
-				}
+				this->bandwidthMonitor.recordSaturatedThroughput(written, now - this->lastFlush);
 			}
-			switch (colour)
+			this->lastFlush = now;
+		}
+
+		/**
+		 * Returns the theme a frame of the given quality is drawn in.
+		 */
+		ITheme &getThemeForQuality(OutputQuality quality, ITheme &theme)
+		{
+			switch (quality)
 			{
-				case ConsoleColour::Black:
-					return ansiExcapeCodes.foregroundBlack + text + theme.getColourSetupStart();
-				case ConsoleColour::Blue:
-					return ansiExcapeCodes.foregroundBlue + text + theme.getColourSetupStart();
-				case ConsoleColour::Cyan:
-					return ansiExcapeCodes.foregroundCyan + text + theme.getColourSetupStart();
-				case ConsoleColour::Default:
-					return ansiExcapeCodes.foregroundDefault + text + theme.getColourSetupStart();
-				case ConsoleColour::Green:
-					return ansiExcapeCodes.foregroundGreen + text + theme.getColourSetupStart();
-				case ConsoleColour::Magenta:
-					return ansiExcapeCodes.foregroundMagenta + text + theme.getColourSetupStart();
-				case ConsoleColour::Red:
-					return ansiExcapeCodes.foregroundRed + text + theme.getColourSetupStart();
-				case ConsoleColour::White:
-					return ansiExcapeCodes.foregroundWhite + text + theme.getColourSetupStart();
-				case ConsoleColour::Yellow:
-					return ansiExcapeCodes.foregroundYellow + text + theme.getColourSetupStart();
+				case OutputQuality::asciiGlyphs:
+					return *(this->asciiTheme_ptr);
+				case OutputQuality::monochrome:
+					return *(this->monochromeTheme_ptr);
 				default:
-					return text;
+					return theme;
 			}
 		}
 
+		/**
+		 * Returns the exact number of white-spaces to fill the line, cut from the white space buffer of the theme.
+		 */
+		std::string_view getFillingSpaces(int numberOfColumns, int takenSpace, ThemeAtlas &atlas)
+		{
+			// "+ 2" is necessary because of the border around the game.
+			return atlas.getWhiteSpaces((numberOfColumns + 2) - takenSpace);
+		}
+
         // //////////////////////////////////////////////////
         // In Game Image rendering
         // //////////////////////////////////////////////////
 
 		/**
-		 * Renders a border and the score around a given image of GameObjects. Returns the result as single string.
+		 * Renders a border and the score around a given image of GameObjects. Returns the result line by line.
+		 * Every line of the image is allocated once in its exact size and serialized row by row.
 		 */
-		std::shared_ptr<std::string> renderFrame(int round, int lives, int score, std::shared_ptr<std::vector<std::vector<std::string>>> image, ITheme &theme)
+		std::shared_ptr<RenderedFrame> renderFrame(int round, int lives, int score, GlyphCanvas &image, ThemeAtlas &atlas)
 		{
 			AnsiExcapeCodes ansiExcapeCodes;
-			std::string newLine = "\r\n";
-			std::string output = "";
-			int numberOfColumns = (*image)[0].size();
+			auto output = std::allocate_shared<RenderedFrame>(AccountedAllocator<RenderedFrame, MemorySubsystem::renderMemory>());
+			int numberOfColumns = image.getColumns();
 
-			// Top line with score and round.
-			std::string scoreText = "Score: " + std::to_string(score);
-			std::string roundText = "Round: " + std::to_string(round);
-			output += ansiExcapeCodes.boldOn + scoreText;
-			output += getFillingSpaces(numberOfColumns, scoreText.size() + roundText.size(), theme);
-			output += roundText + ansiExcapeCodes.boldOff + newLine;
+			// The lines above the field only change with the score, the round or the lives.
+			auto hudKey = std::make_tuple(round, lives, score, numberOfColumns, &atlas);
+			if(this->hudLines.empty() || hudKey != this->hudKey)
+			{
+				this->hudLines.clear();
+				this->hudKey = hudKey;
+
+				// Top line with score and round.
+				std::string scoreText = "Score: " + std::to_string(score);
+				std::string roundText = "Round: " + std::to_string(round);
+				RenderedLine infoLine(ansiExcapeCodes.boldOn);
+				infoLine += scoreText;
+				infoLine += getFillingSpaces(numberOfColumns, scoreText.size() + roundText.size(), atlas);
+				infoLine += roundText;
+				infoLine += ansiExcapeCodes.boldOff;
+				this->hudLines.push_back(std::move(infoLine));
+
+				// Second line with hearts.
+				RenderedLine heartLine(atlas.get(GlyphId::whiteSpaceGlyph)); // Indent to match the inner Playing-Field.
+				for(int i = 0; i < lives; i++) heartLine += atlas.get(ThemeElement::heartElement);
+				heartLine += getFillingSpaces(numberOfColumns, lives + 1, atlas);
+				this->hudLines.push_back(std::move(heartLine));
+			}
+			output->push_back(this->hudLines[0]);
+			output->push_back(this->hudLines[1]);
 
-			// Second line with hearts.
-			output += theme.getWhiteSpace(); // Indent to match the inner Playing-Field.
-			for(int i = 0; i < lives; i++) output += theme.getHeart();
-			output += getFillingSpaces(numberOfColumns, lives + 1, theme) + newLine;
+			this->renderField(image, atlas, *output);
+			return output;
+		}
 
+		/**
+		 * Appends the image with the field edges around it to the lines of a frame.
+		 */
+		void renderField(GlyphCanvas &image, ThemeAtlas &atlas, RenderedFrame &output)
+		{
+			int numberOfColumns = image.getColumns();
 
 			// Upper field edge:
-			output += theme.getFieldEdgeTopLeftCorner();
+			RenderedLine edgeLine(atlas.get(ThemeElement::fieldEdgeTopLeftCornerElement));
+			auto topEdge = atlas.get(ThemeElement::fieldEdgeTopElement);
 			for(int column = 0; column < numberOfColumns; column++)
 			{
-				output += theme.getFieldEdgeTop();
+				edgeLine += topEdge;
 			}
-			output += theme.getFieldEdgeTopRightCorner();
-			output += newLine;
+			edgeLine += atlas.get(ThemeElement::fieldEdgeTopRightCornerElement);
+			output.push_back(std::move(edgeLine));
 
 			// Build image 
-			for(auto line : *image)
+			auto &serializer = atlas.getRowSerializer();
+			auto &glyphs = serializer.getGlyphTable();
+			auto leftEdge = atlas.get(ThemeElement::fieldEdgeLeftElement);
+			auto rightEdge = atlas.get(ThemeElement::fieldEdgeRightElement);
+			for(int line = 0; line < image.getLines(); line++)
 			{
+				auto cells = image.getLine(line);
+				RenderedLine imageLine;
+				imageLine.reserve(leftEdge.size() + glyphs.getByteSize(cells, numberOfColumns) + rightEdge.size());
 				// Start line with field edge
-				output += theme.getFieldEdgeLeft();
+				imageLine += leftEdge;
 				// Content
-				for(auto column : line)
-				{
-					output += column;
-				}
+				serializer.serialize(cells, numberOfColumns, imageLine);
 				// End line with field edge
-				output += theme.getFieldEdgeRight();
-				output += newLine;
+				imageLine += rightEdge;
+				output.push_back(std::move(imageLine));
 			}
 
 			// Lower field edge
-			output += theme.getFieldEdgeBottomLeftCorner();
-			for(int column = 0; column < (*image)[0].size(); column++)
+			edgeLine.assign(atlas.get(ThemeElement::fieldEdgeBottomLeftCornerElement));
+			auto bottomEdge = atlas.get(ThemeElement::fieldEdgeBottomElement);
+			for(int column = 0; column < numberOfColumns; column++)
 			{
-				output += theme.getFieldEdgeBottom();
+				edgeLine += bottomEdge;
 			}
-			output += theme.getFieldEdgeBottomRightCorner();
-			output += newLine;
-
-			return std::make_shared<std::string>(output);
+			edgeLine += atlas.get(ThemeElement::fieldEdgeBottomRightCornerElement);
+			output.push_back(std::move(edgeLine));
 		}
 
 		/**
 		 * Renders all GameObjects on the given canvas.
 		 */
-		void renderGameObjects(std::shared_ptr<std::vector<std::vector<std::string>>> canvas, SaveState &state, ITheme& theme)
+		void renderGameObjects(GlyphCanvas &canvas, SaveState &state)
 		{
-			this->renderBase(canvas, theme);
-			this->renderMushrooms(canvas, state.getMushroomMap(), theme);
-			this->renderCentipedes(canvas, state.getCentipedes(), theme);
-			this->renderBullets(canvas, state.getBullets(), theme);
-			this->renderStarship(canvas, state.getStarship(), theme);
+			this->renderBase(canvas);
+			this->renderMushrooms(canvas, state.getMushroomMap());
+			this->renderCentipedes(canvas, state.getCentipedes());
+			this->renderBullets(canvas, state.getBullets());
+			this->renderStarship(canvas, state.getStarship());
+			if(state.getSecondStarship() != nullptr)
+			{
+				this->renderStarship(canvas, state.getSecondStarship());
+			}
 		}
 
 		/**
 		 * Initializes the Canvas by filling it whith "spaces".
 		 */
-		void renderBase(std::shared_ptr<std::vector<std::vector<std::string>>> canvas, ITheme& theme)
+		void renderBase(GlyphCanvas &canvas)
 		{
-
-			for(int line = 0; line < canvas->size(); line++)
-			{
-				for(int column = 0; column < (*canvas)[line].size(); column++)
-				{
-					(*canvas)[line][column] = theme.getWhiteSpace();
-				}
-			}
+			canvas.clear();
 		}
 
 		/**
 		 * Renders the mushrooms with individual health on the canvas.
 		 */
-		void renderMushrooms(std::shared_ptr<std::vector<std::vector<std::string>>> canvas, std::shared_ptr<MushroomMap> mushroomMap_ptr, ITheme& theme)
+		void renderMushrooms(GlyphCanvas &canvas, std::shared_ptr<MushroomMap> mushroomMap_ptr)
 		{
-			for(int line = 0; line < canvas->size(); line++)
+			for(int line = 0; line < canvas.getLines(); line++)
 			{
-				for(int column = 0; column < (*canvas)[line].size(); column++)
+				for(int column = 0; column < canvas.getColumns(); column++)
 				{
 					auto health = mushroomMap_ptr->getMushroom(line, column);
 					if(health > 0)
 					{
 						// Mushroom with specific health
-						(*canvas)[line][column] = theme.getMushroom(health);
+						canvas.set(line, column, GlyphTable::getMushroomGlyph(health));
 					}
 					// no mushroom otherwise
 				}
@@ -253,19 +313,19 @@ class ConsoleOutput : public IUI
 		/**
 		 * Renders the centipedes on the canvas.
 		 */
-		void renderCentipedes(std::shared_ptr<std::vector<std::vector<std::string>>> canvas, std::shared_ptr<std::vector<CentipedeHead>> centipedes_ptr, ITheme& theme)
+		void renderCentipedes(GlyphCanvas &canvas, std::shared_ptr<CentipedeList> centipedes_ptr)
 		{
 			for(auto centipede : *centipedes_ptr)
 			{
 				// Head
 				auto headPosition = centipede.getPosition();
-				(*canvas)[headPosition.getLine()][headPosition.getColumn()] = theme.getCentipedeHead();
+				canvas.set(headPosition.getLine(), headPosition.getColumn(), GlyphId::centipedeHeadGlyph);
 				// Tail
 				auto tail = centipede.getTail();
 				while(tail != nullptr)
 				{
 					auto tailPosition = tail->getPosition();
-					(*canvas)[tailPosition.getLine()][tailPosition.getColumn()] = theme.getCentipedeBody();
+					canvas.set(tailPosition.getLine(), tailPosition.getColumn(), GlyphId::centipedeBodyGlyph);
 					// continue recursive
 					tail = tail->getTail();
 				}
@@ -275,44 +335,171 @@ class ConsoleOutput : public IUI
 		/**
 		 * Renders the bullets on the canvas.
 		 */
-		void renderBullets(std::shared_ptr<std::vector<std::vector<std::string>>> canvas, std::shared_ptr<std::vector<Bullet>> bullets_ptr, ITheme& theme)
+		void renderBullets(GlyphCanvas &canvas, std::shared_ptr<BulletVector> bullets_ptr)
 		{
 			for(auto bullet : *bullets_ptr)
 			{
 				auto bulletPosition = bullet.getPosition();
-				(*canvas)[bulletPosition.getLine()][bulletPosition.getColumn()] = theme.getBullet();
+				canvas.set(bulletPosition.getLine(), bulletPosition.getColumn(), GlyphId::bulletGlyph);
 			}
 		}
 
 		/**
 		 * Renders the starship on the canvas.
 		 */
-		void renderStarship(std::shared_ptr<std::vector<std::vector<std::string>>> canvas, std::shared_ptr<Starship> starship_ptr, ITheme& theme)
+		void renderStarship(GlyphCanvas &canvas, std::shared_ptr<Starship> starship_ptr)
 		{
 			auto position = starship_ptr->getPosition();
-			(*canvas)[position.getLine()][position.getColumn()] = theme.getStarship();
+			canvas.set(position.getLine(), position.getColumn(), GlyphId::starshipGlyph);
+		}
+
+		/**
+		 * Returns the compiled theme, it is compiled on first use.
+		 */
+		ThemeAtlas &getAtlas(ITheme &theme)
+		{
+			auto atlas = this->atlases.find(&theme);
+			if(atlas == this->atlases.end())
+			{
+				atlas = this->atlases.emplace(&theme, std::make_shared<ThemeAtlas>(theme)).first;
+			}
+			return *(atlas->second);
+		}
+
+		/**
+		 * Renders the saveState into the lines of a frame.
+		 */
+		std::shared_ptr<RenderedFrame> renderImage(SaveState& state, CentipedeSettings &settings, ITheme& theme)
+		{
+			// The canvas is kept between frames and only recreated if the field size changes.
+			if(this->canvas_ptr == nullptr
+			   || this->canvas_ptr->getLines() != settings.getPlayingFieldHeight()
+			   || this->canvas_ptr->getColumns() != settings.getPlayingFieldWidth())
+			{
+				this->canvas_ptr = std::make_shared<GlyphCanvas>(settings.getPlayingFieldHeight(), settings.getPlayingFieldWidth());
+			}
+
+			// render image.
+			this->renderGameObjects(*(this->canvas_ptr), state);
+			return this->renderFrame(state.getCurrentRound(), state.getLives(), state.getScore(), *(this->canvas_ptr), this->getAtlas(theme));
 		}
 
 	public:
+		/**
+		 * Initializes the output with the themes it falls back to, when the terminal can't keep up.
+		 */
+		ConsoleOutput(std::shared_ptr<ITheme> asciiTheme_ptr, std::shared_ptr<ITheme> monochromeTheme_ptr)
+			: bandwidthMonitor(bandwidthWindowLength), asciiTheme_ptr(asciiTheme_ptr), monochromeTheme_ptr(monochromeTheme_ptr)
+		{
+			this->lastFlush = std::chrono::steady_clock::now();
+			this->displayedTheme = nullptr;
+			this->isMenuDisplayed = false;
+		}
+
+		/**
+		 * Initializes the output, that writes its frames without blocking into the given descriptor instead of the terminal.
+		 */
+		ConsoleOutput(std::shared_ptr<ITheme> asciiTheme_ptr, std::shared_ptr<ITheme> monochromeTheme_ptr, int outputDescriptor)
+			: writer(outputDescriptor), bandwidthMonitor(bandwidthWindowLength), asciiTheme_ptr(asciiTheme_ptr), monochromeTheme_ptr(monochromeTheme_ptr)
+		{
+			this->lastFlush = std::chrono::steady_clock::now();
+			this->displayedTheme = nullptr;
+			this->isMenuDisplayed = false;
+		}
+
+		/**
+		 * Initializes the output, that writes its frames into the given stream instead of the terminal.
+		 */
+		ConsoleOutput(std::shared_ptr<ITheme> asciiTheme_ptr, std::shared_ptr<ITheme> monochromeTheme_ptr, std::ostream &output)
+			: writer(output), bandwidthMonitor(bandwidthWindowLength), asciiTheme_ptr(asciiTheme_ptr), monochromeTheme_ptr(monochromeTheme_ptr)
+		{
+			this->lastFlush = std::chrono::steady_clock::now();
+			this->displayedTheme = nullptr;
+			this->isMenuDisplayed = false;
+		}
+
 		/**
 		 * Displays the image that reflects the current saveState.
+		 * With adaptive output bandwidth, frames are dropped while the terminal is still busy with the previous one
+		 * and the output degrades step by step to diff-only, ASCII and monochrome frames if it can't keep up.
 		 */
 		void displayImage(SaveState& state, CentipedeSettings &settings, ITheme& theme) override
 		{
-			// initialize canvas
-			auto canvas = std::make_shared<std::vector<std::vector<std::string>>>(settings.getPlayingFieldHeight());
-			std::vector<std::string> lineContainer(settings.getPlayingFieldWidth());
-			for(int line = 0; line < settings.getPlayingFieldHeight(); line++)
+			if(!settings.getAdaptiveOutputBandwidth())
 			{
-				(*canvas)[line] = lineContainer;
+				auto frame = this->renderImage(state, settings, theme);
+				this->writeFullFrame(*frame, theme);
+				this->writer.flushBlocking();
+				return;
 			}
 
-			// render image.
-			this->renderGameObjects(canvas, state, theme);
-			auto frame = this->renderFrame(state.getCurrentRound(), state.getLives(), state.getScore(), canvas, theme);
+			this->flushPendingOutput();
+			if(this->writer.hasPending())
+			{
+				// Terminal is still busy -> skip this frame instead of blocking the game.
+				this->bandwidthMonitor.recordDroppedFrame();
+				return;
+			}
+
+			auto quality = this->bandwidthMonitor.getQuality();
+			auto &qualityTheme = this->getThemeForQuality(quality, theme);
+			auto frame = this->renderImage(state, settings, qualityTheme);
+			size_t bytes;
+			if(quality >= OutputQuality::diffOnly && &qualityTheme == this->displayedTheme)
+			{
+				bytes = this->writeChangedLines(*frame, qualityTheme);
+			}
+			else
+			{
+				bytes = this->writeFullFrame(*frame, qualityTheme);
+			}
+			this->bandwidthMonitor.recordSentFrame(bytes);
+		}
+
+		/**
+		 * Displays one layer of the heatmap on the playing field, drawn as mushrooms:
+		 * red in the hottest third of the cells, yellow in the middle and green in the coolest, nothing where the count is 0.
+		 */
+		void displayHeatmap(Heatmap &heatmap, HeatmapLayer layer, std::string title, ITheme &theme)
+		{
+			AnsiExcapeCodes ansiExcapeCodes;
+			GlyphCanvas canvas(heatmap.getLines(), heatmap.getColumns());
+			auto maximum = heatmap.getMaximum(layer);
+			for(int line = 0; line < canvas.getLines(); line++)
+			{
+				for(int column = 0; column < canvas.getColumns(); column++)
+				{
+					auto count = heatmap.get(layer, line, column);
+					if(count == 0)
+					{
+						continue;
+					}
+					// 1 for the hottest third, like the mushroom with the least health.
+					auto level = count * 3 > maximum * 2 ? 1 : (count * 3 > maximum ? 2 : 3);
+					canvas.set(line, column, GlyphTable::getMushroomGlyph(level));
+				}
+			}
 
-			// output 
-			this->writeToConsole(*frame, theme);
+			auto &atlas = this->getAtlas(theme);
+			RenderedFrame lines;
+			std::string maximumText = "Max: " + std::to_string(maximum);
+			RenderedLine titleLine(ansiExcapeCodes.boldOn);
+			titleLine += title;
+			titleLine += this->getFillingSpaces(canvas.getColumns(), title.size() + maximumText.size(), atlas);
+			titleLine += maximumText;
+			titleLine += ansiExcapeCodes.boldOff;
+			lines.push_back(std::move(titleLine));
+			std::string gamesText = "Games: " + std::to_string(heatmap.getGames()) + ", rounds: " + std::to_string(heatmap.getRounds());
+			RenderedLine gamesLine(gamesText);
+			gamesLine += this->getFillingSpaces(canvas.getColumns(), gamesText.size(), atlas);
+			lines.push_back(std::move(gamesLine));
+			this->renderField(canvas, atlas, lines);
+
+			this->writeFullFrame(lines, theme);
+			this->writer.flushBlocking();
+			// The next frame of a game needs to be drawn in full.
+			this->displayedLines.clear();
+			this->displayedTheme = nullptr;
 		}
 
 		/**
@@ -326,74 +513,31 @@ class ConsoleOutput : public IUI
 						 ITheme &theme, 
 						 CentipedeSettings &settings) override
 		{
-			// Preparations
-			std::string output = "";
-			std::string newLine = "\r\n";
+			auto &atlas = this->getAtlas(theme);
 			auto numberOfColumns = settings.getPlayingFieldWidth();
 			auto numberOfLines = settings.getPlayingFieldHeight();
-			auto blankLine = this->getFillingSpaces(numberOfColumns, 0, theme) + newLine;
-			// Blank left and right for nicer image.
-			int leftPadding = 1;
-			int rightPadding = 1;
-			int maxTextWidth = numberOfColumns + 2 - leftPadding - rightPadding;
-			// Two info Lanes at Top and border around game
-			auto totalLines = numberOfLines + 2 + 2;
-			int lineCount = 0;
-
-			// Two blank lines on top.
-			output += blankLine;
-			output += blankLine;
-			lineCount += 2;
-
-			// Title.
-			lineCount += title.size() / maxTextWidth;
-			if(title.size() % maxTextWidth)
+			// Laid out once, moving the selection with the arrow keys reuses the lines.
+			if(this->menuLayout_ptr == nullptr
+			   || !this->menuLayout_ptr->matches(title, titleColour, textLines, options, numberOfColumns, numberOfLines, atlas))
 			{
-				lineCount++;
-			}
-			auto titleLine = this->getTextLineWithWrapping(1, 1, numberOfColumns, title, newLine, theme);
-			titleLine = this->colourText(titleLine, titleColour, theme);
-			titleLine = this->decorateText(titleLine, ConsoleTextDecoration::Bold, theme);
-			output += titleLine;
-			output += blankLine;
-			lineCount++;
-
-			for(int i = 0; i < textLines.size(); i++)
-			{
-				auto line = textLines[i];
-				lineCount += line.size() / maxTextWidth;
-				if(line.size() % maxTextWidth)
-				{
-					lineCount++;
-				}
-				line = this->getTextLineWithWrapping(1, 1, maxTextWidth, line, newLine, theme);
-				output += line;
+				this->menuLayout_ptr = std::make_shared<MenuLayout>(title, titleColour, textLines, options, numberOfColumns, numberOfLines, atlas);
+				this->isMenuDisplayed = false;
 			}
+			auto &lines = this->menuLayout_ptr->select(selected);
 
-			for(int i = 0; i < options.size(); i++)
+			// Only the lines of the previous and the new selection, if the screen already shows the menu.
+			if(this->isMenuDisplayed)
 			{
-				auto option = options[i];
-				lineCount += option.size() / maxTextWidth;
-				if(option.size() % maxTextWidth)
-				{
-					lineCount++;
-				}
-				option = this->getTextLineWithWrapping(1, 1, maxTextWidth, option, newLine, theme);
-				if(i == selected)
-				{
-					option = this->decorateText(option, ConsoleTextDecoration::Bold, theme);
-				}
-				output += option;
+				this->writeChangedLines(lines, theme);
 			}
-
-			while(lineCount < totalLines)
+			else
 			{
-				// Fill up with blank lines
-				output += blankLine;
-				lineCount++;
+				this->writeFullFrame(lines, theme);
 			}
-
-			this->writeToConsole(output, theme);
+			// Menus are never dropped and the next frame needs to be drawn in full.
+			this->writer.flushBlocking();
+			this->isMenuDisplayed = true;
+			this->displayedTheme = nullptr;
 		}
 };
 
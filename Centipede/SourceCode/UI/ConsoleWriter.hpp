@@ -0,0 +1,210 @@
+#ifndef CONSOLE_WRITER_HPP
+#define CONSOLE_WRITER_HPP
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "../Common/MemoryAccounting.hpp"
+
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Writes to the terminal without blocking the calling thread.
+ * Bytes the terminal can't take right away stay pending and are pushed out by later calls of flush().
+ * Falls back to blocking writes on std::cout, if stdout is no terminal or non-blocking output is not supported.
+ * Can also write blocking into any other stream, e.g. a sink that discards the frames in benchmarks.
+ */
+class ConsoleWriter
+{
+    private:
+        /**
+         * Separately opened descriptor of the terminal, -1 if writing blocking to the output stream.
+         */
+        int terminal_fd;
+        /**
+         * Stream of the blocking writes.
+         */
+        std::ostream *output_ptr;
+        /**
+         * Bytes that were handed over, but not yet taken by the terminal.
+         */
+        AccountedString<MemorySubsystem::renderMemory> pending;
+        /**
+         * Number of bytes at the beginning of 'pending', that were already written.
+         */
+        size_t pendingOffset;
+
+        /**
+         * Opens the terminal behind stdout a second time with O_NONBLOCK.
+         * A separate open file description is needed, because setting O_NONBLOCK on stdout itself
+         * would also affect stdin if both share the same terminal and break the blocking keylistener.
+         */
+        void openTerminal()
+        {
+            this->terminal_fd = -1;
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+            if(!isatty(STDOUT_FILENO))
+            {
+                return;
+            }
+            auto terminalName = ttyname(STDOUT_FILENO);
+            if(terminalName == nullptr)
+            {
+                return;
+            }
+            this->terminal_fd = open(terminalName, O_WRONLY | O_NOCTTY | O_NONBLOCK);
+#endif
+        }
+
+        /**
+         * Drops the pending bytes, that were already written.
+         */
+        void compactPending()
+        {
+            if(this->pendingOffset == this->pending.size())
+            {
+                this->pending.clear();
+                this->pendingOffset = 0;
+            }
+        }
+
+    public:
+        ConsoleWriter()
+        {
+            this->pendingOffset = 0;
+            this->output_ptr = &std::cout;
+            this->openTerminal();
+        }
+
+        /**
+         * Writes blocking into the given stream instead of the terminal.
+         */
+        ConsoleWriter(std::ostream &output)
+        {
+            this->pendingOffset = 0;
+            this->output_ptr = &output;
+            this->terminal_fd = -1;
+        }
+
+        /**
+         * Writes without blocking into the given descriptor and closes it at the end, e.g. the write end of a pipe.
+         */
+        ConsoleWriter(int descriptor)
+        {
+            this->pendingOffset = 0;
+            this->output_ptr = &std::cout;
+            this->terminal_fd = -1;
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+            this->terminal_fd = descriptor;
+            fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+#endif
+        }
+
+        ~ConsoleWriter()
+        {
+            this->flushBlocking();
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+            if(this->terminal_fd >= 0)
+            {
+                close(this->terminal_fd);
+            }
+#endif
+        }
+
+        /**
+         * Returns true if the output is not blocking.
+         */
+        bool isNonBlocking()
+        {
+            return this->terminal_fd >= 0;
+        }
+
+        /**
+         * Returns true if bytes of previous writes are still waiting for the terminal.
+         */
+        bool hasPending()
+        {
+            return this->pendingOffset < this->pending.size();
+        }
+
+        /**
+         * Queues the text and writes as much of it as the terminal takes right now.
+         */
+        void write(std::string_view text)
+        {
+            if(!this->isNonBlocking())
+            {
+                *(this->output_ptr) << text << std::flush;
+                return;
+            }
+            this->pending.append(text);
+            this->flush();
+        }
+
+        /**
+         * Writes as many pending bytes as the terminal takes without blocking.
+         * Returns the number of bytes written.
+         */
+        size_t flush()
+        {
+            size_t written = 0;
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+            if(!this->hasPending())
+            {
+                return 0;
+            }
+            // Keep the order with everything printed through std::cout.
+            std::cout.flush();
+            while(this->hasPending())
+            {
+                auto result = ::write(this->terminal_fd,
+                                      this->pending.data() + this->pendingOffset,
+                                      this->pending.size() - this->pendingOffset);
+                if(result > 0)
+                {
+                    this->pendingOffset += result;
+                    written += result;
+                    continue;
+                }
+                if(result < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if(result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    // Terminal is full, try again later.
+                    break;
+                }
+                // Terminal is gone, nobody will ever read the rest.
+                this->pendingOffset = this->pending.size();
+            }
+            this->compactPending();
+#endif
+            return written;
+        }
+
+        /**
+         * Waits until all pending bytes are written.
+         */
+        void flushBlocking()
+        {
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+            while(this->hasPending())
+            {
+                this->flush();
+                if(!this->hasPending())
+                {
+                    return;
+                }
+                pollfd terminal = { this->terminal_fd, POLLOUT, 0 };
+                poll(&terminal, 1, -1);
+            }
+#endif
+        }
+};
+
+#endif
@@ -0,0 +1,342 @@
+#ifndef FILE_THEME_HPP
+#define FILE_THEME_HPP
+#include "../Common/ITheme.hpp"
+#include "../../lib/console_lib.hpp"
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Theme defined in a data file instead of code, so themes can be shipped without rebuilding the game.
+ * One setting per line, # starts a comment:
+ *   background = black                 colour of the field: black, red, green, yellow, blue, magenta, cyan, white, default or none
+ *   foreground = white                 colour of the glyphs, none for no colour sequences at all
+ *   starship = "▴"                     glyph of an element, quoted or as is
+ *   mushroom_1 = "⚘" red               glyph with its own foreground colour
+ *   edge = "#"                         all pieces of the border, single pieces like edge_top_left override it
+ * Elements: white_space, centipede_body, centipede_head, mushroom_1, mushroom_2, mushroom_3, starship, bullet, heart,
+ * edge_top, edge_left, edge_bottom, edge_right, edge_top_left, edge_top_right, edge_bottom_left, edge_bottom_right.
+ * All output bytes are composed once while loading.
+ */
+class FileTheme
+    : public ITheme
+{
+    private:
+        static constexpr const char *elementNames[] = {
+            "white_space", "centipede_body", "centipede_head", "mushroom_1", "mushroom_2", "mushroom_3", "starship", "bullet", "heart",
+            "edge_top", "edge_left", "edge_bottom", "edge_right", "edge_top_left", "edge_top_right", "edge_bottom_left", "edge_bottom_right"
+        };
+        // Same order as the names.
+        enum Element : int
+        {
+            whiteSpace, centipedeBody, centipedeHead, mushroomLow, mushroomMedium, mushroomFull, starship, bullet, heart,
+            edgeTop, edgeLeft, edgeBottom, edgeRight, edgeTopLeft, edgeTopRight, edgeBottomLeft, edgeBottomRight,
+            elementCount
+        };
+
+        std::string colourSetupStart;
+        std::string colourSetupEnd;
+        std::vector<std::string> elements;
+
+        /**
+         * Returns the escape sequence of the colour name, "" for none.
+         */
+        static std::string getColourSequence(std::string name, bool background, int lineNumber)
+        {
+            std::map<std::string, std::string> foregrounds = {
+                { "black", AnsiExcapeCodes::foregroundBlack }, { "red", AnsiExcapeCodes::foregroundRed },
+                { "green", AnsiExcapeCodes::foregroundGreen }, { "yellow", AnsiExcapeCodes::foregroundYellow },
+                { "blue", AnsiExcapeCodes::foregroundBlue }, { "magenta", AnsiExcapeCodes::foregroundMagenta },
+                { "cyan", AnsiExcapeCodes::foregroundCyan }, { "white", AnsiExcapeCodes::foregroundWhite },
+                { "default", AnsiExcapeCodes::foregroundDefault }, { "none", "" }
+            };
+            std::map<std::string, std::string> backgrounds = {
+                { "black", AnsiExcapeCodes::backgroundBlack }, { "red", AnsiExcapeCodes::backgroundRed },
+                { "green", AnsiExcapeCodes::backgroundGreen }, { "yellow", AnsiExcapeCodes::backgroundYellow },
+                { "blue", AnsiExcapeCodes::backgroundBlue }, { "magenta", AnsiExcapeCodes::backgroundMagenta },
+                { "cyan", AnsiExcapeCodes::backgroundCyan }, { "white", AnsiExcapeCodes::backgroundWhite },
+                { "default", AnsiExcapeCodes::backgroundDefault }, { "none", "" }
+            };
+            auto &colours = background ? backgrounds : foregrounds;
+            auto colour = colours.find(name);
+            if(colour == colours.end())
+            {
+                throw std::logic_error(getErrorText(lineNumber, "unknown colour '" + name + "'"));
+            }
+            return colour->second;
+        }
+
+        static std::string getErrorText(int lineNumber, std::string problem)
+        {
+            return "Theme file line " + std::to_string(lineNumber) + ": " + problem + ".";
+        }
+
+        /**
+         * Splits a setting into its words, a quoted word may contain spaces and #.
+         * An unquoted # starts a comment.
+         */
+        static std::vector<std::string> splitValue(std::string value, int lineNumber)
+        {
+            std::vector<std::string> words;
+            size_t position = 0;
+            while(position < value.size())
+            {
+                if(value[position] == ' ' || value[position] == '\t')
+                {
+                    position++;
+                    continue;
+                }
+                if(value[position] == '#')
+                {
+                    break;
+                }
+                if(value[position] == '"')
+                {
+                    auto end = value.find('"', position + 1);
+                    if(end == std::string::npos)
+                    {
+                        throw std::logic_error(getErrorText(lineNumber, "missing closing quote"));
+                    }
+                    words.push_back(value.substr(position + 1, end - position - 1));
+                    position = end + 1;
+                    continue;
+                }
+                auto end = value.find_first_of(" \t", position);
+                end = end == std::string::npos ? value.size() : end;
+                words.push_back(value.substr(position, end - position));
+                position = end;
+            }
+            return words;
+        }
+
+        static int findElement(std::string &name)
+        {
+            for(int element = 0; element < elementCount; element++)
+            {
+                if(name == elementNames[element])
+                {
+                    return element;
+                }
+            }
+            return -1;
+        }
+
+    public:
+        /**
+         * Compiles the text of a theme file. Throws a logic_error naming the line of the first mistake.
+         */
+        FileTheme(std::string text)
+            : elements(elementCount)
+        {
+            std::vector<bool> isDefined(elementCount, false);
+            auto hasEdge = false;
+            std::string backgroundName = "default";
+            std::string foregroundName = "default";
+            // Own colour of every element, applied once the foreground of the theme is known.
+            std::vector<std::string> colourNames(elementCount);
+
+            std::istringstream lines(text);
+            std::string line;
+            int lineNumber = 0;
+            while(std::getline(lines, line))
+            {
+                lineNumber++;
+                if(!line.empty() && line.back() == '\r')
+                {
+                    line.pop_back();
+                }
+                auto start = line.find_first_not_of(" \t");
+                if(start == std::string::npos || line[start] == '#')
+                {
+                    continue;
+                }
+                auto separator = line.find('=');
+                if(separator == std::string::npos)
+                {
+                    throw std::logic_error(getErrorText(lineNumber, "expected <name> = <value>"));
+                }
+                auto keyWords = splitValue(line.substr(0, separator), lineNumber);
+                auto valueWords = splitValue(line.substr(separator + 1), lineNumber);
+                if(keyWords.size() != 1 || valueWords.empty() || valueWords.size() > 2)
+                {
+                    throw std::logic_error(getErrorText(lineNumber, "expected <name> = <value>"));
+                }
+                auto key = keyWords[0];
+                if(key == "background" || key == "foreground")
+                {
+                    getColourSequence(valueWords[0], key == "background", lineNumber);
+                    (key == "background" ? backgroundName : foregroundName) = valueWords[0];
+                    continue;
+                }
+                auto element = findElement(key);
+                if(element < 0 && key != "edge")
+                {
+                    throw std::logic_error(getErrorText(lineNumber, "unknown setting '" + key + "'"));
+                }
+                if(valueWords[0].empty())
+                {
+                    throw std::logic_error(getErrorText(lineNumber, "empty glyph"));
+                }
+                auto colourName = valueWords.size() > 1 ? valueWords[1] : "";
+                if(!colourName.empty() && getColourSequence(colourName, false, lineNumber).empty())
+                {
+                    colourName = "";
+                }
+                if(key == "edge")
+                {
+                    hasEdge = true;
+                    for(int edgeElement = Element::edgeTop; edgeElement < elementCount; edgeElement++)
+                    {
+                        if(!isDefined[edgeElement])
+                        {
+                            this->elements[edgeElement] = valueWords[0];
+                            colourNames[edgeElement] = colourName;
+                        }
+                    }
+                    continue;
+                }
+                this->elements[element] = valueWords[0];
+                colourNames[element] = colourName;
+                isDefined[element] = true;
+            }
+
+            for(int element = 0; element < elementCount; element++)
+            {
+                if(!isDefined[element] && !(element >= Element::edgeTop && hasEdge))
+                {
+                    throw std::logic_error("Theme file misses '" + std::string(elementNames[element]) + "'.");
+                }
+            }
+
+            auto foreground = getColourSequence(foregroundName, false, lineNumber);
+            auto background = getColourSequence(backgroundName, true, lineNumber);
+            this->colourSetupStart = background + foreground;
+            this->colourSetupEnd = (background.empty() ? "" : AnsiExcapeCodes::backgroundDefault)
+                                 + (foreground.empty() ? "" : AnsiExcapeCodes::foregroundDefault);
+            for(int element = 0; element < elementCount; element++)
+            {
+                if(!colourNames[element].empty())
+                {
+                    // Back to the foreground of the theme after the glyph, like the built-in themes do.
+                    auto restore = foreground.empty() ? AnsiExcapeCodes::foregroundDefault : foreground;
+                    this->elements[element] = getColourSequence(colourNames[element], false, lineNumber) + this->elements[element] + restore;
+                }
+            }
+        }
+
+        /**
+         * Loads and compiles the theme file at the path. Throws a logic_error if it can't be read or is invalid.
+         */
+        static std::shared_ptr<FileTheme> load(std::string path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if(!file)
+            {
+                throw std::logic_error("Theme file '" + path + "' can't be read.");
+            }
+            std::stringstream text;
+            text << file.rdbuf();
+            return std::make_shared<FileTheme>(text.str());
+        }
+
+        std::string getColourSetupStart() override
+        {
+            return this->colourSetupStart;
+        }
+
+        std::string getColourSetupEnd() override
+        {
+            return this->colourSetupEnd;
+        }
+
+        std::string getWhiteSpace() override
+        {
+            return this->elements[Element::whiteSpace];
+        }
+
+        std::string getCentipedeBody() override
+        {
+            return this->elements[Element::centipedeBody];
+        }
+
+        std::string getCentipedeHead() override
+        {
+            return this->elements[Element::centipedeHead];
+        }
+
+        std::string getMushroom(int health) override
+        {
+            switch (health)
+            {
+            case 0:
+                return this->getWhiteSpace();
+            case 1:
+                return this->elements[Element::mushroomLow];
+            case 2:
+                return this->elements[Element::mushroomMedium];
+            default: // health >= 3
+                return this->elements[Element::mushroomFull];
+            }
+        }
+
+        std::string getStarship() override
+        {
+            return this->elements[Element::starship];
+        }
+
+        std::string getBullet() override
+        {
+            return this->elements[Element::bullet];
+        }
+
+        std::string getHeart() override
+        {
+            return this->elements[Element::heart];
+        }
+
+        std::string getFieldEdgeTop() override
+        {
+            return this->elements[Element::edgeTop];
+        }
+
+        std::string getFieldEdgeLeft() override
+        {
+            return this->elements[Element::edgeLeft];
+        }
+
+        std::string getFieldEdgeBottom() override
+        {
+            return this->elements[Element::edgeBottom];
+        }
+
+        std::string getFieldEdgeRight() override
+        {
+            return this->elements[Element::edgeRight];
+        }
+
+        std::string getFieldEdgeTopRightCorner() override
+        {
+            return this->elements[Element::edgeTopRight];
+        }
+
+        std::string getFieldEdgeTopLeftCorner() override
+        {
+            return this->elements[Element::edgeTopLeft];
+        }
+
+        std::string getFieldEdgeBottomRightCorner() override
+        {
+            return this->elements[Element::edgeBottomRight];
+        }
+
+        std::string getFieldEdgeBottomLeftCorner() override
+        {
+            return this->elements[Element::edgeBottomLeft];
+        }
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef GLYPH_CANVAS_HPP
+#define GLYPH_CANVAS_HPP
+#include "GlyphTable.hpp"
+#include "../Common/MemoryAccounting.hpp"
+#include <algorithm>
+#include <vector>
+
+/**
+ * The playing field as one flat array of glyph ids, stored line by line.
+ */
+class GlyphCanvas
+{
+	private:
+		int lines;
+		int columns;
+		AccountedVector<GlyphId, MemorySubsystem::renderMemory> cells;
+
+	public:
+		GlyphCanvas(int lines, int columns)
+			: lines(lines), columns(columns), cells(lines * columns, GlyphId::whiteSpaceGlyph)
+		{
+		}
+
+		int getLines()
+		{
+			return this->lines;
+		}
+
+		int getColumns()
+		{
+			return this->columns;
+		}
+
+		/**
+		 * Returns the first cell of the line, the remaining cells of the line follow directly.
+		 */
+		GlyphId *getLine(int line)
+		{
+			return this->cells.data() + line * this->columns;
+		}
+
+		GlyphId get(int line, int column)
+		{
+			return this->cells[line * this->columns + column];
+		}
+
+		void set(int line, int column, GlyphId glyph)
+		{
+			this->cells[line * this->columns + column] = glyph;
+		}
+
+		/**
+		 * Fills every cell with white space.
+		 */
+		void clear()
+		{
+			std::fill(this->cells.begin(), this->cells.end(), GlyphId::whiteSpaceGlyph);
+		}
+};
+
+#endif
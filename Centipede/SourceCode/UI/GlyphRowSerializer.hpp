@@ -0,0 +1,253 @@
+#ifndef GLYPH_ROW_SERIALIZER_HPP
+#define GLYPH_ROW_SERIALIZER_HPP
+#include "GlyphTable.hpp"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define GLYPH_ROW_SERIALIZER_X86
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define GLYPH_ROW_SERIALIZER_NEON
+#endif
+
+/**
+ * Ways a row of glyph ids can be turned into output bytes, from the fastest to the most general.
+ */
+enum GlyphSerialization : int
+{
+	singleByteLookup,
+	fixedWidthCopy,
+	variableWidthCopy
+};
+
+/**
+ * Turns whole rows of a GlyphCanvas into output bytes.
+ * - Single byte themes: table lookup of 16 or 32 cells at once with a vector shuffle (SSSE3/AVX2 or NEON).
+ * - Themes whose glyphs all have the same width: one fixed size copy per cell.
+ * - Any other theme: one copy of the glyph's length per cell.
+ */
+class GlyphRowSerializer
+{
+	private:
+		static constexpr int lookupTableSize = 16;
+
+		std::shared_ptr<GlyphTable> glyphs_ptr;
+		GlyphSerialization serialization;
+		// Byte of every glyph id for single byte themes, unused ids are white space.
+		alignas(16) uint8_t lookupTable[lookupTableSize];
+		// All glyphs one after another and where each of them starts.
+		std::vector<char> atlas;
+		size_t offsets[GlyphId::glyphCount];
+		size_t lengths[GlyphId::glyphCount];
+		bool useAvx2;
+		bool useSsse3;
+
+		static void lookupScalar(const uint8_t *table, const GlyphId *cells, int count, char *destination)
+		{
+			for(int cell = 0; cell < count; cell++)
+			{
+				destination[cell] = table[cells[cell]];
+			}
+		}
+
+#ifdef GLYPH_ROW_SERIALIZER_X86
+		__attribute__((target("ssse3")))
+		static void lookupSsse3(const uint8_t *table, const GlyphId *cells, int count, char *destination)
+		{
+			auto lookup = _mm_loadu_si128((const __m128i*) table);
+			int cell = 0;
+			for(; cell + 16 <= count; cell += 16)
+			{
+				auto ids = _mm_loadu_si128((const __m128i*) (cells + cell));
+				_mm_storeu_si128((__m128i*) (destination + cell), _mm_shuffle_epi8(lookup, ids));
+			}
+			lookupScalar(table, cells + cell, count - cell, destination + cell);
+		}
+
+		__attribute__((target("avx2")))
+		static void lookupAvx2(const uint8_t *table, const GlyphId *cells, int count, char *destination)
+		{
+			// vpshufb looks up within each 128 bit lane -> same table in both lanes.
+			auto lookup = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) table));
+			int cell = 0;
+			for(; cell + 32 <= count; cell += 32)
+			{
+				auto ids = _mm256_loadu_si256((const __m256i*) (cells + cell));
+				_mm256_storeu_si256((__m256i*) (destination + cell), _mm256_shuffle_epi8(lookup, ids));
+			}
+			lookupSsse3(table, cells + cell, count - cell, destination + cell);
+		}
+#endif
+
+#ifdef GLYPH_ROW_SERIALIZER_NEON
+		static void lookupNeon(const uint8_t *table, const GlyphId *cells, int count, char *destination)
+		{
+			auto lookup = vld1q_u8(table);
+			int cell = 0;
+			for(; cell + 32 <= count; cell += 32)
+			{
+				auto ids = vld1q_u8_x2((const uint8_t*) (cells + cell));
+				vst1q_u8((uint8_t*) (destination + cell), vqtbl1q_u8(lookup, ids.val[0]));
+				vst1q_u8((uint8_t*) (destination + cell + 16), vqtbl1q_u8(lookup, ids.val[1]));
+			}
+			for(; cell + 16 <= count; cell += 16)
+			{
+				auto ids = vld1q_u8((const uint8_t*) (cells + cell));
+				vst1q_u8((uint8_t*) (destination + cell), vqtbl1q_u8(lookup, ids));
+			}
+			lookupScalar(table, cells + cell, count - cell, destination + cell);
+		}
+#endif
+
+		template<size_t width>
+		void copyFixedWidth(const GlyphId *cells, int count, char *destination)
+		{
+			auto atlas = this->atlas.data();
+			for(int cell = 0; cell < count; cell++)
+			{
+				std::memcpy(destination + cell * width, atlas + cells[cell] * width, width);
+			}
+		}
+
+		void copyFixedWidth(const GlyphId *cells, int count, char *destination, size_t width)
+		{
+			auto atlas = this->atlas.data();
+			for(int cell = 0; cell < count; cell++)
+			{
+				std::memcpy(destination + cell * width, atlas + cells[cell] * width, width);
+			}
+		}
+
+		size_t copyVariableWidth(const GlyphId *cells, int count, char *destination)
+		{
+			auto atlas = this->atlas.data();
+			size_t written = 0;
+			for(int cell = 0; cell < count; cell++)
+			{
+				auto glyph = cells[cell];
+				std::memcpy(destination + written, atlas + this->offsets[glyph], this->lengths[glyph]);
+				written += this->lengths[glyph];
+			}
+			return written;
+		}
+
+	public:
+		GlyphRowSerializer(std::shared_ptr<GlyphTable> glyphs_ptr)
+			: glyphs_ptr(glyphs_ptr)
+		{
+			for(int glyph = 0; glyph < GlyphId::glyphCount; glyph++)
+			{
+				auto &bytes = glyphs_ptr->getGlyph((GlyphId) glyph);
+				this->offsets[glyph] = this->atlas.size();
+				this->lengths[glyph] = bytes.size();
+				this->atlas.insert(this->atlas.end(), bytes.begin(), bytes.end());
+			}
+
+			if(glyphs_ptr->isSingleByte())
+			{
+				this->serialization = GlyphSerialization::singleByteLookup;
+			}
+			else if(glyphs_ptr->getMaxBytesPerCell() * GlyphId::glyphCount == this->atlas.size())
+			{
+				this->serialization = GlyphSerialization::fixedWidthCopy;
+			}
+			else
+			{
+				this->serialization = GlyphSerialization::variableWidthCopy;
+			}
+
+			for(int glyph = 0; glyph < lookupTableSize; glyph++)
+			{
+				auto id = glyph < GlyphId::glyphCount ? glyph : GlyphId::whiteSpaceGlyph;
+				this->lookupTable[glyph] = this->atlas.empty() ? ' ' : this->atlas[this->offsets[id]];
+			}
+
+			this->useAvx2 = false;
+			this->useSsse3 = false;
+#ifdef GLYPH_ROW_SERIALIZER_X86
+			this->useAvx2 = __builtin_cpu_supports("avx2");
+			this->useSsse3 = __builtin_cpu_supports("ssse3");
+#endif
+		}
+
+		GlyphSerialization getSerialization()
+		{
+			return this->serialization;
+		}
+
+		GlyphTable &getGlyphTable()
+		{
+			return *(this->glyphs_ptr);
+		}
+
+		/**
+		 * Writes the bytes of the cells to the destination and returns their number.
+		 * The destination needs room for GlyphTable::getByteSize() bytes.
+		 */
+		size_t serialize(const GlyphId *cells, int count, char *destination)
+		{
+			switch (this->serialization)
+			{
+				case GlyphSerialization::singleByteLookup:
+				{
+#if defined(GLYPH_ROW_SERIALIZER_X86)
+					if(this->useAvx2)
+					{
+						lookupAvx2(this->lookupTable, cells, count, destination);
+						return count;
+					}
+					if(this->useSsse3)
+					{
+						lookupSsse3(this->lookupTable, cells, count, destination);
+						return count;
+					}
+#elif defined(GLYPH_ROW_SERIALIZER_NEON)
+					lookupNeon(this->lookupTable, cells, count, destination);
+					return count;
+#endif
+					lookupScalar(this->lookupTable, cells, count, destination);
+					return count;
+				}
+				case GlyphSerialization::fixedWidthCopy:
+				{
+					auto width = this->lengths[0];
+					switch (width)
+					{
+						case 2:
+							this->copyFixedWidth<2>(cells, count, destination);
+							break;
+						case 3:
+							this->copyFixedWidth<3>(cells, count, destination);
+							break;
+						case 4:
+							this->copyFixedWidth<4>(cells, count, destination);
+							break;
+						default:
+							this->copyFixedWidth(cells, count, destination, width);
+							break;
+					}
+					return count * width;
+				}
+				default:
+					return this->copyVariableWidth(cells, count, destination);
+			}
+		}
+
+		/**
+		 * Appends the bytes of the cells to the output, e.g. a std::string or a line of a rendered frame.
+		 */
+		template <typename TString>
+		void serialize(const GlyphId *cells, int count, TString &output)
+		{
+			auto offset = output.size();
+			output.resize(offset + this->glyphs_ptr->getByteSize(cells, count));
+			this->serialize(cells, count, &output[offset]);
+		}
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef GLYPH_TABLE_HPP
+#define GLYPH_TABLE_HPP
+#include "../Common/ITheme.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Ids of everything that can be drawn into a cell of the playing field.
+ */
+enum GlyphId : uint8_t
+{
+	whiteSpaceGlyph = 0,
+	centipedeBodyGlyph = 1,
+	centipedeHeadGlyph = 2,
+	mushroomLowGlyph = 3,
+	mushroomMediumGlyph = 4,
+	mushroomFullGlyph = 5,
+	starshipGlyph = 6,
+	bulletGlyph = 7,
+	glyphCount = 8
+};
+
+/**
+ * The output bytes of every GlyphId for one theme, fetched once from the theme.
+ * Also holds the number of bytes each cell costs, so frames can be sized exactly before rendering.
+ */
+class GlyphTable
+{
+	private:
+		std::vector<std::string> glyphs;
+		std::vector<size_t> bytesPerCell;
+		size_t minBytesPerCell;
+		size_t maxBytesPerCell;
+
+	public:
+		GlyphTable(ITheme &theme)
+			: glyphs(GlyphId::glyphCount), bytesPerCell(GlyphId::glyphCount)
+		{
+			this->glyphs[GlyphId::whiteSpaceGlyph] = theme.getWhiteSpace();
+			this->glyphs[GlyphId::centipedeBodyGlyph] = theme.getCentipedeBody();
+			this->glyphs[GlyphId::centipedeHeadGlyph] = theme.getCentipedeHead();
+			this->glyphs[GlyphId::mushroomLowGlyph] = theme.getMushroom(1);
+			this->glyphs[GlyphId::mushroomMediumGlyph] = theme.getMushroom(2);
+			this->glyphs[GlyphId::mushroomFullGlyph] = theme.getMushroom(3);
+			this->glyphs[GlyphId::starshipGlyph] = theme.getStarship();
+			this->glyphs[GlyphId::bulletGlyph] = theme.getBullet();
+
+			this->minBytesPerCell = this->glyphs[0].size();
+			this->maxBytesPerCell = this->glyphs[0].size();
+			for(int glyph = 0; glyph < GlyphId::glyphCount; glyph++)
+			{
+				auto size = this->glyphs[glyph].size();
+				this->bytesPerCell[glyph] = size;
+				this->minBytesPerCell = std::min(this->minBytesPerCell, size);
+				this->maxBytesPerCell = std::max(this->maxBytesPerCell, size);
+			}
+		}
+
+		/**
+		 * Returns the glyph of a mushroom with the given health.
+		 * Themes draw every mushroom with at least 3 health alike.
+		 */
+		static GlyphId getMushroomGlyph(int health)
+		{
+			switch (health)
+			{
+				case 1:
+					return GlyphId::mushroomLowGlyph;
+				case 2:
+					return GlyphId::mushroomMediumGlyph;
+				default: // health >= 3
+					return GlyphId::mushroomFullGlyph;
+			}
+		}
+
+		/**
+		 * Returns the output bytes of the glyph.
+		 */
+		const std::string &getGlyph(GlyphId glyph)
+		{
+			return this->glyphs[glyph];
+		}
+
+		/**
+		 * Returns the number of bytes a cell showing the glyph costs.
+		 */
+		size_t getBytesPerCell(GlyphId glyph)
+		{
+			return this->bytesPerCell[glyph];
+		}
+
+		size_t getMaxBytesPerCell()
+		{
+			return this->maxBytesPerCell;
+		}
+
+		/**
+		 * Returns true if every glyph is exactly one byte.
+		 */
+		bool isSingleByte()
+		{
+			return this->maxBytesPerCell == 1 && this->minBytesPerCell == 1;
+		}
+
+		/**
+		 * Returns the exact number of bytes the given cells are serialized to.
+		 */
+		size_t getByteSize(const GlyphId *cells, int count)
+		{
+			if(this->minBytesPerCell == this->maxBytesPerCell)
+			{
+				return count * this->maxBytesPerCell;
+			}
+			size_t size = 0;
+			for(int cell = 0; cell < count; cell++)
+			{
+				size += this->bytesPerCell[cells[cell]];
+			}
+			return size;
+		}
+};
+
+#endif
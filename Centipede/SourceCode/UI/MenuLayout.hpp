@@ -0,0 +1,190 @@
+#ifndef MENU_LAYOUT_HPP
+#define MENU_LAYOUT_HPP
+#include "RenderedFrame.hpp"
+#include "ThemeAtlas.hpp"
+#include "../../lib/console_lib.hpp"
+#include "../Common/IUI.hpp"
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * The lines of a menu, laid out once for its content, the field size and the theme.
+ * Changing the selection only swaps the lines of the two options involved.
+ */
+class MenuLayout
+{
+	private:
+		// Content the layout was made for.
+		std::string title;
+		ConsoleColour titleColour;
+		std::vector<std::string> textLines;
+		std::vector<std::string> options;
+		int numberOfColumns;
+		int numberOfLines;
+		ThemeAtlas *atlas;
+
+		RenderedFrame lines;
+		// Lines of every option highlighted, at the same index as in lines.
+		RenderedFrame highlightedLines;
+		// First line of every option, followed by the end of the last one.
+		std::vector<int> optionStarts;
+		int selected;
+
+		/**
+		 * Returns the sequence, that sets the colour of text on top of the colours of the theme.
+		 */
+		static std::string getColourSequence(ConsoleColour colour)
+		{
+			switch (colour)
+			{
+				case ConsoleColour::Black:
+					return AnsiExcapeCodes::foregroundBlack;
+				case ConsoleColour::Blue:
+					return AnsiExcapeCodes::foregroundBlue;
+				case ConsoleColour::Cyan:
+					return AnsiExcapeCodes::foregroundCyan;
+				case ConsoleColour::Default:
+					return AnsiExcapeCodes::foregroundDefault;
+				case ConsoleColour::Green:
+					return AnsiExcapeCodes::foregroundGreen;
+				case ConsoleColour::Magenta:
+					return AnsiExcapeCodes::foregroundMagenta;
+				case ConsoleColour::Red:
+					return AnsiExcapeCodes::foregroundRed;
+				case ConsoleColour::White:
+					return AnsiExcapeCodes::foregroundWhite;
+				case ConsoleColour::Yellow:
+					return AnsiExcapeCodes::foregroundYellow;
+				default:
+					return "";
+			}
+		}
+
+		/**
+		 * Appends the text in lines as wide as the field with its border: one white space on both sides,
+		 * cut hard at the maximum width and the last line filled up with white space.
+		 * Every line is put between the given sequences, e.g. to colour it.
+		 */
+		void appendWrapped(std::string_view text, std::string_view before, std::string_view after, RenderedFrame &output)
+		{
+			size_t maxTextWidth = std::max(this->numberOfColumns, 1);
+			auto whiteSpace = this->atlas->get(GlyphId::whiteSpaceGlyph);
+			size_t position = 0;
+			do
+			{
+				auto part = text.substr(position, maxTextWidth);
+				position += part.size();
+				RenderedLine line(before);
+				line += whiteSpace;
+				line += part;
+				line += this->atlas->getWhiteSpaces(this->numberOfColumns + 1 - (int) part.size());
+				line += after;
+				output.push_back(std::move(line));
+			}
+			while(position < text.size());
+		}
+
+		void appendBlankLine()
+		{
+			this->lines.emplace_back(this->atlas->getWhiteSpaces(this->numberOfColumns + 2));
+			this->highlightedLines.emplace_back();
+		}
+
+	public:
+		MenuLayout(std::string &title,
+				   ConsoleColour titleColour,
+				   std::vector<std::string> &textLines,
+				   std::vector<std::string> &options,
+				   int numberOfColumns,
+				   int numberOfLines,
+				   ThemeAtlas &atlas)
+			: title(title), titleColour(titleColour), textLines(textLines), options(options),
+			  numberOfColumns(numberOfColumns), numberOfLines(numberOfLines), atlas(&atlas)
+		{
+			this->selected = -1;
+			AnsiExcapeCodes ansiExcapeCodes;
+			// Two blank lines on top.
+			this->appendBlankLine();
+			this->appendBlankLine();
+
+			// Title, coloured on top of the theme and bold, and a blank line below.
+			auto titleStart = ansiExcapeCodes.boldOn + getColourSequence(titleColour);
+			auto titleEnd = std::string(atlas.get(ThemeElement::colourSetupStartElement)) + ansiExcapeCodes.boldOff;
+			this->appendWrapped(title, titleStart, titleEnd, this->lines);
+			this->highlightedLines.resize(this->lines.size());
+			this->appendBlankLine();
+
+			for(auto &text : textLines)
+			{
+				this->appendWrapped(text, "", "", this->lines);
+			}
+			this->highlightedLines.resize(this->lines.size());
+
+			for(auto &option : options)
+			{
+				this->optionStarts.push_back(this->lines.size());
+				this->appendWrapped(option, "", "", this->lines);
+				this->appendWrapped(option, ansiExcapeCodes.boldOn, ansiExcapeCodes.boldOff, this->highlightedLines);
+			}
+			this->optionStarts.push_back(this->lines.size());
+
+			// Fill up to the height of a frame: two info lines on top and the border around the field.
+			while(this->lines.size() < (size_t) (numberOfLines + 2 + 2))
+			{
+				this->appendBlankLine();
+			}
+		}
+
+		/**
+		 * Returns true if the layout was made for this content, size and theme.
+		 */
+		bool matches(std::string &title,
+					 ConsoleColour titleColour,
+					 std::vector<std::string> &textLines,
+					 std::vector<std::string> &options,
+					 int numberOfColumns,
+					 int numberOfLines,
+					 ThemeAtlas &atlas)
+		{
+			return this->atlas == &atlas
+				&& this->numberOfColumns == numberOfColumns
+				&& this->numberOfLines == numberOfLines
+				&& this->titleColour == titleColour
+				&& this->title == title
+				&& this->textLines == textLines
+				&& this->options == options;
+		}
+
+		/**
+		 * Highlights the option, none if it is out of range, and returns the lines of the menu.
+		 */
+		RenderedFrame &select(int selected)
+		{
+			if(selected < 0 || selected >= (int) this->options.size())
+			{
+				selected = -1;
+			}
+			if(selected == this->selected)
+			{
+				return this->lines;
+			}
+			for(auto option : { this->selected, selected })
+			{
+				if(option < 0)
+				{
+					continue;
+				}
+				// Swapping twice restores the plain lines of the previous selection.
+				for(int line = this->optionStarts[option]; line < this->optionStarts[option + 1]; line++)
+				{
+					this->lines[line].swap(this->highlightedLines[line]);
+				}
+			}
+			this->selected = selected;
+			return this->lines;
+		}
+};
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef MONOCHROME_THEME_HPP
+#define MONOCHROME_THEME_HPP
+#include "../Common/ITheme.hpp"
+
+/**
+ * Plain ASCII theme without any colour sequences.
+ * Mushroom health is shown by the glyph instead of the colour.
+ */
+class MonochromeTheme
+    : public ITheme
+{
+    public:
+        std::string getColourSetupStart() override
+        {
+            return "";
+        }
+
+        std::string getColourSetupEnd() override
+        {
+            return "";
+        }
+
+        std::string getWhiteSpace() override
+        {
+            return " ";
+        }
+
+        std::string getCentipedeBody() override
+        {
+            return "o";
+        }
+
+        std::string getCentipedeHead() override
+        {
+            return "@";
+        }
+
+        std::string getMushroom(int health) override
+        {
+            switch (health)
+            {
+            case 0:
+                return this->getWhiteSpace();
+            case 1:
+                return ".";
+            case 2:
+                return "m";
+            default: // health >= 3
+                return "M";
+            }
+        }
+
+        std::string getStarship() override
+        {
+            return "A";
+        }
+
+        std::string getBullet() override
+        {
+            return "^";
+        }
+
+        std::string getHeart() override
+        {
+            return "*";
+        }
+
+        std::string getFieldEdgeTop() override
+        {
+            return "-";
+        }
+
+        std::string getFieldEdgeLeft() override
+        {
+            return "|";
+        }
+
+        std::string getFieldEdgeBottom() override
+        {
+            return "-";
+        }
+
+        std::string getFieldEdgeRight() override
+        {
+            return "|";
+        }
+
+        std::string getFieldEdgeTopRightCorner() override
+        {
+            return "+";
+        }
+
+        std::string getFieldEdgeTopLeftCorner() override
+        {
+            return "+";
+        }
+
+        std::string getFieldEdgeBottomRightCorner() override
+        {
+            return "+";
+        }
+
+        std::string getFieldEdgeBottomLeftCorner() override
+        {
+            return "+";
+        }
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef NULL_OUTPUT_BUFFER_HPP
+#define NULL_OUTPUT_BUFFER_HPP
+#include <streambuf>
+
+/**
+ * Stream buffer that only counts the bytes written into it, e.g. the frames of headless runs.
+ */
+class NullOutputBuffer : public std::streambuf
+{
+    private:
+        size_t bytes = 0;
+
+    protected:
+        int overflow(int character) override
+        {
+            this->bytes++;
+            return character;
+        }
+
+        std::streamsize xsputn(const char *, std::streamsize count) override
+        {
+            this->bytes += count;
+            return count;
+        }
+
+    public:
+        size_t getBytes()
+        {
+            return this->bytes;
+        }
+};
+
+#endif
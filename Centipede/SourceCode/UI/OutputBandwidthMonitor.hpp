@@ -0,0 +1,214 @@
+#ifndef OUTPUT_BANDWIDTH_MONITOR_HPP
+#define OUTPUT_BANDWIDTH_MONITOR_HPP
+#include <chrono>
+#include <cstddef>
+
+/**
+ * Output stages from the richest to the cheapest image.
+ */
+enum OutputQuality : int
+{
+	fullFrames = 0,
+	diffOnly = 1,
+	asciiGlyphs = 2,
+	monochrome = 3
+};
+
+/**
+ * Measures how many bytes the terminal takes and decides which output quality the link can keep up with.
+ * Evaluated in windows of constant length:
+ * - If too many frames had to be dropped within a window, the quality is lowered by one stage.
+ * - After enough windows without any dropped frame the next better stage is tried again,
+ *   unless the measured throughput is known to be too small for it.
+ */
+class OutputBandwidthMonitor
+{
+	private:
+		// Share of dropped frames within a window, above which the quality is lowered.
+		static constexpr double degradeDropRatio = 0.2;
+		// Throughput needs to exceed the expected demand by this factor, before a better stage is tried.
+		static constexpr double upgradeHeadroom = 1.25;
+		// Weight of a new sample in the moving averages.
+		static constexpr double smoothing = 0.25;
+		static constexpr int initialRecoveryWindows = 4;
+		static constexpr int maxRecoveryWindows = 64;
+
+		OutputQuality quality;
+		std::chrono::milliseconds windowLength;
+		std::chrono::steady_clock::time_point windowStart;
+		int sentFramesInWindow;
+		int droppedFramesInWindow;
+		int cleanWindows;
+		// Clean windows needed before trying a better stage, doubled every time such a try fails.
+		int recoveryWindows;
+		bool upgradedInLastWindow;
+		// Bytes per second the terminal took while it was saturated, 0 if unknown.
+		double throughput;
+		// Average bytes per frame for each output quality, 0 if unknown.
+		double frameBytes[4];
+
+		double updateAverage(double average, double sample)
+		{
+			if(average == 0)
+			{
+				return sample;
+			}
+			return average + smoothing * (sample - average);
+		}
+
+		void evaluateWindow(std::chrono::steady_clock::time_point now)
+		{
+			auto offeredFrames = this->sentFramesInWindow + this->droppedFramesInWindow;
+			double seconds = std::chrono::duration<double>(now - this->windowStart).count();
+			bool upgradedInLastWindow = this->upgradedInLastWindow;
+			this->upgradedInLastWindow = false;
+			this->windowStart = now;
+
+			if(offeredFrames == 0 || seconds <= 0)
+			{
+				return;
+			}
+			double offeredFramesPerSecond = offeredFrames / seconds;
+			double dropRatio = (double) this->droppedFramesInWindow / offeredFrames;
+			this->sentFramesInWindow = 0;
+			this->droppedFramesInWindow = 0;
+
+			if(dropRatio > degradeDropRatio)
+			{
+				this->cleanWindows = 0;
+				if(upgradedInLastWindow && this->recoveryWindows < maxRecoveryWindows)
+				{
+					// The better stage failed right away -> wait longer before the next try.
+					this->recoveryWindows *= 2;
+				}
+				if(this->quality < OutputQuality::monochrome)
+				{
+					this->quality = (OutputQuality) (this->quality + 1);
+				}
+				return;
+			}
+
+			if(dropRatio > 0)
+			{
+				// Some frames were dropped, but not enough to go down a stage.
+				this->cleanWindows = 0;
+				return;
+			}
+
+			// The terminal took everything in this window.
+			this->cleanWindows++;
+			if(this->throughput > 0 && this->cleanWindows > 4 * this->recoveryWindows)
+			{
+				// Measurement is outdated, the link might have recovered.
+				this->throughput = 0;
+			}
+			if(this->quality == OutputQuality::fullFrames || this->cleanWindows < this->recoveryWindows)
+			{
+				return;
+			}
+			auto better = (OutputQuality) (this->quality - 1);
+			auto demand = this->frameBytes[better] * offeredFramesPerSecond * upgradeHeadroom;
+			if(this->throughput > 0 && this->frameBytes[better] > 0 && this->throughput < demand)
+			{
+				// Known to be too slow for the better stage.
+				return;
+			}
+			this->quality = better;
+			this->cleanWindows = 0;
+			this->upgradedInLastWindow = true;
+		}
+
+		void evaluateIfWindowEnded(std::chrono::steady_clock::time_point now)
+		{
+			if(now - this->windowStart >= this->windowLength)
+			{
+				this->evaluateWindow(now);
+			}
+		}
+
+	public:
+		OutputBandwidthMonitor(int windowLengthMilliseconds)
+			: OutputBandwidthMonitor(windowLengthMilliseconds, std::chrono::steady_clock::now())
+		{
+		}
+
+		/**
+		 * Starts the first window at the given time, the frames are then recorded with their times, e.g. in tests.
+		 */
+		OutputBandwidthMonitor(int windowLengthMilliseconds, std::chrono::steady_clock::time_point start)
+			: windowLength(windowLengthMilliseconds)
+		{
+			this->quality = OutputQuality::fullFrames;
+			this->windowStart = start;
+			this->sentFramesInWindow = 0;
+			this->droppedFramesInWindow = 0;
+			this->cleanWindows = 0;
+			this->recoveryWindows = initialRecoveryWindows;
+			this->upgradedInLastWindow = false;
+			this->throughput = 0;
+			for(int i = 0; i < 4; i++)
+			{
+				this->frameBytes[i] = 0;
+			}
+		}
+
+		/**
+		 * Returns the quality the next frame should be rendered in.
+		 */
+		OutputQuality getQuality()
+		{
+			return this->quality;
+		}
+
+		/**
+		 * Returns the measured throughput of the terminal in bytes per second, 0 if unknown.
+		 */
+		double getThroughput()
+		{
+			return this->throughput;
+		}
+
+		/**
+		 * Records a frame of the given size, that was handed to the terminal in the current quality.
+		 */
+		void recordSentFrame(size_t bytes)
+		{
+			this->recordSentFrame(bytes, std::chrono::steady_clock::now());
+		}
+
+		void recordSentFrame(size_t bytes, std::chrono::steady_clock::time_point now)
+		{
+			this->frameBytes[this->quality] = this->updateAverage(this->frameBytes[this->quality], bytes);
+			this->sentFramesInWindow++;
+			this->evaluateIfWindowEnded(now);
+		}
+
+		/**
+		 * Records a frame, that was skipped because the terminal was still busy with the previous one.
+		 */
+		void recordDroppedFrame()
+		{
+			this->recordDroppedFrame(std::chrono::steady_clock::now());
+		}
+
+		void recordDroppedFrame(std::chrono::steady_clock::time_point now)
+		{
+			this->droppedFramesInWindow++;
+			this->evaluateIfWindowEnded(now);
+		}
+
+		/**
+		 * Records the bytes the terminal took within the given time while it was saturated the entire time.
+		 */
+		void recordSaturatedThroughput(size_t bytes, std::chrono::steady_clock::duration elapsed)
+		{
+			double seconds = std::chrono::duration<double>(elapsed).count();
+			if(seconds <= 0)
+			{
+				return;
+			}
+			this->throughput = this->updateAverage(this->throughput, bytes / seconds);
+		}
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef RENDERED_FRAME_HPP
+#define RENDERED_FRAME_HPP
+#include "../Common/MemoryAccounting.hpp"
+
+/**
+ * Lines of a rendered frame, allocated in the render memory of the session.
+ */
+using RenderedLine = AccountedString<MemorySubsystem::renderMemory>;
+using RenderedFrame = AccountedVector<RenderedLine, MemorySubsystem::renderMemory>;
+
+#endif
@@ -1,3 +1,5 @@
+#ifndef STANDARD_THEME_HPP
+#define STANDARD_THEME_HPP
 #include "../Common/ITheme.hpp"
 #include "../../lib/console_lib.hpp"
 
@@ -116,4 +118,6 @@ class StandardTheme
             return "◼︎";
         }
 
-};
\ No newline at end of file
+};
+
+#endif
\ No newline at end of file
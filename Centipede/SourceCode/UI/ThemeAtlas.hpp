@@ -0,0 +1,122 @@
+#ifndef THEME_ATLAS_HPP
+#define THEME_ATLAS_HPP
+#include "../Common/ITheme.hpp"
+#include "GlyphTable.hpp"
+#include "GlyphRowSerializer.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Everything of a theme the renderer draws. The glyphs of the playing field come first, with the ids of GlyphId.
+ */
+enum ThemeElement : int
+{
+	heartElement = GlyphId::glyphCount,
+	fieldEdgeTopElement,
+	fieldEdgeLeftElement,
+	fieldEdgeBottomElement,
+	fieldEdgeRightElement,
+	fieldEdgeTopLeftCornerElement,
+	fieldEdgeTopRightCornerElement,
+	fieldEdgeBottomLeftCornerElement,
+	fieldEdgeBottomRightCornerElement,
+	colourSetupStartElement,
+	colourSetupEndElement,
+	themeElementCount
+};
+
+/**
+ * A theme compiled once: the bytes of all elements, colour sequences included, one after another in a single buffer
+ * with the offset and length of each, and the row serializer of its glyphs.
+ * The renderer only reads from here, it never calls back into the theme.
+ */
+class ThemeAtlas
+{
+	private:
+		std::vector<char> bytes;
+		size_t offsets[ThemeElement::themeElementCount];
+		size_t lengths[ThemeElement::themeElementCount];
+		std::shared_ptr<GlyphRowSerializer> serializer_ptr;
+		// White space repeated, padding of text lines is cut from it.
+		std::string whiteSpaces;
+
+		void append(ThemeElement element, const std::string &elementBytes)
+		{
+			this->offsets[element] = this->bytes.size();
+			this->lengths[element] = elementBytes.size();
+			this->bytes.insert(this->bytes.end(), elementBytes.begin(), elementBytes.end());
+		}
+
+	public:
+		ThemeAtlas(ITheme &theme)
+		{
+			auto glyphs_ptr = std::make_shared<GlyphTable>(theme);
+			for(int glyph = 0; glyph < GlyphId::glyphCount; glyph++)
+			{
+				this->append((ThemeElement) glyph, glyphs_ptr->getGlyph((GlyphId) glyph));
+			}
+			this->append(ThemeElement::heartElement, theme.getHeart());
+			this->append(ThemeElement::fieldEdgeTopElement, theme.getFieldEdgeTop());
+			this->append(ThemeElement::fieldEdgeLeftElement, theme.getFieldEdgeLeft());
+			this->append(ThemeElement::fieldEdgeBottomElement, theme.getFieldEdgeBottom());
+			this->append(ThemeElement::fieldEdgeRightElement, theme.getFieldEdgeRight());
+			this->append(ThemeElement::fieldEdgeTopLeftCornerElement, theme.getFieldEdgeTopLeftCorner());
+			this->append(ThemeElement::fieldEdgeTopRightCornerElement, theme.getFieldEdgeTopRightCorner());
+			this->append(ThemeElement::fieldEdgeBottomLeftCornerElement, theme.getFieldEdgeBottomLeftCorner());
+			this->append(ThemeElement::fieldEdgeBottomRightCornerElement, theme.getFieldEdgeBottomRightCorner());
+			this->append(ThemeElement::colourSetupStartElement, theme.getColourSetupStart());
+			this->append(ThemeElement::colourSetupEndElement, theme.getColourSetupEnd());
+			this->serializer_ptr = std::make_shared<GlyphRowSerializer>(glyphs_ptr);
+		}
+
+		/**
+		 * Returns the bytes of the element, valid as long as the atlas.
+		 */
+		std::string_view get(ThemeElement element)
+		{
+			return std::string_view(this->bytes.data() + this->offsets[element], this->lengths[element]);
+		}
+
+		std::string_view get(GlyphId glyph)
+		{
+			return this->get((ThemeElement) glyph);
+		}
+
+		/**
+		 * Returns the given number of white spaces, none for a negative number.
+		 * The buffer only grows when a longer run than ever before is asked for, which invalidates earlier views.
+		 */
+		std::string_view getWhiteSpaces(int count)
+		{
+			auto whiteSpace = this->get(GlyphId::whiteSpaceGlyph);
+			auto size = (size_t) std::max(count, 0) * whiteSpace.size();
+			while(this->whiteSpaces.size() < size)
+			{
+				this->whiteSpaces += whiteSpace;
+			}
+			return std::string_view(this->whiteSpaces.data(), size);
+		}
+
+		size_t getLength(ThemeElement element)
+		{
+			return this->lengths[element];
+		}
+
+		/**
+		 * Returns the number of bytes of all elements together.
+		 */
+		size_t getSize()
+		{
+			return this->bytes.size();
+		}
+
+		GlyphRowSerializer &getRowSerializer()
+		{
+			return *(this->serializer_ptr);
+		}
+};
+
+#endif
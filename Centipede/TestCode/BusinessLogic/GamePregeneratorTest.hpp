@@ -0,0 +1,71 @@
+#ifndef GAME_PREGENERATOR_TEST_HPP
+#define GAME_PREGENERATOR_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GamePregenerator.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../Persistence/SaveStateSerializerTest.hpp"
+
+bool gamePregenerator_sameAsNewGameTest()
+{
+    printSubTestName("GamePregenerator same as new game test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    GamePregenerator pregenerator(settings, 11);
+    auto first = pregenerator.take();
+    auto second = pregenerator.take();
+    auto result = assertEquals(true, serializeForTest(settings, *first) == serializeForTest(settings, *GameSimulation::createNewGame(settings, 11)));
+    result &= assertEquals(true, serializeForTest(settings, *second) == serializeForTest(settings, *GameSimulation::createNewGame(settings, 12)));
+    result &= assertEquals(true, first != second);
+    endTest();
+    return result;
+}
+
+bool gamePregenerator_preparesAheadTest()
+{
+    printSubTestName("GamePregenerator prepares ahead test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    GamePregenerator pregenerator(settings, 3);
+    pregenerator.take();
+    // The next game is prepared in the background, without anyone asking for it.
+    for(int attempt = 0; attempt < 1000 && !pregenerator.isReady(); attempt++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto result = assertEquals(true, pregenerator.isReady());
+    endTest();
+    return result;
+}
+
+bool gamePregenerator_limitedGamesTest()
+{
+    printSubTestName("GamePregenerator limited games test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    GamePregenerator pregenerator(settings, 5, 1);
+    auto first = pregenerator.take();
+    auto result = assertEquals(true, serializeForTest(settings, *first) == serializeForTest(settings, *GameSimulation::createNewGame(settings, 5)));
+    // No further game is prepared, taking one more is an error.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    result &= assertEquals(false, pregenerator.isReady());
+    auto thrown = false;
+    try
+    {
+        pregenerator.take();
+    }
+    catch(const std::logic_error&)
+    {
+        thrown = true;
+    }
+    result &= assertEquals(true, thrown);
+    endTest();
+    return result;
+}
+
+void runGamePregeneratorTest()
+{
+    printTestName("GamePregenerator Test");
+    auto result = gamePregenerator_sameAsNewGameTest();
+    result &= gamePregenerator_preparesAheadTest();
+    result &= gamePregenerator_limitedGamesTest();
+    printTestSummary(result);
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef GAME_SIMULATION_TEST_HPP
+#define GAME_SIMULATION_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Input/InputBuffer.hpp"
+#include <cstdlib>
+#include "../Persistence/SaveStateSerializerTest.hpp"
+
+bool gameSimulation_immediateStarshipInputTest()
+{
+    printSubTestName("GameSimulation immediate starship input test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 1);
+    GameSimulation simulation(state);
+    InputBuffer input;
+
+    // Gametick 1 is no starship gametick, the starship moves anyway.
+    input.setDirection(Direction::left);
+    simulation.executeGametick(input);
+    auto result = assertEquals(4, state->getStarship()->getPosition().getColumn());
+
+    // Within the cooldown the direction waits in the input and is applied in gametick 1 + cooldown.
+    input.setDirection(Direction::right);
+    for(int gameTick = 2; gameTick < 1 + settings->getStarshipMoveCooldown(); gameTick++)
+    {
+        simulation.executeGametick(input);
+    }
+    result &= assertEquals(4, state->getStarship()->getPosition().getColumn());
+    simulation.executeGametick(input);
+    result &= assertEquals(5, state->getStarship()->getPosition().getColumn());
+    endTest();
+    return result;
+}
+
+bool gameSimulation_alignedStarshipInputTest()
+{
+    printSubTestName("GameSimulation aligned starship input test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    settings->setImmediateStarshipInput(false);
+    auto state = createPersistenceTestState(settings, 1);
+    GameSimulation simulation(state);
+    InputBuffer input;
+
+    input.setDirection(Direction::left);
+    simulation.executeGametick(input);
+    auto result = assertEquals(5, state->getStarship()->getPosition().getColumn());
+    while(state->getGameTick() < settings->getStarshipModuloGametickSlowdown())
+    {
+        simulation.executeGametick(input);
+    }
+    result &= assertEquals(4, state->getStarship()->getPosition().getColumn());
+    endTest();
+    return result;
+}
+
+bool gameSimulation_centipedeStepsCadenceTest()
+{
+    printSubTestName("GameSimulation centipede steps cadence test");
+    // One cell every 8 gameticks moves in the same gameticks as the modulo slowdown did.
+    auto slowSpeed = getCentipedeSpeedForSlowdown(8);
+    auto sameGameticks = true;
+    // One and a half cells per gametick alternate between one and two cells.
+    auto fastSpeed = centipedeSpeedScale * 3 / 2;
+    int fastCells = 0;
+    for(int gameTick = 1; gameTick <= 100; gameTick++)
+    {
+        sameGameticks &= getCentipedeStepsInGametick(gameTick, slowSpeed) == (gameTick % 8 == 0 ? 1 : 0);
+        fastCells += getCentipedeStepsInGametick(gameTick, fastSpeed);
+    }
+    auto result = assertEquals(true, sameGameticks);
+    result &= assertEquals(150, fastCells);
+    endTest();
+    return result;
+}
+
+/**
+ * Plays the state into the given round, with a fresh centipede.
+ */
+void startTestRound(GameSimulation &simulation, std::shared_ptr<SaveState> state, int round)
+{
+    InputBuffer input;
+    while(state->getCurrentRound() < round - 1)
+    {
+        state->incrementCurrentRound();
+    }
+    state->getCentipedes()->clear();
+    simulation.executeGametick(input);
+}
+
+bool gameSimulation_lateRoundCentipedeSpeedTest()
+{
+    printSubTestName("GameSimulation late round centipede speed test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 1);
+    GameSimulation simulation(state);
+    InputBuffer input;
+
+    // The slowdown would be 8 - 9 = -1: one cell every gametick plus two speedups of the initial speed.
+    startTestRound(simulation, state, 45);
+    auto result = assertEquals(centipedeSpeedScale + 2 * getCentipedeSpeedForSlowdown(8), state->getCurrentCentipedeSpeed());
+    auto column = state->getCentipedes()->front().getPosition().getColumn();
+    for(int gameTick = 0; gameTick < 4; gameTick++)
+    {
+        simulation.executeGametick(input);
+    }
+    // 4 gameticks at 1.25 cells each, on an empty top line.
+    result &= assertEquals(5, std::abs(state->getCentipedes()->front().getPosition().getColumn() - column));
+
+    startTestRound(simulation, state, 500);
+    result &= assertEquals(settings->getMaxCentipedeCellsPerGametick() * centipedeSpeedScale, state->getCurrentCentipedeSpeed());
+    endTest();
+    return result;
+}
+
+bool gameSimulation_secondStarshipTest()
+{
+    printSubTestName("GameSimulation second starship test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 1);
+    state->setSecondStarship(std::make_shared<Starship>(settings->getPlayingFieldHeight() - 1, 8, settings));
+    GameSimulation simulation(state);
+    InputBuffer input;
+    InputBuffer secondInput;
+
+    // Each input steers its own starship.
+    secondInput.setDirection(Direction::left);
+    secondInput.setShot();
+    simulation.executeGametick(input, secondInput);
+    auto result = assertEquals(5, state->getStarship()->getPosition().getColumn());
+    result &= assertEquals(7, state->getSecondStarship()->getPosition().getColumn());
+
+    // The shot is fired on the next starship gametick, from the second starship.
+    while(state->getGameTick() < settings->getStarshipModuloGametickSlowdown())
+    {
+        simulation.executeGametick(input, secondInput);
+    }
+    auto secondShot = false;
+    for(auto &bullet : *(state->getBullets()))
+    {
+        secondShot |= bullet.getPosition().getColumn() == 7;
+    }
+    result &= assertEquals(true, secondShot);
+    endTest();
+    return result;
+}
+
+void runGameSimulationTest()
+{
+    printTestName("GameSimulation Test");
+    auto result = gameSimulation_immediateStarshipInputTest();
+    result &= gameSimulation_alignedStarshipInputTest();
+    result &= gameSimulation_centipedeStepsCadenceTest();
+    result &= gameSimulation_lateRoundCentipedeSpeedTest();
+    result &= gameSimulation_secondStarshipTest();
+    printTestSummary(result);
+}
+
+#endif
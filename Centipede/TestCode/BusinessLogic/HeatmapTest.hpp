@@ -0,0 +1,97 @@
+#ifndef HEATMAP_TEST_HPP
+#define HEATMAP_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/BusinessLogic/Heatmap.hpp"
+#include "../../SourceCode/BusinessLogic/HeatmapBatch.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+bool heatmap_recordTest()
+{
+    printSubTestName("Heatmap record test");
+    Heatmap heatmap(4, 5);
+    heatmap.record(HeatmapLayer::centipedeHitLayer, 2, 3);
+    heatmap.record(HeatmapLayer::centipedeHitLayer, 2, 3);
+    heatmap.record(HeatmapLayer::starshipDeathLayer, 3, 4);
+    // Outside of the field.
+    heatmap.record(HeatmapLayer::starshipDeathLayer, 4, 0);
+    heatmap.record(HeatmapLayer::starshipDeathLayer, 0, -1);
+    auto result = assertEquals((uint64_t) 2, heatmap.get(HeatmapLayer::centipedeHitLayer, 2, 3));
+    result &= assertEquals((uint64_t) 0, heatmap.get(HeatmapLayer::starshipDeathLayer, 2, 3));
+    result &= assertEquals((uint64_t) 1, heatmap.get(HeatmapLayer::starshipDeathLayer, 3, 4));
+    result &= assertEquals((uint64_t) 1, heatmap.getMaximum(HeatmapLayer::starshipDeathLayer));
+    endTest();
+    return result;
+}
+
+bool heatmap_mergeTest()
+{
+    printSubTestName("Heatmap merge test");
+    std::vector<std::shared_ptr<Heatmap>> parts;
+    std::vector<Heatmap*> partPointers;
+    for(int part = 0; part < 5; part++)
+    {
+        parts.push_back(std::make_shared<Heatmap>(7, 3));
+        partPointers.push_back(parts.back().get());
+        for(int line = 0; line <= part; line++)
+        {
+            parts.back()->record(HeatmapLayer::mushroomLayer, line, 1);
+        }
+        parts.back()->recordGame();
+    }
+    // More threads than lines of some bands.
+    Heatmap merged(7, 3);
+    merged.merge(partPointers, 3);
+    auto result = assertEquals((uint64_t) 5, merged.get(HeatmapLayer::mushroomLayer, 0, 1));
+    result &= assertEquals((uint64_t) 1, merged.get(HeatmapLayer::mushroomLayer, 4, 1));
+    result &= assertEquals((uint64_t) 0, merged.get(HeatmapLayer::mushroomLayer, 6, 1));
+    result &= assertEquals((uint64_t) 5, merged.getGames());
+
+    Heatmap otherSize(6, 3);
+    auto thrown = false;
+    try
+    {
+        otherSize.merge(partPointers, 2);
+    }
+    catch(const std::logic_error&)
+    {
+        thrown = true;
+    }
+    result &= assertEquals(true, thrown);
+    endTest();
+    return result;
+}
+
+bool heatmap_batchThreadsTest()
+{
+    printSubTestName("Heatmap batch threads test");
+    HeatmapBatch single(6, 1, 3000, 1);
+    HeatmapBatch parallel(6, 3, 3000, 1);
+    auto singleHeatmap_ptr = single.run();
+    auto parallelHeatmap_ptr = parallel.run();
+    std::ostringstream singleCsv;
+    std::ostringstream parallelCsv;
+    singleHeatmap_ptr->writeCsv(singleCsv);
+    parallelHeatmap_ptr->writeCsv(parallelCsv);
+    // Every game has its seed, no matter which worker plays it.
+    auto result = assertEquals(true, singleCsv.str() == parallelCsv.str());
+    result &= assertEquals(single.getGameTicks(), parallel.getGameTicks());
+    result &= assertEquals((uint64_t) 6, parallelHeatmap_ptr->getGames());
+    result &= assertEquals(true, parallelHeatmap_ptr->getMaximum(HeatmapLayer::centipedeHitLayer) > 0);
+    result &= assertEquals(true, parallelHeatmap_ptr->getRounds() > 0);
+    endTest();
+    return result;
+}
+
+void runHeatmapTest()
+{
+    printTestName("Heatmap Test");
+    auto result = heatmap_recordTest();
+    result &= heatmap_mergeTest();
+    result &= heatmap_batchThreadsTest();
+    printTestSummary(result);
+}
+
+#endif
@@ -0,0 +1,233 @@
+#ifndef ROLLBACK_SESSION_TEST_HPP
+#define ROLLBACK_SESSION_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/BusinessLogic/RollbackSession.hpp"
+#include "../../SourceCode/Network/ILockstepLink.hpp"
+#include "../Persistence/SaveStateSerializerTest.hpp"
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using TestLinkQueue = std::deque<std::pair<int, TickInput>>;
+
+/**
+ * Link between two sessions of a test, an input arrives the given number of steps after it was sent.
+ */
+class DelayedLockstepLink : public ILockstepLink
+{
+    private:
+        std::shared_ptr<int> step_ptr;
+        int delay;
+        std::shared_ptr<TestLinkQueue> outgoing_ptr;
+        std::shared_ptr<TestLinkQueue> incoming_ptr;
+
+    public:
+        bool connected;
+
+        DelayedLockstepLink(std::shared_ptr<int> step_ptr, int delay, std::shared_ptr<TestLinkQueue> outgoing_ptr, std::shared_ptr<TestLinkQueue> incoming_ptr)
+            : step_ptr(step_ptr), delay(delay), outgoing_ptr(outgoing_ptr), incoming_ptr(incoming_ptr)
+        {
+            this->connected = true;
+        }
+
+        void send(TickInput input) override
+        {
+            this->outgoing_ptr->emplace_back(*(this->step_ptr) + this->delay, input);
+        }
+
+        bool receive(std::vector<TickInput> &inputs) override
+        {
+            while(!this->incoming_ptr->empty() && this->incoming_ptr->front().first <= *(this->step_ptr))
+            {
+                inputs.push_back(this->incoming_ptr->front().second);
+                this->incoming_ptr->pop_front();
+            }
+            return this->connected;
+        }
+};
+
+/**
+ * Hands one scripted TickInput per gametick to a session, nothing after the script.
+ * A session may run a few gameticks beyond the end of the game, until it learns that the other player quit.
+ */
+class ScriptedTickInputReader : public IInputBufferReader
+{
+    public:
+        std::deque<TickInput> inputs;
+
+        Direction getAndResetDirection() override
+        {
+            return this->inputs.empty() ? Direction::none : this->inputs.front().getDirection();
+        }
+
+        bool getAndResetShot() override
+        {
+            return !this->inputs.empty() && this->inputs.front().getShot();
+        }
+
+        bool getAndResetBreakoutMenu() override
+        {
+            if(this->inputs.empty())
+            {
+                return false;
+            }
+            // Read last by the session.
+            auto quit = this->inputs.front().getQuit();
+            this->inputs.pop_front();
+            return quit;
+        }
+};
+
+/**
+ * Player 0 walks left and right and shoots every 7th gametick, player 1 walks up and down and shoots every 5th.
+ * Player 0 quits in the last gametick.
+ */
+TickInput getRollbackTestInput(int player, int gameTick, int lastGameTick)
+{
+    auto direction = Direction::none;
+    if(gameTick % 9 == 0)
+    {
+        auto firstHalf = gameTick % 18 == 0;
+        direction = player == 0 ? (firstHalf ? Direction::left : Direction::right) : (firstHalf ? Direction::up : Direction::down);
+    }
+    auto shot = gameTick % (player == 0 ? 7 : 5) == 0;
+    return TickInput(gameTick, direction, shot, player == 0 && gameTick == lastGameTick);
+}
+
+std::shared_ptr<SaveState> createRollbackTestState(std::shared_ptr<CentipedeSettings> settings)
+{
+    auto state = createPersistenceTestState(settings, 5);
+    state->setSecondStarship(std::make_shared<Starship>(settings->getPlayingFieldHeight() - 1, 8, settings));
+    return state;
+}
+
+bool isSameRollbackTestState(std::shared_ptr<CentipedeSettings> settings, SaveState &expected, SaveState &actual)
+{
+    auto expectedPosition = expected.getSecondStarship()->getPosition();
+    auto actualPosition = actual.getSecondStarship()->getPosition();
+    return serializeForTest(settings, expected) == serializeForTest(settings, actual)
+        && expectedPosition.getLine() == actualPosition.getLine()
+        && expectedPosition.getColumn() == actualPosition.getColumn();
+}
+
+bool rollbackSession_copyFromTest()
+{
+    printSubTestName("RollbackSession snapshot copy test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createRollbackTestState(settings);
+    auto snapshot = GameSimulation::createNewGame(settings, 9, 2);
+    auto snapshotBullets = snapshot->getBullets();
+    snapshot->copyFrom(*state);
+    auto result = assertEquals(true, isSameRollbackTestState(settings, *state, *snapshot));
+    // The storage of the snapshot is reused.
+    result &= assertEquals(true, snapshot->getBullets() == snapshotBullets);
+
+    // Back to the snapshot after the game went on.
+    GameSimulation simulation(state);
+    LatchedInputBuffer input;
+    LatchedInputBuffer secondInput;
+    for(int gameTick = 1; gameTick <= 20; gameTick++)
+    {
+        input.add(getRollbackTestInput(0, gameTick, -1));
+        secondInput.add(getRollbackTestInput(1, gameTick, -1));
+        simulation.executeGametick(input, secondInput);
+    }
+    result &= assertEquals(false, isSameRollbackTestState(settings, *state, *snapshot));
+    state->copyFrom(*snapshot);
+    result &= assertEquals(true, isSameRollbackTestState(settings, *createRollbackTestState(settings), *state));
+    endTest();
+    return result;
+}
+
+bool rollbackSession_sameAsWithoutDelayTest()
+{
+    printSubTestName("RollbackSession same as without delay test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    int lastGameTick = 300;
+
+    // Reference: both inputs known in every gametick.
+    auto reference = createRollbackTestState(settings);
+    GameSimulation simulation(reference);
+    LatchedInputBuffer referenceInputs[2];
+    for(int gameTick = 1; gameTick <= lastGameTick && simulation.alive(); gameTick++)
+    {
+        for(int player = 0; player < 2; player++)
+        {
+            referenceInputs[player].add(getRollbackTestInput(player, gameTick, lastGameTick));
+        }
+        simulation.executeGametick(referenceInputs[0], referenceInputs[1]);
+    }
+    simulation.quit();
+
+    // Both sides with inputs arriving late, in different steps.
+    auto step_ptr = std::make_shared<int>(0);
+    auto toSecond_ptr = std::make_shared<TestLinkQueue>();
+    auto toFirst_ptr = std::make_shared<TestLinkQueue>();
+    auto firstState = createRollbackTestState(settings);
+    auto secondState = createRollbackTestState(settings);
+    RollbackSession first(firstState, std::make_shared<DelayedLockstepLink>(step_ptr, 3, toSecond_ptr, toFirst_ptr), 0, 8);
+    RollbackSession second(secondState, std::make_shared<DelayedLockstepLink>(step_ptr, 5, toFirst_ptr, toSecond_ptr), 1, 8);
+    ScriptedTickInputReader firstInput;
+    ScriptedTickInputReader secondInput;
+    for(int gameTick = 1; gameTick <= lastGameTick; gameTick++)
+    {
+        firstInput.inputs.push_back(getRollbackTestInput(0, gameTick, lastGameTick));
+        secondInput.inputs.push_back(getRollbackTestInput(1, gameTick, lastGameTick));
+    }
+    for(; *step_ptr < 10 * lastGameTick && !(first.isFinished() && second.isFinished()); (*step_ptr)++)
+    {
+        first.advance(firstInput);
+        second.advance(secondInput);
+    }
+
+    auto result = assertEquals(true, first.isFinished() && second.isFinished());
+    result &= assertEquals(true, isSameRollbackTestState(settings, *reference, *firstState));
+    result &= assertEquals(true, isSameRollbackTestState(settings, *reference, *secondState));
+    result &= assertEquals(true, first.getRollbacks() > 0 && second.getRollbacks() > 0);
+    endTest();
+    return result;
+}
+
+bool rollbackSession_waitsForOtherPlayerTest()
+{
+    printSubTestName("RollbackSession waits for other player test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto step_ptr = std::make_shared<int>(0);
+    auto link_ptr = std::make_shared<DelayedLockstepLink>(step_ptr, 0, std::make_shared<TestLinkQueue>(), std::make_shared<TestLinkQueue>());
+    RollbackSession session(createRollbackTestState(settings), link_ptr, 0, 4);
+    ScriptedTickInputReader input;
+    for(int gameTick = 1; gameTick <= 10; gameTick++)
+    {
+        input.inputs.push_back(getRollbackTestInput(0, gameTick, -1));
+    }
+
+    // Nothing arrives: four gameticks ahead, then it waits without reading input.
+    auto advanced = 0;
+    for(int attempt = 0; attempt < 10; attempt++)
+    {
+        advanced += session.advance(input);
+    }
+    auto result = assertEquals(4, advanced);
+    result &= assertEquals(4, session.getLastGameTick());
+    result &= assertEquals((size_t) 6, input.inputs.size());
+    result &= assertEquals(6L, session.getStalls());
+    result &= assertEquals(false, session.isAbandoned());
+
+    link_ptr->connected = false;
+    result &= assertEquals(false, session.advance(input));
+    result &= assertEquals(true, session.isAbandoned());
+    endTest();
+    return result;
+}
+
+void runRollbackSessionTest()
+{
+    printTestName("RollbackSession Test");
+    auto result = rollbackSession_copyFromTest();
+    result &= rollbackSession_sameAsWithoutDelayTest();
+    result &= rollbackSession_waitsForOtherPlayerTest();
+    printTestSummary(result);
+}
+
+#endif
@@ -0,0 +1,86 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/Common/MemoryAccounting.hpp"
+#include "../../SourceCode/Common/SessionMemoryPool.hpp"
+#include <memory>
+#include <thread>
+
+using TestPoolVector = AccountedVector<int, MemorySubsystem::bulletMemory>;
+
+bool sessionMemoryPool_recyclesBlocksTest()
+{
+    printSubTestName("SessionMemoryPool recycles blocks test");
+    SessionMemory memory;
+    SessionMemoryScope scope(memory);
+    auto first = std::make_unique<TestPoolVector>(10);
+    auto address = first->data();
+    first = nullptr;
+    auto second = std::make_unique<TestPoolVector>(12);
+    auto result = assertEquals(true, address == second->data());
+    result &= assertEquals(true, SessionMemoryPool::getCurrent() == &memory.getPool());
+    result &= assertEquals((size_t) 64 * 1024, memory.getPool().getChunkBytes());
+    endTest();
+    return result;
+}
+
+bool sessionMemoryPool_remoteFreesReturnTest()
+{
+    printSubTestName("SessionMemoryPool remote frees return test");
+    SessionMemory memory;
+    SessionMemoryScope scope(memory);
+    auto vector_ptr = std::make_unique<TestPoolVector>(10);
+    auto address = vector_ptr->data();
+    // Freed by a thread without the pool, e.g. the autosave.
+    std::thread([&vector_ptr]()
+    {
+        vector_ptr = nullptr;
+    }).join();
+    auto reused = std::make_unique<TestPoolVector>(10);
+    auto result = assertEquals(true, address == reused->data());
+    endTest();
+    return result;
+}
+
+bool sessionMemoryPool_outlivesSessionTest()
+{
+    printSubTestName("SessionMemoryPool outlives session test");
+    auto liveBytes = MemoryAccount::getLiveBytes(MemorySubsystem::bulletMemory);
+    std::unique_ptr<TestPoolVector> leftOver_ptr;
+    auto outside = std::make_unique<TestPoolVector>(10);
+    {
+        SessionMemory memory;
+        SessionMemoryScope scope(memory);
+        leftOver_ptr = std::make_unique<TestPoolVector>(10);
+        // Allocated before the session, freed to the global heap.
+        outside = nullptr;
+    }
+    auto result = assertEquals(true, SessionMemoryPool::getCurrent() == nullptr);
+    (*leftOver_ptr)[9] = 7;
+    result &= assertEquals(7, (*leftOver_ptr)[9]);
+    // The last block of the ended session releases its pool.
+    leftOver_ptr = nullptr;
+    result &= assertEquals(liveBytes, MemoryAccount::getLiveBytes(MemorySubsystem::bulletMemory));
+    endTest();
+    return result;
+}
+
+bool sessionMemoryPool_bigBlocksFromHeapTest()
+{
+    printSubTestName("SessionMemoryPool big blocks from heap test");
+    SessionMemory memory;
+    SessionMemoryScope scope(memory);
+    TestPoolVector big(100000, 3);
+    auto result = assertEquals(3, big[99999]);
+    result &= assertEquals((size_t) 0, memory.getPool().getChunkBytes());
+    endTest();
+    return result;
+}
+
+void runSessionMemoryPoolTest()
+{
+    printTestName("SessionMemoryPool Test");
+    auto result = sessionMemoryPool_recyclesBlocksTest();
+    result &= sessionMemoryPool_remoteFreesReturnTest();
+    result &= sessionMemoryPool_outlivesSessionTest();
+    result &= sessionMemoryPool_bigBlocksFromHeapTest();
+    printTestSummary(result);
+}
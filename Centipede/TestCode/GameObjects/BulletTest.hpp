@@ -52,6 +52,21 @@ bool bullet_moveOutOfBoundsTest()
     return result;
 }
 
+bool bullet_memoryAccountingTest()
+{
+    printSubTestName("Bullet memory accounting test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto liveBytes = MemoryAccount::getLiveBytes(MemorySubsystem::bulletMemory);
+    auto bullets_ptr = std::make_shared<BulletVector>();
+    bullets_ptr->reserve(3);
+    bullets_ptr->push_back(Bullet(7, 2, settings));
+    auto result = assertEquals((int64_t) (liveBytes + 3 * sizeof(Bullet)), MemoryAccount::getLiveBytes(MemorySubsystem::bulletMemory));
+    bullets_ptr = nullptr;
+    result &= assertEquals(liveBytes, MemoryAccount::getLiveBytes(MemorySubsystem::bulletMemory));
+    endTest();
+    return result;
+}
+
 void runBulletTest()
 {
     printTestName("Bullet Test");
@@ -59,5 +74,6 @@ void runBulletTest()
     result &= bullet_getPositionTest();
     result &= bullet_moveTest();
     result &= bullet_moveOutOfBoundsTest();
+    result &= bullet_memoryAccountingTest();
     printTestSummary(result);
 }
\ No newline at end of file
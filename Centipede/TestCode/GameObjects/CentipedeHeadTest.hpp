@@ -91,7 +91,7 @@ bool centipedeHead_moveLeftTest()
 	printSubTestName("CentipedeHead move left test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	auto position = std::make_shared<Position>(7, 2, settings);
 	auto head = new CentipedeHead(position->getLine(), position->getColumn(), CentipedeMovingDirection::cLeft, settings, 2);
     
@@ -114,7 +114,7 @@ bool centipedeHead_moveRightTest()
 	printSubTestName("CentipedeHead move right test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	auto position = std::make_shared<Position>(7, 2, settings);
 	auto head = new CentipedeHead(position->getLine(), position->getColumn(), CentipedeMovingDirection::cRight, settings, 2);
     
@@ -138,7 +138,7 @@ bool centipedeHead_moveObstacleMushroomTest()
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
     mushroomMap->spawnMushroom(7,3);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	auto position = std::make_shared<Position>(7, 2, settings);
 	auto head = new CentipedeHead(position->getLine(), position->getColumn(), CentipedeMovingDirection::cRight, settings, 2);
     
@@ -163,7 +163,7 @@ bool centipedeHead_moveObstacleFieldEndTest()
 	printSubTestName("CentipedeHead move obstacle field end test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	auto position = std::make_shared<Position>(7, settings->getPlayingFieldWidth()-1, settings);
 	auto head = new CentipedeHead(position->getLine(), position->getColumn(), CentipedeMovingDirection::cRight, settings, 2);
     
@@ -188,7 +188,7 @@ bool centipedeHead_moveObstacleCentipedeTest()
 	printSubTestName("CentipedeHead move obstacle centipede test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	CentipedeHead obstacle(7, 3, CentipedeMovingDirection::cRight, settings, 1);
     centipedes->push_back(obstacle);
 	auto position = std::make_shared<Position>(7, 2, settings);
@@ -215,7 +215,7 @@ bool centipedeHead_moveReachBottomTest()
 	printSubTestName("CentipedeHead move reach bottom test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	auto position = std::make_shared<Position>(settings->getPlayingFieldHeight() - 1, settings->getPlayingFieldWidth()-1, settings);
 	auto head = new CentipedeHead(position->getLine(), position->getColumn(), CentipedeMovingDirection::cRight, settings, 2);
     
@@ -237,7 +237,7 @@ bool centipedeHead_moveDownCentipedeBeneathTest()
 	printSubTestName("CentipedeHead move down centipede beneath test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	CentipedeHead obstacle(8, settings->getPlayingFieldWidth() - 1, CentipedeMovingDirection::cRight, settings, 1);
     centipedes->push_back(obstacle);
 	auto position = std::make_shared<Position>(7, settings->getPlayingFieldWidth() - 1, settings);
@@ -261,7 +261,7 @@ bool centipedeHead_moveDownCentipedeBeneathAndAboveTest()
 	printSubTestName("CentipedeHead move down centipede beneath and above test");
 	auto settings = std::make_shared<CentipedeSettings>();
 	auto mushroomMap = std::make_shared<MushroomMap>(settings);
-	auto centipedes = std::make_shared<std::vector<CentipedeHead>>();
+	auto centipedes = std::make_shared<CentipedeList>();
 	CentipedeHead obstacle1(8, settings->getPlayingFieldWidth() - 1, CentipedeMovingDirection::cRight, settings, 1);
 	CentipedeHead obstacle2(6, settings->getPlayingFieldWidth() - 1, CentipedeMovingDirection::cRight, settings, 1);
     centipedes->push_back(obstacle1);
@@ -282,6 +282,40 @@ bool centipedeHead_moveDownCentipedeBeneathAndAboveTest()
 	return result;
 }
 
+bool centipedeHead_splitKeepsPartsAndHandlesTest()
+{
+	printSubTestName("CentipedeHead split keeps parts and handles test");
+	auto settings = std::make_shared<CentipedeSettings>();
+	auto mushroomMap = std::make_shared<MushroomMap>(settings, false);
+	auto centipedes = std::make_shared<CentipedeList>();
+	centipedes->emplace_back(7, 0, CentipedeMovingDirection::cRight, settings, 5);
+	auto first = centipedes->begin();
+	// Parts start on top of each other, move until all of them are on their own cell.
+	for(int move = 0; move < 4; move++)
+	{
+		first->move(*mushroomMap, *centipedes, settings);
+	}
+	auto third = first->getTail()->getTail();
+	auto fifth = third->getTail()->getTail();
+	auto hitPosition = third->getPosition();
+	Bullet bullet(hitPosition.getLine(), hitPosition.getColumn(), settings);
+
+	auto collision = first->collide(bullet, mushroomMap);
+	centipedes->emplace_back(collision.getItem2());
+
+	auto result = assertEquals(CentipedeHit::tailHit, collision.getItem1());
+	// Head and second part stay, the third got hit and the fourth heads the split without copying the fifth.
+	result &= assertEquals(true, nullptr == first->getTail()->getTail());
+	result &= assertEquals(true, fifth == centipedes->back().getTail());
+	// The handle of the hit centipede is still valid after the split got added.
+	result &= assertEquals(true, &*first == &centipedes->front());
+	result &= assertEquals(2, (int) centipedes->size());
+	result &= assertEquals(true, mushroomMap->getMushroom(hitPosition.getLine(), hitPosition.getColumn()) != 0);
+
+	endTest();
+	return result;
+}
+
 void runCentipedeHeadTest()
 {
 	printTestName("CentipedeHead Test");
@@ -297,6 +331,7 @@ void runCentipedeHeadTest()
 	result &= centipedeHead_moveReachBottomTest();
 	result &= centipedeHead_moveDownCentipedeBeneathTest();
 	result &= centipedeHead_moveDownCentipedeBeneathAndAboveTest();
+	result &= centipedeHead_splitKeepsPartsAndHandlesTest();
 	printTestSummary(result);
 }
 
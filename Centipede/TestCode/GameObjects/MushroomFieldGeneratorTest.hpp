@@ -0,0 +1,114 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/GameObjects/MushroomFieldGenerator.hpp"
+#include "../../SourceCode/GameObjects/MushroomMap.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Field of the given size filled by the generator, row by row.
+ */
+std::vector<std::vector<int8_t>> generateTestField(MushroomFieldGenerator &generator, int lines, int width, bool scalar)
+{
+    std::vector<std::vector<int8_t>> field(lines, std::vector<int8_t>(width, 0));
+    for(int line = 0; line < lines; line++)
+    {
+        generator.generateRow(line, field[line].data(), scalar);
+    }
+    return field;
+}
+
+bool mushroomFieldGenerator_sameSeedSameFieldTest()
+{
+    printSubTestName("MushroomFieldGenerator same seed same field test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    MushroomMap first(settings, true, 7);
+    MushroomMap second(settings, true, 7);
+    MushroomMap other(settings, true, 8);
+    auto same = true;
+    auto different = false;
+    for(int line = 0; line < settings->getPlayingFieldHeight(); line++)
+    {
+        for(int column = 0; column < settings->getPlayingFieldWidth(); column++)
+        {
+            same &= first.getMushroom(line, column) == second.getMushroom(line, column);
+            different |= first.getMushroom(line, column) != other.getMushroom(line, column);
+        }
+    }
+    auto result = assertEquals(true, same);
+    result &= assertEquals(true, different);
+    endTest();
+    return result;
+}
+
+bool mushroomFieldGenerator_vectorizedEqualsScalarTest()
+{
+    printSubTestName("MushroomFieldGenerator vectorized equals scalar test");
+    // Odd width, so that every row ends with cells outside of the vector loop.
+    MushroomFieldGenerator generator(3, 203, 40, 1, 4, 3);
+    auto vectorized = generateTestField(generator, 40, 203, false);
+    auto scalar = generateTestField(generator, 40, 203, true);
+    auto result = assertEquals(true, vectorized == scalar);
+    endTest();
+    return result;
+}
+
+bool mushroomFieldGenerator_parallelBandsEqualRowsTest()
+{
+    printSubTestName("MushroomFieldGenerator parallel bands equal rows test");
+    // Big enough to be split into bands.
+    MushroomFieldGenerator generator(11, 1024, 512, 1, 20, 3);
+    std::vector<std::vector<int8_t>> field(512, std::vector<int8_t>(1024, 0));
+    generator.generate(field, 4);
+    auto result = assertEquals(true, field == generateTestField(generator, 512, 1024, true));
+    endTest();
+    return result;
+}
+
+bool mushroomFieldGenerator_chanceAndHealthTest()
+{
+    printSubTestName("MushroomFieldGenerator chance and health test");
+    MushroomFieldGenerator generator(5, 400, 100, 1, 4, 3);
+    auto field = generateTestField(generator, 100, 400, false);
+    int mushrooms = 0;
+    auto healthInRange = true;
+    for(auto &row : field)
+    {
+        for(auto health : row)
+        {
+            mushrooms += health > 0;
+            healthInRange &= health >= 0 && health <= 3;
+        }
+    }
+    // 10000 expected of 40000 cells.
+    auto result = assertEquals(true, mushrooms > 9500 && mushrooms < 10500);
+    result &= assertEquals(true, healthInRange);
+    MushroomFieldGenerator always(5, 16, 1, 2, 2, 3);
+    auto full = generateTestField(always, 1, 16, false);
+    result &= assertEquals(true, std::find(full[0].begin(), full[0].end(), 0) == full[0].end());
+    endTest();
+    return result;
+}
+
+bool mushroomFieldGenerator_spawnLinesInsideFieldTest()
+{
+    printSubTestName("MushroomFieldGenerator spawn lines inside field test");
+    // The starship line of the test settings is below the field.
+    auto settings = std::make_shared<CentipedeSettings>();
+    MushroomFieldGenerator generator(settings, 1);
+    auto result = assertEquals(settings->getPlayingFieldHeight(), generator.getSpawnLines());
+    endTest();
+    return result;
+}
+
+void runMushroomFieldGeneratorTest()
+{
+    printTestName("MushroomFieldGenerator Test");
+    auto result = mushroomFieldGenerator_sameSeedSameFieldTest();
+    result &= mushroomFieldGenerator_vectorizedEqualsScalarTest();
+    result &= mushroomFieldGenerator_parallelBandsEqualRowsTest();
+    result &= mushroomFieldGenerator_chanceAndHealthTest();
+    result &= mushroomFieldGenerator_spawnLinesInsideFieldTest();
+    printTestSummary(result);
+}
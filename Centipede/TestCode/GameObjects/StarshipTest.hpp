@@ -204,8 +204,8 @@ bool starship_shootTest()
     auto settings = std::make_shared<CentipedeSettings>();
     auto starship = new Starship(7, 2, settings);
     auto bullet = starship->shoot();
-    auto result = assertEquals(starship->getPosition().getLine(), bullet->getPosition().getLine());
-    result &= assertEquals(starship->getPosition().getColumn(), bullet->getPosition().getColumn());
+    auto result = assertEquals(starship->getPosition().getLine(), bullet.getPosition().getLine());
+    result &= assertEquals(starship->getPosition().getColumn(), bullet.getPosition().getColumn());
     delete starship;
     endTest();
     return result;
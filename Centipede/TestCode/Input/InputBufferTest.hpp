@@ -92,6 +92,50 @@ bool inputBuffer_ResetAfterGetBreakoutMenuTest(){
     return result;
 }
 
+bool inputBuffer_QueuedDirectionsTest(){
+    printSubTestName("InputBuffer queued directions test");
+    auto buffer = new InputBuffer;
+    buffer->setDirection(Direction::left);
+    buffer->setDirection(Direction::up);
+    auto result = assertEquals(Direction::left, buffer->getAndResetDirection());
+    result = assertEquals(Direction::up, buffer->getAndResetDirection()) & result;
+    result = assertEquals(Direction::none, buffer->getAndResetDirection()) & result;
+    delete buffer;
+    endTest();
+    return result;
+}
+
+bool inputBuffer_RepeatedDirectionQueuedOnceTest(){
+    printSubTestName("InputBuffer repeated direction queued once test");
+    auto buffer = new InputBuffer;
+    buffer->setDirection(Direction::right);
+    buffer->setDirection(Direction::right);
+    buffer->setDirection(Direction::right);
+    auto result = assertEquals(Direction::right, buffer->getAndResetDirection());
+    result = assertEquals(Direction::none, buffer->getAndResetDirection()) & result;
+    delete buffer;
+    endTest();
+    return result;
+}
+
+bool inputBuffer_FullQueueKeepsNewestTest(){
+    printSubTestName("InputBuffer full queue keeps newest test");
+    auto buffer = new InputBuffer;
+    buffer->setDirection(Direction::left);
+    buffer->setDirection(Direction::up);
+    buffer->setDirection(Direction::right);
+    buffer->setDirection(Direction::down);
+    buffer->setDirection(Direction::left);
+    auto result = assertEquals(Direction::left, buffer->getAndResetDirection());
+    result = assertEquals(Direction::up, buffer->getAndResetDirection()) & result;
+    result = assertEquals(Direction::right, buffer->getAndResetDirection()) & result;
+    result = assertEquals(Direction::left, buffer->getAndResetDirection()) & result;
+    result = assertEquals(Direction::none, buffer->getAndResetDirection()) & result;
+    delete buffer;
+    endTest();
+    return result;
+}
+
 void runInputBufferTest(){
     printTestName("InputBuffer Test");
     auto result = inputBuffer_DefaultValueTest();
@@ -102,5 +146,8 @@ void runInputBufferTest(){
     result &= inputBuffer_ResetAfterGetDirectionTest();
     result &= inputBuffer_ResetAfterGetShotTest();
     result &= inputBuffer_ResetAfterGetBreakoutMenuTest();
+    result &= inputBuffer_QueuedDirectionsTest();
+    result &= inputBuffer_RepeatedDirectionQueuedOnceTest();
+    result &= inputBuffer_FullQueueKeepsNewestTest();
     printTestSummary(result);
 }
\ No newline at end of file
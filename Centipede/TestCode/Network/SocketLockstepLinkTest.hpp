@@ -0,0 +1,93 @@
+#ifndef SOCKET_LOCKSTEP_LINK_TEST_HPP
+#define SOCKET_LOCKSTEP_LINK_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/Network/SocketLockstepLink.hpp"
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+const std::string lockstepTestSocketPath = "lockstepTest.sock";
+
+bool socketLockstepLink_roundTripTest()
+{
+    printSubTestName("SocketLockstepLink round trip test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    std::shared_ptr<SocketLockstepLink> host_ptr;
+    std::thread hostThread([&]()
+    {
+        host_ptr = SocketLockstepLink::host(lockstepTestSocketPath, 1234, *settings);
+    });
+    auto join_ptr = SocketLockstepLink::join(lockstepTestSocketPath, *settings);
+    hostThread.join();
+    auto result = assertEquals(1234u, join_ptr->getSeed());
+
+    host_ptr->send(TickInput(1, Direction::left, true, false));
+    host_ptr->send(TickInput(2, Direction::none, false, true));
+    std::vector<TickInput> inputs;
+    for(int attempt = 0; attempt < 1000 && inputs.size() < 2; attempt++)
+    {
+        join_ptr->receive(inputs);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    result &= assertEquals((size_t) 2, inputs.size());
+    if(inputs.size() == 2)
+    {
+        result &= assertEquals(1, inputs[0].getGameTick());
+        result &= assertEquals(Direction::left, inputs[0].getDirection());
+        result &= assertEquals(true, inputs[0].getShot() && !inputs[0].getQuit());
+        result &= assertEquals(2, inputs[1].getGameTick());
+        result &= assertEquals(true, inputs[1].getQuit() && !inputs[1].getShot());
+    }
+
+    // The joined side notices, that the host is gone.
+    host_ptr = nullptr;
+    auto connected = true;
+    for(int attempt = 0; attempt < 1000 && connected; attempt++)
+    {
+        connected = join_ptr->receive(inputs);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    result &= assertEquals(false, connected);
+    endTest();
+    return result;
+}
+
+bool socketLockstepLink_otherSettingsTest()
+{
+    printSubTestName("SocketLockstepLink other settings test");
+    auto hostSettings = std::make_shared<CentipedeSettings>();
+    auto joinSettings = std::make_shared<CentipedeSettings>();
+    // Like --tick-aligned-input on one side only: the starships would move on other gameticks.
+    joinSettings->setImmediateStarshipInput(!hostSettings->getImmediateStarshipInput());
+    std::shared_ptr<SocketLockstepLink> host_ptr;
+    std::thread hostThread([&]()
+    {
+        host_ptr = SocketLockstepLink::host(lockstepTestSocketPath, 1234, *hostSettings);
+    });
+    std::string message;
+    try
+    {
+        SocketLockstepLink::join(lockstepTestSocketPath, *joinSettings);
+    }
+    catch(const std::logic_error &exception)
+    {
+        message = exception.what();
+    }
+    hostThread.join();
+    auto result = assertEquals(true, message == "The other player uses other settings.");
+    endTest();
+    return result;
+}
+
+void runSocketLockstepLinkTest()
+{
+    printTestName("SocketLockstepLink Test");
+    auto result = socketLockstepLink_roundTripTest();
+    result &= socketLockstepLink_otherSettingsTest();
+    printTestSummary(result);
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef AUTOSAVER_TEST_HPP
+#define AUTOSAVER_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/Persistence/Autosaver.hpp"
+#include "SaveStateSerializerTest.hpp"
+#include <cstdio>
+
+const std::string autosaveTestPath = "autosaveTest.csav";
+
+bool autosaver_cloneIndependentTest()
+{
+    printSubTestName("Autosaver clone independent test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 7);
+    auto snapshot = state->clone();
+    auto bytes = serializeForTest(settings, *snapshot);
+
+    // Change everything the game changes during a gametick.
+    state->incrementGameTick();
+    state->addToScore(5);
+    state->getBullets()->clear();
+    state->getMushroomMap()->setMushroom(3, 4, 0);
+    state->getStarship()->move(Direction::left, *(state->getMushroomMap()));
+    state->getCentipedes()->front().move(*(state->getMushroomMap()), *(state->getCentipedes()), settings);
+    state->getRandom()();
+
+    auto result = assertEquals(true, bytes == serializeForTest(settings, *snapshot));
+    result &= assertEquals(false, bytes == serializeForTest(settings, *state));
+    endTest();
+    return result;
+}
+
+bool autosaver_saveLoadTest()
+{
+    printSubTestName("Autosaver save load test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 7);
+    {
+        Autosaver autosaver(autosaveTestPath, settings);
+        autosaver.save(state->clone());
+        state->addToScore(10);
+        autosaver.save(state->clone());
+        autosaver.waitUntilWritten();
+    }
+    auto loaded = Autosaver::load(autosaveTestPath, settings);
+    auto result = assertEquals(52, loaded->getScore());
+    result &= assertEquals(true, serializeForTest(settings, *state) == serializeForTest(settings, *loaded));
+    std::remove(autosaveTestPath.c_str());
+    endTest();
+    return result;
+}
+
+bool autosaver_discardTest()
+{
+    printSubTestName("Autosaver discard test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 7);
+    Autosaver autosaver(autosaveTestPath, settings);
+    autosaver.save(state->clone());
+    autosaver.waitUntilWritten();
+    autosaver.discard();
+    bool thrown = false;
+    try
+    {
+        Autosaver::load(autosaveTestPath, settings);
+    }
+    catch(const std::logic_error&)
+    {
+        thrown = true;
+    }
+    auto result = assertEquals(true, thrown);
+    result &= assertEquals(0, autosaver.getFailedWrites());
+    endTest();
+    return result;
+}
+
+void runAutosaverTest()
+{
+    printTestName("Autosaver Test");
+    auto result = autosaver_cloneIndependentTest();
+    result &= autosaver_saveLoadTest();
+    result &= autosaver_discardTest();
+    printTestSummary(result);
+}
+
+#endif
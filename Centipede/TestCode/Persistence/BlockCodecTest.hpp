@@ -0,0 +1,113 @@
+#ifndef BLOCK_CODEC_TEST_HPP
+#define BLOCK_CODEC_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../lib/file_lib.hpp"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+std::vector<char> decompressForTest(std::vector<char> &compressed, size_t size)
+{
+    std::vector<char> decompressed(size);
+    BlockCodec::decompress(compressed.data(), compressed.size(), decompressed.data(), size);
+    return decompressed;
+}
+
+bool blockCodec_roundTripTest()
+{
+    printSubTestName("BlockCodec round trip test");
+    // Like a mushroom field: mostly zeros, some small health values, and a part, that doesn't compress.
+    std::vector<char> bytes(20000, 0);
+    std::mt19937 random(3);
+    for(size_t i = 0; i < bytes.size(); i += 1 + random() % 40)
+    {
+        bytes[i] = 1 + random() % 3;
+    }
+    for(size_t i = 15000; i < bytes.size(); i++)
+    {
+        bytes[i] = (char) random();
+    }
+    std::vector<char> compressed;
+    BlockCodec::compress(bytes.data(), bytes.size(), compressed);
+    auto result = assertEquals(true, bytes == decompressForTest(compressed, bytes.size()));
+    result &= assertEquals(true, compressed.size() < bytes.size() / 2);
+    endTest();
+    return result;
+}
+
+bool blockCodec_zerosAndEmptyTest()
+{
+    printSubTestName("BlockCodec zeros and empty test");
+    std::vector<char> zeros(100000, 0);
+    std::vector<char> compressed;
+    BlockCodec::compress(zeros.data(), zeros.size(), compressed);
+    auto result = assertEquals(true, zeros == decompressForTest(compressed, zeros.size()));
+    result &= assertEquals(true, compressed.size() < 500);
+
+    std::vector<char> empty;
+    compressed.clear();
+    BlockCodec::compress(empty.data(), 0, compressed);
+    result &= assertEquals((size_t) 0, decompressForTest(compressed, 0).size());
+    endTest();
+    return result;
+}
+
+bool blockCodec_corruptTest()
+{
+    printSubTestName("BlockCodec corrupt test");
+    std::vector<char> bytes(1000, 7);
+    std::vector<char> compressed;
+    BlockCodec::compress(bytes.data(), bytes.size(), compressed);
+    auto result = true;
+    // Cut off, expecting more bytes than were compressed and a match before the start.
+    std::vector<char> truncated(compressed.begin(), compressed.begin() + compressed.size() / 2);
+    std::vector<char> beforeStart = { 0x00, 0x05, 0x00 };
+    for(auto test : { 0, 1, 2 })
+    {
+        auto thrown = false;
+        try
+        {
+            if(test == 0) decompressForTest(truncated, bytes.size());
+            if(test == 1) decompressForTest(compressed, bytes.size() + 1);
+            if(test == 2) decompressForTest(beforeStart, 4);
+        }
+        catch(const std::logic_error&)
+        {
+            thrown = true;
+        }
+        result &= assertEquals(true, thrown);
+    }
+    endTest();
+    return result;
+}
+
+bool blockCodec_varintTest()
+{
+    printSubTestName("BlockCodec varint test");
+    BinaryWriter writer;
+    writer.writeVarint(0);
+    writer.writeVarint(127);
+    writer.writeVarint(128);
+    writer.writeVarint(UINT64_MAX);
+    auto result = assertEquals((size_t) 1 + 1 + 2 + 10, writer.getSize());
+    BinaryReader reader(writer.getBytes().data(), writer.getSize());
+    result &= assertEquals((uint64_t) 0, reader.readVarint());
+    result &= assertEquals((uint64_t) 127, reader.readVarint());
+    result &= assertEquals((uint64_t) 128, reader.readVarint());
+    result &= assertEquals(UINT64_MAX, reader.readVarint());
+    endTest();
+    return result;
+}
+
+void runBlockCodecTest()
+{
+    printTestName("BlockCodec Test");
+    auto result = blockCodec_roundTripTest();
+    result &= blockCodec_zerosAndEmptyTest();
+    result &= blockCodec_corruptTest();
+    result &= blockCodec_varintTest();
+    printTestSummary(result);
+}
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef REPLAY_TEST_HPP
+#define REPLAY_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/BusinessLogic/ReplayPlayer.hpp"
+#include "../../SourceCode/Input/ReplayInputBuffer.hpp"
+#include "../../SourceCode/Persistence/ReplayReader.hpp"
+#include "../../SourceCode/Persistence/ReplayRecorder.hpp"
+#include "SaveStateSerializerTest.hpp"
+#include <cstdio>
+#include <random>
+
+const std::string replayTestPath = "replayTest.crpl";
+
+/**
+ * Plays a game with scripted input, records it and returns the serialized state after every gametick.
+ * If closeRecording is false, the recorder is left without writing the index, like after a crash.
+ */
+std::vector<std::vector<char>> recordTestGame(std::shared_ptr<CentipedeSettings> settings, int gameTicks, int quitGameTick, bool closeRecording)
+{
+    std::vector<std::vector<char>> states;
+    auto state = createPersistenceTestState(settings, 3);
+    GameSimulation simulation(state);
+    ReplayInputBuffer input;
+    std::mt19937 script(5);
+    auto recorder = std::make_shared<ReplayRecorder>(replayTestPath, settings, 50);
+    recorder->recordKeyframe(*state);
+    states.push_back(serializeForTest(settings, *state));
+
+    while(simulation.alive() && state->getGameTick() < gameTicks)
+    {
+        auto gameTick = state->getGameTick() + 1;
+        TickInput tickInput(gameTick, (Direction) (script() % 5), script() % 3 == 0, false);
+        input.setInput(tickInput);
+        simulation.executeGametick(input);
+        recorder->recordGametick(tickInput, *state);
+        if(gameTick == quitGameTick)
+        {
+            recorder->recordQuit(gameTick);
+            simulation.quit();
+        }
+        states.push_back(serializeForTest(settings, *state));
+    }
+    if(closeRecording)
+    {
+        recorder->close(*state);
+    }
+    else
+    {
+        // Cut the file after the last keyframe, the trailer of the destructor is not written.
+        recorder = nullptr;
+        File file(replayTestPath);
+        auto bytes = file.readAllBytes();
+        bytes->resize(bytes->size() - 40);
+        file.writeAllBytes(bytes->size(), bytes->data());
+    }
+    return states;
+}
+
+bool replay_seekTest()
+{
+    printSubTestName("Replay seek test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto states = recordTestGame(settings, 400, -1, true);
+    auto reader = std::make_shared<ReplayReader>(replayTestPath, settings);
+    ReplayPlayer player(reader, nullptr, nullptr);
+
+    auto result = assertEquals((int) states.size() - 1, reader->getLastGameTick());
+    for(int gameTick : { 0, 1, 49, 50, 51, 123, 250, (int) states.size() - 1 })
+    {
+        if(gameTick >= (int) states.size())
+        {
+            continue;
+        }
+        auto state = player.seek(gameTick);
+        result &= assertEquals(gameTick, state->getGameTick());
+        result &= assertEquals(true, states[gameTick] == serializeForTest(settings, *state));
+    }
+    std::remove(replayTestPath.c_str());
+    endTest();
+    return result;
+}
+
+bool replay_quitTest()
+{
+    printSubTestName("Replay quit test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto states = recordTestGame(settings, 400, 100, true);
+    auto reader = std::make_shared<ReplayReader>(replayTestPath, settings);
+    ReplayPlayer player(reader, nullptr, nullptr);
+
+    auto state = player.seek(100);
+    auto result = assertEquals(100, reader->getLastGameTick());
+    result &= assertEquals(0, state->getLives());
+    result &= assertEquals(true, states[100] == serializeForTest(settings, *state));
+    std::remove(replayTestPath.c_str());
+    endTest();
+    return result;
+}
+
+bool replay_missingIndexTest()
+{
+    printSubTestName("Replay missing index test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto states = recordTestGame(settings, 120, -1, false);
+    auto reader = std::make_shared<ReplayReader>(replayTestPath, settings);
+    ReplayPlayer player(reader, nullptr, nullptr);
+
+    auto state = player.seek(75);
+    auto result = assertEquals(3, reader->getKeyframeCount());
+    result &= assertEquals(true, states[75] == serializeForTest(settings, *state));
+    std::remove(replayTestPath.c_str());
+    endTest();
+    return result;
+}
+
+void runReplayTest()
+{
+    printTestName("Replay Test");
+    auto result = replay_seekTest();
+    result &= replay_quitTest();
+    result &= replay_missingIndexTest();
+    printTestSummary(result);
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef SAVE_STATE_SERIALIZER_TEST_HPP
+#define SAVE_STATE_SERIALIZER_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../lib/binary_lib.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/GameObjects/SaveState.hpp"
+#include "../../SourceCode/Persistence/SaveStateSerializer.hpp"
+
+/**
+ * Creates a game on an empty field with a few mushrooms, a bullet and a centipede.
+ */
+std::shared_ptr<SaveState> createPersistenceTestState(std::shared_ptr<CentipedeSettings> settings, unsigned int seed)
+{
+    auto mushroomMap = std::make_shared<MushroomMap>(settings, false);
+    mushroomMap->setMushroom(3, 4, 3);
+    mushroomMap->setMushroom(5, 7, 2);
+    mushroomMap->setMushroom(6, 1, 1);
+    auto bullets = std::make_shared<BulletVector>();
+    bullets->push_back(Bullet(6, 5, settings));
+    auto starship = std::make_shared<Starship>(settings->getPlayingFieldHeight() - 1, 5, settings);
+    auto centipedes = std::make_shared<CentipedeList>();
+    centipedes->push_back(CentipedeHead(0, 3, CentipedeMovingDirection::cRight, settings, 3));
+    return std::make_shared<SaveState>(settings,
+                                       bullets,
+                                       starship,
+                                       mushroomMap,
+                                       centipedes,
+                                       getCentipedeSpeedForSlowdown(settings->getInitialCentipedeModuloGametickSlowdown()),
+                                       1,
+                                       42,
+                                       settings->getInitialPlayerHealth(),
+                                       seed);
+}
+
+std::vector<char> serializeForTest(std::shared_ptr<CentipedeSettings> settings, SaveState &state)
+{
+    SaveStateSerializer serializer(settings);
+    BinaryWriter writer;
+    serializer.serialize(state, writer);
+    return writer.getBytes();
+}
+
+bool saveStateSerializer_roundTripTest()
+{
+    printSubTestName("SaveStateSerializer round trip test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 7);
+    auto bytes = serializeForTest(settings, *state);
+
+    SaveStateSerializer serializer(settings);
+    BinaryReader reader(bytes.data(), bytes.size());
+    auto restored = serializer.deserialize(reader);
+    auto result = assertEquals(42, restored->getScore());
+    result &= assertEquals(1, restored->getCurrentRound());
+    result &= assertEquals(3, restored->getMushroomMap()->getMushroom(3, 4));
+    result &= assertEquals((size_t) 1, restored->getCentipedes()->size());
+    result &= assertEquals((size_t) 0, reader.getRemaining());
+    result &= assertEquals(true, bytes == serializeForTest(settings, *restored));
+    endTest();
+    return result;
+}
+
+bool saveStateSerializer_randomTest()
+{
+    printSubTestName("SaveStateSerializer random test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 11);
+    state->getRandom()();
+    auto bytes = serializeForTest(settings, *state);
+
+    SaveStateSerializer serializer(settings);
+    BinaryReader reader(bytes.data(), bytes.size());
+    auto restored = serializer.deserialize(reader);
+    auto result = assertEquals(state->getRandom()(), restored->getRandom()());
+    endTest();
+    return result;
+}
+
+bool saveStateSerializer_truncatedTest()
+{
+    printSubTestName("SaveStateSerializer truncated test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 7);
+    auto bytes = serializeForTest(settings, *state);
+
+    SaveStateSerializer serializer(settings);
+    BinaryReader reader(bytes.data(), bytes.size() / 2);
+    bool thrown = false;
+    try
+    {
+        serializer.deserialize(reader);
+    }
+    catch(const std::logic_error&)
+    {
+        thrown = true;
+    }
+    auto result = assertEquals(true, thrown);
+    endTest();
+    return result;
+}
+
+void runSaveStateSerializerTest()
+{
+    printTestName("SaveStateSerializer Test");
+    auto result = saveStateSerializer_roundTripTest();
+    result &= saveStateSerializer_randomTest();
+    result &= saveStateSerializer_truncatedTest();
+    printTestSummary(result);
+}
+
+#endif
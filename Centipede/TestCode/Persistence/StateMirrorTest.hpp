@@ -0,0 +1,85 @@
+#ifndef STATE_MIRROR_TEST_HPP
+#define STATE_MIRROR_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/Persistence/StateMirror.hpp"
+#include "SaveStateSerializerTest.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+const std::string stateMirrorTestPath = "stateMirrorTest.cmir";
+
+/**
+ * Sets the active slot in the header of a mirror file, like a write that got interrupted before switching it.
+ */
+void setStateMirrorTestActiveSlot(uint32_t slot)
+{
+    std::fstream file(stateMirrorTestPath, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(12);
+    file.write(reinterpret_cast<const char*>(&slot), sizeof(slot));
+}
+
+bool stateMirror_updateLoadTest()
+{
+    printSubTestName("StateMirror update load test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto state = createPersistenceTestState(settings, 7);
+    std::vector<char> previous;
+    auto result = true;
+    {
+        // Left without discard, like after a crash.
+        StateMirror mirror(stateMirrorTestPath, settings);
+        mirror.update(*state);
+        previous = serializeForTest(settings, *state);
+        state->incrementGameTick();
+        state->addToScore(10);
+        state->getMushroomMap()->setMushroom(3, 4, 0);
+        mirror.update(*state);
+        // Readable while the game still runs.
+        auto loaded = StateMirror::load(stateMirrorTestPath, settings);
+        result &= assertEquals(52, loaded->getScore());
+        result &= assertEquals(0, mirror.getSkippedGameTicks());
+    }
+    result &= assertEquals(true, StateMirror::isStateMirror(stateMirrorTestPath));
+    result &= assertEquals(true, serializeForTest(settings, *state) == serializeForTest(settings, *StateMirror::load(stateMirrorTestPath, settings)));
+
+    // The other slot still holds the gametick before.
+    setStateMirrorTestActiveSlot(0);
+    result &= assertEquals(true, previous == serializeForTest(settings, *StateMirror::load(stateMirrorTestPath, settings)));
+    std::remove(stateMirrorTestPath.c_str());
+    endTest();
+    return result;
+}
+
+bool stateMirror_emptyAndDiscardTest()
+{
+    printSubTestName("StateMirror empty and discard test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    StateMirror mirror(stateMirrorTestPath, settings);
+    bool thrown = false;
+    try
+    {
+        StateMirror::load(stateMirrorTestPath, settings);
+    }
+    catch(const std::logic_error&)
+    {
+        thrown = true;
+    }
+    auto result = assertEquals(true, thrown);
+
+    mirror.update(*createPersistenceTestState(settings, 7));
+    mirror.discard();
+    result &= assertEquals(false, StateMirror::isStateMirror(stateMirrorTestPath));
+    endTest();
+    return result;
+}
+
+void runStateMirrorTest()
+{
+    printTestName("StateMirror Test");
+    auto result = stateMirror_updateLoadTest();
+    result &= stateMirror_emptyAndDiscardTest();
+    printTestSummary(result);
+}
+
+#endif
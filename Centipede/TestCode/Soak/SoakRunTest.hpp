@@ -0,0 +1,110 @@
+#ifndef SOAK_RUN_TEST_HPP
+#define SOAK_RUN_TEST_HPP
+#include "../../lib/test_lib.hpp"
+#include "../../ToolCode/Soak/SoakRun.hpp"
+#include <chrono>
+#include <string>
+
+void recordSoakTestGameticks(GametickHistogram &histogram, int count, int nanoseconds)
+{
+    for(int gameTick = 0; gameTick < count; gameTick++)
+    {
+        histogram.record(std::chrono::nanoseconds(nanoseconds));
+    }
+}
+
+SoakSample createSoakTestSample(uint64_t residentBytes, double p99Nanoseconds, double allocationsPerGametick)
+{
+    SoakSample sample;
+    sample.residentBytes = residentBytes;
+    sample.p99Nanoseconds = p99Nanoseconds;
+    sample.allocationsPerGametick = allocationsPerGametick;
+    return sample;
+}
+
+bool gametickHistogram_p99Test()
+{
+    printSubTestName("GametickHistogram p99 test");
+    GametickHistogram histogram;
+    // 9 slow of 1000 gameticks are beyond the p99 -> upper end of the bucket of the fast ones.
+    recordSoakTestGameticks(histogram, 991, 1000);
+    recordSoakTestGameticks(histogram, 9, 50000);
+    auto result = assertEquals(1250.0, histogram.takeP99Nanoseconds());
+    // 10 slow ones are not.
+    recordSoakTestGameticks(histogram, 990, 1000);
+    recordSoakTestGameticks(histogram, 10, 50000);
+    result &= assertEquals(50250.0, histogram.takeP99Nanoseconds());
+    // Every take starts a new interval.
+    result &= assertEquals(0.0, histogram.takeP99Nanoseconds());
+    // Anything from 10 ms on lands in the last bucket.
+    recordSoakTestGameticks(histogram, 10, 50000000);
+    result &= assertEquals(10000000.0, histogram.takeP99Nanoseconds());
+    endTest();
+    return result;
+}
+
+bool soakThresholds_residentMemoryTest()
+{
+    printSubTestName("SoakThresholds resident memory test");
+    SoakThresholds thresholds;
+    auto first = createSoakTestSample(100000000, 1000, 4);
+    auto grown = createSoakTestSample(100000000 + thresholds.maxResidentGrowthBytes, 1000, 4);
+    auto result = assertEquals(true, thresholds.checkDrift(first, grown).empty());
+    grown.residentBytes++;
+    auto drift = thresholds.checkDrift(first, grown);
+    result &= assertEquals(true, drift.find("resident memory") != std::string::npos);
+    result &= assertEquals(std::string::npos, drift.find("p99"));
+    // Shrinking is fine.
+    auto shrunk = createSoakTestSample(1000, 1000, 4);
+    result &= assertEquals(true, thresholds.checkDrift(first, shrunk).empty());
+    endTest();
+    return result;
+}
+
+bool soakThresholds_p99Test()
+{
+    printSubTestName("SoakThresholds p99 test");
+    SoakThresholds thresholds;
+    auto first = createSoakTestSample(100000000, 1000, 4);
+    auto slower = createSoakTestSample(100000000, 1000 * thresholds.maxP99Factor, 4);
+    auto result = assertEquals(true, thresholds.checkDrift(first, slower).empty());
+    slower.p99Nanoseconds += 250;
+    auto drift = thresholds.checkDrift(first, slower);
+    result &= assertEquals(true, drift.find("p99 gametick time") != std::string::npos);
+    result &= assertEquals(std::string::npos, drift.find("allocations"));
+    // Without gameticks in the first sample there is nothing to compare with.
+    auto empty = createSoakTestSample(100000000, 0, 4);
+    result &= assertEquals(true, thresholds.checkDrift(empty, slower).empty());
+    endTest();
+    return result;
+}
+
+bool soakThresholds_allocationsTest()
+{
+    printSubTestName("SoakThresholds allocations test");
+    SoakThresholds thresholds;
+    auto first = createSoakTestSample(100000000, 1000, 4);
+    auto more = createSoakTestSample(100000000, 1000, 4 * thresholds.maxAllocationsFactor);
+    auto result = assertEquals(true, thresholds.checkDrift(first, more).empty());
+    more.allocationsPerGametick += 0.5;
+    auto drift = thresholds.checkDrift(first, more);
+    result &= assertEquals(true, drift.find("allocations per gametick") != std::string::npos);
+    result &= assertEquals(std::string::npos, drift.find("resident memory"));
+    // A game without allocations can't grow by a factor.
+    auto none = createSoakTestSample(100000000, 1000, 0);
+    result &= assertEquals(true, thresholds.checkDrift(none, more).empty());
+    endTest();
+    return result;
+}
+
+void runSoakRunTest()
+{
+    printTestName("SoakRun Test");
+    auto result = gametickHistogram_p99Test();
+    result &= soakThresholds_residentMemoryTest();
+    result &= soakThresholds_p99Test();
+    result &= soakThresholds_allocationsTest();
+    printTestSummary(result);
+}
+
+#endif
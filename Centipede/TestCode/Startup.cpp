@@ -1,30 +1,65 @@
 #include "../lib/test_lib.hpp"
 #include "Input/InputBufferTest.hpp"
 #include "Input/KeylistenerTest.hpp"
+#include "Common/SessionMemoryPoolTest.hpp"
 #include "GameObjects/PositionTest.hpp"
 #include "GameObjects/BulletTest.hpp"
 #include "GameObjects/MushroomMapTest.hpp"
+#include "GameObjects/MushroomFieldGeneratorTest.hpp"
 #include "GameObjects/StarshipTest.hpp"
 #include "GameObjects/CentipedePartTest.hpp"
 #include "GameObjects/CentipedeBodyTest.hpp"
 #include "GameObjects/CentipedeHeadTest.hpp"
+#include "UI/GlyphTableTest.hpp"
+#include "UI/GlyphRowSerializerTest.hpp"
+#include "UI/ThemeAtlasTest.hpp"
+#include "UI/FileThemeTest.hpp"
+#include "UI/MenuLayoutTest.hpp"
+#include "UI/OutputBandwidthMonitorTest.hpp"
+#include "UI/ConsoleOutputTest.hpp"
+#include "Persistence/BlockCodecTest.hpp"
+#include "Persistence/SaveStateSerializerTest.hpp"
+#include "BusinessLogic/GameSimulationTest.hpp"
+#include "BusinessLogic/GamePregeneratorTest.hpp"
+#include "BusinessLogic/HeatmapTest.hpp"
+#include "BusinessLogic/RollbackSessionTest.hpp"
+#include "Persistence/ReplayTest.hpp"
+#include "Persistence/AutosaverTest.hpp"
+#include "Persistence/StateMirrorTest.hpp"
+#include "Network/SocketLockstepLinkTest.hpp"
+#include "Soak/SoakRunTest.hpp"
 
 // ###############################
 // Run Tests
 // ###############################
 
 /**
- * Tests for all the Input-Components.
+ * Tests for the Input-Components, that run without a user.
+ */
+void runInputTestSuite()
+{
+    runInputBufferTest();
+}
+
+/**
+ * Tests for the Keylistener.
  * ##########################
  * ! Needs User Interaction !
  * ##########################
  */
-void runInputTestSuite()
+void runKeylistenerTestSuite()
 {
-    runInputBufferTest();
     runKeylistenerTest();
 }
 
+/**
+ * Tests for the parts shared by the whole game.
+ */
+void runCommonTestSuite()
+{
+    runSessionMemoryPoolTest();
+}
+
 /**
  * Tests for all the Game-Object-Classes
  */
@@ -33,14 +68,75 @@ void runGameObjectsTestSuite()
     // runPositionTest();
     runBulletTest();
     // runMushroomMapTest();
+    runMushroomFieldGeneratorTest();
     // runStarshipTest();
     // runCentipedePartTest();
     // runCentipedeBodyTest();
-    // runCentipedeHeadTest();
+    runCentipedeHeadTest();
+}
+
+/**
+ * Tests for the rendering helpers of the UI.
+ */
+void runUITestSuite()
+{
+    runGlyphTableTest();
+    runGlyphRowSerializerTest();
+    runThemeAtlasTest();
+    runFileThemeTest();
+    runMenuLayoutTest();
+    runOutputBandwidthMonitorTest();
+    runConsoleOutputTest();
+}
+
+/**
+ * Tests for the rules of the game.
+ */
+void runBusinessLogicTestSuite()
+{
+    runGameSimulationTest();
+    runGamePregeneratorTest();
+    runHeatmapTest();
+    runRollbackSessionTest();
+}
+
+/**
+ * Tests for saving and replaying games.
+ */
+void runPersistenceTestSuite()
+{
+    runBlockCodecTest();
+    runSaveStateSerializerTest();
+    runReplayTest();
+    runAutosaverTest();
+    runStateMirrorTest();
+}
+
+/**
+ * Tests for playing together with another process.
+ */
+void runNetworkTestSuite()
+{
+    runSocketLockstepLinkTest();
+}
+
+/**
+ * Tests for the decisions of the tools, e.g. when a soak run fails.
+ */
+void runToolsTestSuite()
+{
+    runSoakRunTest();
 }
 
 int main(int argc, char** argv)
 {
-    // runInputTestSuite();
+    runInputTestSuite();
+    // runKeylistenerTestSuite();
+    runCommonTestSuite();
     runGameObjectsTestSuite();
+    runUITestSuite();
+    runBusinessLogicTestSuite();
+    runPersistenceTestSuite();
+    runNetworkTestSuite();
+    runToolsTestSuite();
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/ConsoleOutput.hpp"
+#include "../../SourceCode/UI/MonochromeTheme.hpp"
+#include "../Persistence/SaveStateSerializerTest.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <unistd.h>
+
+/**
+ * Reads everything that is in the pipe right now.
+ */
+std::string readConsoleTestPipe(int descriptor)
+{
+    std::string text;
+    char buffer[4096];
+    ssize_t length;
+    while((length = read(descriptor, buffer, sizeof(buffer))) > 0)
+    {
+        text.append(buffer, length);
+    }
+    return text;
+}
+
+bool consoleOutput_dropsFramesWhilePendingTest()
+{
+    printSubTestName("ConsoleOutput drops frames while pending test");
+    auto settings = std::make_shared<CentipedeSettings>();
+    auto theme_ptr = std::make_shared<MonochromeTheme>();
+    int pipeDescriptors[2];
+    if(pipe(pipeDescriptors) != 0)
+    {
+        auto result = assertEquals(0, errno);
+        endTest();
+        return result;
+    }
+    fcntl(pipeDescriptors[0], F_SETFL, O_NONBLOCK);
+    auto output_ptr = std::make_shared<ConsoleOutput>(theme_ptr, theme_ptr, pipeDescriptors[1]);
+
+    // A terminal, that takes nothing right now.
+    std::string filler(4096, ' ');
+    while(write(pipeDescriptors[1], filler.data(), filler.size()) > 0)
+    {
+    }
+    auto state = createPersistenceTestState(settings, 7);
+    state->addToScore(111 - state->getScore());
+    output_ptr->displayImage(*state, *settings, *theme_ptr);
+    state->addToScore(222 - state->getScore());
+    output_ptr->displayImage(*state, *settings, *theme_ptr);
+
+    // Once the terminal took everything, the started frame is finished and the newest one follows.
+    readConsoleTestPipe(pipeDescriptors[0]);
+    state->addToScore(333 - state->getScore());
+    output_ptr->displayImage(*state, *settings, *theme_ptr);
+    auto text = readConsoleTestPipe(pipeDescriptors[0]);
+    auto first = text.find("Score: 111");
+    auto newest = text.find("Score: 333");
+    auto result = assertEquals(true, first != std::string::npos && newest != std::string::npos && first < newest);
+    result &= assertEquals(std::string::npos, text.find("Score: 222"));
+
+    output_ptr = nullptr;
+    close(pipeDescriptors[0]);
+    endTest();
+    return result;
+}
+
+void runConsoleOutputTest()
+{
+    printTestName("ConsoleOutput Test");
+    auto result = consoleOutput_dropsFramesWhilePendingTest();
+    printTestSummary(result);
+}
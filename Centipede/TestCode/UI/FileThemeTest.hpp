@@ -0,0 +1,122 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/FileTheme.hpp"
+#include "../../SourceCode/UI/GlyphTable.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include <stdexcept>
+#include <string>
+
+/**
+ * Themes/standard.theme, the standard theme as a file.
+ */
+std::string standardThemeFileText()
+{
+    return "# The built-in standard theme.\n"
+           "background = black\n"
+           "foreground = white\n"
+           "\n"
+           "white_space = \" \"\n"
+           "centipede_body = \"☉\"\n"
+           "centipede_head = \"☹︎\"\n"
+           "mushroom_1 = \"⚘\" red\n"
+           "mushroom_2 = \"⚘\" yellow\n"
+           "mushroom_3 = \"⚘\" green   # full health\n"
+           "starship = \"▴\"\n"
+           "bullet = \"▵\"\n"
+           "heart = \"❤︎\"\n"
+           "edge = \"◼︎\"\n";
+}
+
+bool fileTheme_matchesStandardThemeTest()
+{
+    printSubTestName("FileTheme matches standard theme test");
+    FileTheme fileTheme(standardThemeFileText());
+    StandardTheme standardTheme;
+    auto result = assertEquals(true, standardTheme.getColourSetupStart() == fileTheme.getColourSetupStart());
+    result &= assertEquals(true, standardTheme.getColourSetupEnd() == fileTheme.getColourSetupEnd());
+    result &= assertEquals(true, standardTheme.getWhiteSpace() == fileTheme.getWhiteSpace());
+    result &= assertEquals(true, standardTheme.getCentipedeHead() == fileTheme.getCentipedeHead());
+    for(int health = 0; health <= 4; health++)
+    {
+        result &= assertEquals(true, standardTheme.getMushroom(health) == fileTheme.getMushroom(health));
+    }
+    result &= assertEquals(true, standardTheme.getHeart() == fileTheme.getHeart());
+    result &= assertEquals(true, standardTheme.getFieldEdgeTopLeftCorner() == fileTheme.getFieldEdgeTopLeftCorner());
+    result &= assertEquals(true, standardTheme.getFieldEdgeRight() == fileTheme.getFieldEdgeRight());
+    endTest();
+    return result;
+}
+
+bool fileTheme_edgesAndNoColoursTest()
+{
+    printSubTestName("FileTheme edges and no colours test");
+    FileTheme theme("background = none\r\n"
+                    "foreground = none\r\n"
+                    "edge_left = \"|\"\r\n"
+                    "edge = \"#\"\r\n"
+                    "edge_top = -\r\n"
+                    "white_space = \" \"\r\n"
+                    "centipede_body = o\r\n"
+                    "centipede_head = @\r\n"
+                    "mushroom_1 = .\r\n"
+                    "mushroom_2 = m none\r\n"
+                    "mushroom_3 = M\r\n"
+                    "starship = A\r\n"
+                    "bullet = \"|\"\r\n"
+                    "heart = +\r\n");
+    auto result = assertEquals(true, std::string("") == theme.getColourSetupStart());
+    result &= assertEquals(true, std::string("") == theme.getColourSetupEnd());
+    // Set before and after the edge, both win over it.
+    result &= assertEquals(true, std::string("|") == theme.getFieldEdgeLeft());
+    result &= assertEquals(true, std::string("-") == theme.getFieldEdgeTop());
+    result &= assertEquals(true, std::string("#") == theme.getFieldEdgeBottomRightCorner());
+    result &= assertEquals(true, std::string("m") == theme.getMushroom(2));
+    GlyphTable glyphs(theme);
+    result &= assertEquals(true, glyphs.isSingleByte());
+    endTest();
+    return result;
+}
+
+bool fileTheme_errorsTest()
+{
+    printSubTestName("FileTheme errors test");
+    auto standardText = standardThemeFileText();
+    std::string texts[] = {
+        standardText + "rocket = R\n",
+        standardText + "starship = A purple\n",
+        standardText + "starship = \"A\n",
+        standardText + "starship\n",
+        "background = black\nstarship = A\n",
+    };
+    std::string expectedErrors[] = {
+        "Theme file line 15: unknown setting 'rocket'.",
+        "Theme file line 15: unknown colour 'purple'.",
+        "Theme file line 15: missing closing quote.",
+        "Theme file line 15: expected <name> = <value>.",
+        "Theme file misses 'white_space'.",
+    };
+    auto result = true;
+    for(int text = 0; text < 5; text++)
+    {
+        std::string error;
+        try
+        {
+            FileTheme theme(texts[text]);
+        }
+        catch(const std::logic_error &exception)
+        {
+            error = exception.what();
+        }
+        result &= assertEquals(true, expectedErrors[text] == error);
+    }
+    endTest();
+    return result;
+}
+
+void runFileThemeTest()
+{
+    printTestName("FileTheme Test");
+    auto result = fileTheme_matchesStandardThemeTest();
+    result &= fileTheme_edgesAndNoColoursTest();
+    result &= fileTheme_errorsTest();
+    printTestSummary(result);
+}
@@ -0,0 +1,88 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/GlyphTable.hpp"
+#include "../../SourceCode/UI/GlyphRowSerializer.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+
+/**
+ * Theme with a three byte glyph for every cell.
+ */
+class FixedWidthTestTheme : public CompactTheme
+{
+    public:
+        std::string getWhiteSpace() override { return " "; }
+        std::string getCentipedeBody() override { return "☉"; }
+        std::string getCentipedeHead() override { return "☹"; }
+        std::string getMushroom(int health) override { return health == 1 ? "⚘" : "♣"; }
+        std::string getStarship() override { return "▴"; }
+        std::string getBullet() override { return "▵"; }
+};
+
+/**
+ * Serializes a row of all glyphs repeatedly and compares it with appending glyph by glyph.
+ */
+bool glyphRowSerializer_matchesPerCell(ITheme &theme, int count)
+{
+    auto glyphs_ptr = std::make_shared<GlyphTable>(theme);
+    GlyphRowSerializer serializer(glyphs_ptr);
+    std::vector<GlyphId> cells;
+    std::string expected;
+    for(int cell = 0; cell < count; cell++)
+    {
+        auto glyph = (GlyphId) ((cell * 5) % GlyphId::glyphCount);
+        cells.push_back(glyph);
+        expected += glyphs_ptr->getGlyph(glyph);
+    }
+    std::string output = "prefix";
+    serializer.serialize(cells.data(), count, output);
+    return output == "prefix" + expected;
+}
+
+bool glyphRowSerializer_singleByteTest()
+{
+    printSubTestName("GlyphRowSerializer single byte test");
+    CompactTheme theme;
+    auto glyphs_ptr = std::make_shared<GlyphTable>(theme);
+    GlyphRowSerializer serializer(glyphs_ptr);
+    auto result = assertEquals(GlyphSerialization::singleByteLookup, serializer.getSerialization());
+    // Sizes around the vector widths of 16 and 32 cells.
+    for(int count : {0, 1, 15, 16, 17, 31, 32, 33, 100})
+    {
+        result &= assertEquals(true, glyphRowSerializer_matchesPerCell(theme, count));
+    }
+    endTest();
+    return result;
+}
+
+bool glyphRowSerializer_fixedWidthTest()
+{
+    printSubTestName("GlyphRowSerializer fixed width test");
+    FixedWidthTestTheme theme;
+    auto glyphs_ptr = std::make_shared<GlyphTable>(theme);
+    GlyphRowSerializer serializer(glyphs_ptr);
+    auto result = assertEquals(GlyphSerialization::fixedWidthCopy, serializer.getSerialization());
+    result &= assertEquals(true, glyphRowSerializer_matchesPerCell(theme, 29));
+    endTest();
+    return result;
+}
+
+bool glyphRowSerializer_variableWidthTest()
+{
+    printSubTestName("GlyphRowSerializer variable width test");
+    StandardTheme theme;
+    auto glyphs_ptr = std::make_shared<GlyphTable>(theme);
+    GlyphRowSerializer serializer(glyphs_ptr);
+    auto result = assertEquals(GlyphSerialization::variableWidthCopy, serializer.getSerialization());
+    result &= assertEquals(true, glyphRowSerializer_matchesPerCell(theme, 29));
+    endTest();
+    return result;
+}
+
+void runGlyphRowSerializerTest()
+{
+    printTestName("GlyphRowSerializer Test");
+    auto result = glyphRowSerializer_singleByteTest();
+    result &= glyphRowSerializer_fixedWidthTest();
+    result &= glyphRowSerializer_variableWidthTest();
+    printTestSummary(result);
+}
@@ -0,0 +1,60 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/GlyphTable.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+
+bool glyphTable_compactThemeSingleByteTest()
+{
+    printSubTestName("GlyphTable compact theme single byte test");
+    CompactTheme theme;
+    GlyphTable glyphs(theme);
+    auto result = assertEquals(true, glyphs.isSingleByte());
+    result &= assertEquals((size_t) 1, glyphs.getMaxBytesPerCell());
+    endTest();
+    return result;
+}
+
+bool glyphTable_standardThemeBytesPerCellTest()
+{
+    printSubTestName("GlyphTable standard theme bytes per cell test");
+    StandardTheme theme;
+    GlyphTable glyphs(theme);
+    auto result = assertEquals(false, glyphs.isSingleByte());
+    result &= assertEquals(theme.getCentipedeHead().size(), glyphs.getBytesPerCell(GlyphId::centipedeHeadGlyph));
+    result &= assertEquals(theme.getMushroom(2).size(), glyphs.getBytesPerCell(GlyphId::mushroomMediumGlyph));
+    endTest();
+    return result;
+}
+
+bool glyphTable_byteSizeTest()
+{
+    printSubTestName("GlyphTable byte size test");
+    StandardTheme theme;
+    GlyphTable glyphs(theme);
+    GlyphId cells[] = { GlyphId::whiteSpaceGlyph, GlyphId::starshipGlyph, GlyphId::mushroomFullGlyph };
+    auto expected = theme.getWhiteSpace().size() + theme.getStarship().size() + theme.getMushroom(3).size();
+    auto result = assertEquals(expected, glyphs.getByteSize(cells, 3));
+    endTest();
+    return result;
+}
+
+bool glyphTable_mushroomGlyphTest()
+{
+    printSubTestName("GlyphTable mushroom glyph test");
+    auto result = assertEquals(GlyphId::mushroomLowGlyph, GlyphTable::getMushroomGlyph(1));
+    result &= assertEquals(GlyphId::mushroomMediumGlyph, GlyphTable::getMushroomGlyph(2));
+    result &= assertEquals(GlyphId::mushroomFullGlyph, GlyphTable::getMushroomGlyph(3));
+    result &= assertEquals(GlyphId::mushroomFullGlyph, GlyphTable::getMushroomGlyph(5));
+    endTest();
+    return result;
+}
+
+void runGlyphTableTest()
+{
+    printTestName("GlyphTable Test");
+    auto result = glyphTable_compactThemeSingleByteTest();
+    result &= glyphTable_standardThemeBytesPerCellTest();
+    result &= glyphTable_byteSizeTest();
+    result &= glyphTable_mushroomGlyphTest();
+    printTestSummary(result);
+}
@@ -0,0 +1,99 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/MenuLayout.hpp"
+#include "../../SourceCode/UI/ConsoleOutput.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/MonochromeTheme.hpp"
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+bool menuLayout_wrappingTest()
+{
+    printSubTestName("MenuLayout wrapping test");
+    MonochromeTheme theme;
+    ThemeAtlas atlas(theme);
+    std::string title = "Title";
+    std::vector<std::string> textLines = { "" };
+    // 25 characters on a field 10 wide -> 3 lines.
+    std::vector<std::string> options = { "Continue", "abcdefghijklmnopqrstuvwxy" };
+    MenuLayout layout(title, ConsoleColour::Red, textLines, options, 10, 20, atlas);
+    auto &lines = layout.select(-1);
+    auto result = assertEquals((size_t) 20 + 4, lines.size());
+    // Two blank lines, title, blank line, empty text line, then the options.
+    result &= assertEquals(true, lines[4] == RenderedLine(12, ' '));
+    result &= assertEquals(true, lines[5] == " Continue   ");
+    result &= assertEquals(true, lines[6] == " abcdefghij ");
+    result &= assertEquals(true, lines[7] == " klmnopqrst ");
+    result &= assertEquals(true, lines[8] == " uvwxy      ");
+    result &= assertEquals(true, lines[23] == RenderedLine(12, ' '));
+    endTest();
+    return result;
+}
+
+bool menuLayout_selectTest()
+{
+    printSubTestName("MenuLayout select test");
+    MonochromeTheme theme;
+    ThemeAtlas atlas(theme);
+    std::string title = "Title";
+    std::vector<std::string> textLines;
+    std::vector<std::string> options = { "One", "abcdefghijklmnopqrstuvwxy", "Three" };
+    MenuLayout layout(title, ConsoleColour::Red, textLines, options, 10, 20, atlas);
+    auto plain = layout.select(-1);
+    auto &lines = layout.select(1);
+    auto result = true;
+    for(size_t line = 0; line < lines.size(); line++)
+    {
+        // Only the three lines of the second option are bold.
+        auto isOption = line >= 5 && line < 8;
+        result &= assertEquals(isOption, lines[line] != plain[line]);
+    }
+    result &= assertEquals(true, std::string_view(lines[5]) == AnsiExcapeCodes::boldOn + " abcdefghij " + AnsiExcapeCodes::boldOff);
+    layout.select(2);
+    result &= assertEquals(true, lines[5] == plain[5]);
+    result &= assertEquals(true, lines[8] != plain[8]);
+    result &= assertEquals(true, layout.select(-1) == plain);
+    result &= assertEquals(true, layout.matches(title, ConsoleColour::Red, textLines, options, 10, 20, atlas));
+    options[2] = "Four";
+    result &= assertEquals(false, layout.matches(title, ConsoleColour::Red, textLines, options, 10, 20, atlas));
+    endTest();
+    return result;
+}
+
+bool menuLayout_redrawOnlySelectionTest()
+{
+    printSubTestName("MenuLayout redraw only selection test");
+    std::ostringstream output;
+    ConsoleOutput ui(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), output);
+    MonochromeTheme theme;
+    CentipedeSettings settings;
+    std::string title = "Pause";
+    std::vector<std::string> textLines = { "Score: 100" };
+    std::vector<std::string> options = { "Continue", "Save", "Quit" };
+    ui.displayMenu(title, ConsoleColour::Yellow, textLines, options, 0, theme, settings);
+    auto fullMenu = output.str().size();
+    ui.displayMenu(title, ConsoleColour::Yellow, textLines, options, 1, theme, settings);
+    auto redraw = output.str().substr(fullMenu);
+    // Options start in line 7: two blank lines, title, blank line and one text line before them.
+    auto result = assertEquals(true, redraw.find(AnsiExcapeCodes::cursorPosition(6, 1)) != std::string::npos);
+    result &= assertEquals(true, redraw.find(AnsiExcapeCodes::cursorPosition(7, 1)) != std::string::npos);
+    result &= assertEquals(true, redraw.find(AnsiExcapeCodes::cursorPosition(8, 1)) == std::string::npos);
+    result &= assertEquals(true, redraw.find(AnsiExcapeCodes::eraseInDisplay) == std::string::npos);
+    // A menu with other content is drawn in full again.
+    options[2] = "Quit game";
+    auto beforeChange = output.str().size();
+    ui.displayMenu(title, ConsoleColour::Yellow, textLines, options, 1, theme, settings);
+    result &= assertEquals(true, output.str().find(AnsiExcapeCodes::eraseInDisplay, beforeChange) != std::string::npos);
+    endTest();
+    return result;
+}
+
+void runMenuLayoutTest()
+{
+    printTestName("MenuLayout Test");
+    auto result = menuLayout_wrappingTest();
+    result &= menuLayout_selectTest();
+    result &= menuLayout_redrawOnlySelectionTest();
+    printTestSummary(result);
+}
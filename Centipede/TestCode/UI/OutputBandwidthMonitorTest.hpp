@@ -0,0 +1,134 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/OutputBandwidthMonitor.hpp"
+#include <chrono>
+
+const int bandwidthTestWindowLength = 500;
+
+/**
+ * Offers the given frames of 1000 bytes within the window with the given index.
+ * The last one arrives at the end of the window and has it evaluated.
+ */
+void offerBandwidthTestWindow(OutputBandwidthMonitor &monitor, std::chrono::steady_clock::time_point start, int window, int sent, int dropped)
+{
+    auto windowStart = start + std::chrono::milliseconds(bandwidthTestWindowLength * window);
+    auto frames = sent + dropped;
+    for(int frame = 0; frame < frames; frame++)
+    {
+        auto offset = frame == frames - 1 ? bandwidthTestWindowLength : 10 * (frame + 1);
+        auto time = windowStart + std::chrono::milliseconds(offset);
+        if(frame < dropped)
+        {
+            monitor.recordDroppedFrame(time);
+        }
+        else
+        {
+            monitor.recordSentFrame(1000, time);
+        }
+    }
+}
+
+bool outputBandwidthMonitor_degradeTest()
+{
+    printSubTestName("OutputBandwidthMonitor degrade test");
+    auto start = std::chrono::steady_clock::now();
+    OutputBandwidthMonitor monitor(bandwidthTestWindowLength, start);
+
+    // 2 of 10 frames dropped is still acceptable.
+    offerBandwidthTestWindow(monitor, start, 0, 8, 2);
+    auto result = assertEquals(OutputQuality::fullFrames, monitor.getQuality());
+    // Nothing is evaluated before the end of the window.
+    monitor.recordDroppedFrame(start + std::chrono::milliseconds(bandwidthTestWindowLength + 100));
+    monitor.recordDroppedFrame(start + std::chrono::milliseconds(bandwidthTestWindowLength + 200));
+    result &= assertEquals(OutputQuality::fullFrames, monitor.getQuality());
+    offerBandwidthTestWindow(monitor, start, 1, 7, 1);
+    result &= assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+
+    // One stage per window, down to monochrome and not further.
+    offerBandwidthTestWindow(monitor, start, 2, 5, 5);
+    result &= assertEquals(OutputQuality::asciiGlyphs, monitor.getQuality());
+    offerBandwidthTestWindow(monitor, start, 3, 5, 5);
+    result &= assertEquals(OutputQuality::monochrome, monitor.getQuality());
+    offerBandwidthTestWindow(monitor, start, 4, 1, 9);
+    result &= assertEquals(OutputQuality::monochrome, monitor.getQuality());
+    endTest();
+    return result;
+}
+
+bool outputBandwidthMonitor_recoverTest()
+{
+    printSubTestName("OutputBandwidthMonitor recover test");
+    auto start = std::chrono::steady_clock::now();
+    OutputBandwidthMonitor monitor(bandwidthTestWindowLength, start);
+    offerBandwidthTestWindow(monitor, start, 0, 5, 5);
+    auto result = assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+
+    // Back up after 4 clean windows, a window with a few dropped frames starts the count again.
+    auto window = 1;
+    for(; window <= 3; window++)
+    {
+        offerBandwidthTestWindow(monitor, start, window, 10, 0);
+    }
+    offerBandwidthTestWindow(monitor, start, window++, 9, 1);
+    result &= assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+    for(int clean = 1; clean <= 4; clean++, window++)
+    {
+        result &= assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+        offerBandwidthTestWindow(monitor, start, window, 10, 0);
+    }
+    result &= assertEquals(OutputQuality::fullFrames, monitor.getQuality());
+
+    // The better stage fails right away -> twice as many clean windows before the next try.
+    offerBandwidthTestWindow(monitor, start, window++, 5, 5);
+    result &= assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+    for(int clean = 1; clean <= 8; clean++, window++)
+    {
+        result &= assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+        offerBandwidthTestWindow(monitor, start, window, 10, 0);
+    }
+    result &= assertEquals(OutputQuality::fullFrames, monitor.getQuality());
+    endTest();
+    return result;
+}
+
+bool outputBandwidthMonitor_throughputTest()
+{
+    printSubTestName("OutputBandwidthMonitor throughput test");
+    auto start = std::chrono::steady_clock::now();
+    OutputBandwidthMonitor monitor(bandwidthTestWindowLength, start);
+    offerBandwidthTestWindow(monitor, start, 0, 5, 5);
+    // Full frames of 1000 bytes at 20 frames per second need 25000 bytes per second with headroom.
+    monitor.recordSaturatedThroughput(10000, std::chrono::seconds(1));
+    auto result = assertEquals(10000.0, monitor.getThroughput());
+
+    // Known to be too slow, until the measurement is outdated after 4 times the recovery windows.
+    auto window = 1;
+    for(; window <= 16; window++)
+    {
+        offerBandwidthTestWindow(monitor, start, window, 10, 0);
+    }
+    result &= assertEquals(OutputQuality::diffOnly, monitor.getQuality());
+    offerBandwidthTestWindow(monitor, start, window, 10, 0);
+    result &= assertEquals(OutputQuality::fullFrames, monitor.getQuality());
+    result &= assertEquals(0.0, monitor.getThroughput());
+
+    // Fast enough for the better stage -> no need to wait for an outdated measurement.
+    OutputBandwidthMonitor fastMonitor(bandwidthTestWindowLength, start);
+    offerBandwidthTestWindow(fastMonitor, start, 0, 5, 5);
+    fastMonitor.recordSaturatedThroughput(30000, std::chrono::seconds(1));
+    for(window = 1; window <= 4; window++)
+    {
+        offerBandwidthTestWindow(fastMonitor, start, window, 10, 0);
+    }
+    result &= assertEquals(OutputQuality::fullFrames, fastMonitor.getQuality());
+    endTest();
+    return result;
+}
+
+void runOutputBandwidthMonitorTest()
+{
+    printTestName("OutputBandwidthMonitor Test");
+    auto result = outputBandwidthMonitor_degradeTest();
+    result &= outputBandwidthMonitor_recoverTest();
+    result &= outputBandwidthMonitor_throughputTest();
+    printTestSummary(result);
+}
@@ -0,0 +1,49 @@
+#include "../../lib/test_lib.hpp"
+#include "../../SourceCode/UI/ThemeAtlas.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include <string>
+
+bool themeAtlas_elementsTest()
+{
+    printSubTestName("ThemeAtlas elements test");
+    StandardTheme theme;
+    ThemeAtlas atlas(theme);
+    auto result = assertEquals(true, theme.getCentipedeHead() == std::string(atlas.get(GlyphId::centipedeHeadGlyph)));
+    result &= assertEquals(true, theme.getMushroom(1) == std::string(atlas.get(GlyphId::mushroomLowGlyph)));
+    result &= assertEquals(true, theme.getHeart() == std::string(atlas.get(ThemeElement::heartElement)));
+    result &= assertEquals(true, theme.getFieldEdgeBottomLeftCorner() == std::string(atlas.get(ThemeElement::fieldEdgeBottomLeftCornerElement)));
+    result &= assertEquals(true, theme.getColourSetupStart() == std::string(atlas.get(ThemeElement::colourSetupStartElement)));
+    result &= assertEquals(true, theme.getColourSetupEnd() == std::string(atlas.get(ThemeElement::colourSetupEndElement)));
+    endTest();
+    return result;
+}
+
+bool themeAtlas_contiguousTest()
+{
+    printSubTestName("ThemeAtlas contiguous test");
+    CompactTheme theme;
+    ThemeAtlas atlas(theme);
+    size_t size = 0;
+    auto result = true;
+    for(int element = 0; element < ThemeElement::themeElementCount; element++)
+    {
+        // Every element starts right after the one before.
+        auto bytes = atlas.get((ThemeElement) element);
+        result &= assertEquals(true, atlas.get((ThemeElement) 0).data() + size == bytes.data());
+        result &= assertEquals(bytes.size(), atlas.getLength((ThemeElement) element));
+        size += bytes.size();
+    }
+    result &= assertEquals(size, atlas.getSize());
+    result &= assertEquals(GlyphSerialization::singleByteLookup, atlas.getRowSerializer().getSerialization());
+    endTest();
+    return result;
+}
+
+void runThemeAtlasTest()
+{
+    printTestName("ThemeAtlas Test");
+    auto result = themeAtlas_elementsTest();
+    result &= themeAtlas_contiguousTest();
+    printTestSummary(result);
+}
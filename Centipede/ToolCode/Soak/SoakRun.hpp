@@ -0,0 +1,273 @@
+#ifndef SOAK_RUN_HPP
+#define SOAK_RUN_HPP
+#include "../../lib/perf_lib.hpp"
+#include "../../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../../SourceCode/Common/CentipedeSettings.hpp"
+#include "../../SourceCode/Common/MemoryAccounting.hpp"
+#include "../../SourceCode/Common/SessionMemoryPool.hpp"
+#include "../../SourceCode/Input/ReplayInputBuffer.hpp"
+#include "../../SourceCode/Input/ScriptedPlayer.hpp"
+#include "../../SourceCode/UI/CompactTheme.hpp"
+#include "../../SourceCode/UI/ConsoleOutput.hpp"
+#include "../../SourceCode/UI/MonochromeTheme.hpp"
+#include "../../SourceCode/UI/NullOutputBuffer.hpp"
+#include "../../SourceCode/UI/StandardTheme.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Measurements of one sample interval of a soak run.
+ */
+class SoakSample
+{
+    public:
+        double minutes = 0;
+        long gameTicks = 0;
+        int games = 0;
+        int highestRound = 0;
+        uint64_t residentBytes = 0;
+        double p99Nanoseconds = 0;
+        double allocationsPerGametick = 0;
+        int64_t accountedBytes = 0;
+};
+
+/**
+ * How far a sample may drift from the first one, before the soak run fails.
+ */
+class SoakThresholds
+{
+    public:
+        // Resident memory may grow by this much, e.g. for caches that fill up over the first games.
+        uint64_t maxResidentGrowthBytes = 32 * 1024 * 1024;
+        double maxP99Factor = 3.0;
+        double maxAllocationsFactor = 2.0;
+
+        /**
+         * Returns an empty string if the sample is within the thresholds, else what drifted.
+         */
+        std::string checkDrift(SoakSample &first, SoakSample &sample)
+        {
+            std::ostringstream drift;
+            if(sample.residentBytes > first.residentBytes + this->maxResidentGrowthBytes)
+            {
+                drift << "resident memory grew from " << first.residentBytes << " to " << sample.residentBytes << " bytes. ";
+            }
+            if(first.p99Nanoseconds > 0 && sample.p99Nanoseconds > first.p99Nanoseconds * this->maxP99Factor)
+            {
+                drift << "p99 gametick time grew from " << first.p99Nanoseconds << " to " << sample.p99Nanoseconds << " ns. ";
+            }
+            if(first.allocationsPerGametick > 0
+               && sample.allocationsPerGametick > first.allocationsPerGametick * this->maxAllocationsFactor)
+            {
+                drift << "allocations per gametick grew from " << first.allocationsPerGametick
+                      << " to " << sample.allocationsPerGametick << ". ";
+            }
+            return drift.str();
+        }
+};
+
+/**
+ * Histogram of the gametick times of a sample interval.
+ * Fixed in size, so that sampling doesn't change the memory the soak run watches.
+ */
+class GametickHistogram
+{
+    public:
+        static constexpr int resolutionNanoseconds = 250;
+        // Gameticks from 10 ms on all land in the last bucket.
+        static constexpr int buckets = 40000;
+
+    private:
+        std::vector<uint32_t> counts;
+        uint32_t count;
+
+    public:
+        GametickHistogram()
+            : counts(buckets, 0)
+        {
+            this->count = 0;
+        }
+
+        void record(std::chrono::steady_clock::duration time)
+        {
+            auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+            auto bucket = std::min<long>(nanoseconds / resolutionNanoseconds, buckets - 1);
+            this->counts[bucket]++;
+            this->count++;
+        }
+
+        /**
+         * Returns the upper end of the bucket, that holds the p99 of the gameticks recorded since the last call,
+         * 0 if there were none, and starts a new interval.
+         */
+        double takeP99Nanoseconds()
+        {
+            auto rank = (uint64_t) (this->count * 0.99);
+            uint64_t seen = 0;
+            double p99 = 0;
+            for(int bucket = 0; bucket < buckets; bucket++)
+            {
+                seen += this->counts[bucket];
+                if(seen > rank)
+                {
+                    p99 = (bucket + 1) * resolutionNanoseconds;
+                    break;
+                }
+            }
+            std::fill(this->counts.begin(), this->counts.end(), 0);
+            this->count = 0;
+            return p99;
+        }
+};
+
+/**
+ * Plays game after game headless with the ScriptedPlayer for hours, as fast as possible and rendered into a sink.
+ * Samples resident memory, the p99 of the gametick time and the allocations every interval
+ * and fails as soon as one of them drifts too far from the first sample.
+ * Catches slow leaks and super-linear growth, that a single game or a benchmark is too short for.
+ */
+class SoakRun
+{
+    private:
+        std::chrono::steady_clock::duration duration;
+        std::chrono::steady_clock::duration sampleInterval;
+        InputPolicy policy;
+        SoakThresholds thresholds;
+        GametickHistogram histogram;
+
+        static int64_t getAccountedAllocations()
+        {
+            int64_t allocations = 0;
+            for(int subsystem = 0; subsystem < MemorySubsystem::memorySubsystemCount; subsystem++)
+            {
+                allocations += MemoryAccount::getTotalAllocations((MemorySubsystem) subsystem);
+            }
+            return allocations;
+        }
+
+        static int64_t getAccountedBytes()
+        {
+            int64_t bytes = 0;
+            for(int subsystem = 0; subsystem < MemorySubsystem::memorySubsystemCount; subsystem++)
+            {
+                bytes += MemoryAccount::getLiveBytes((MemorySubsystem) subsystem);
+            }
+            return bytes;
+        }
+
+        static void printSample(SoakSample &sample)
+        {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(1) << std::setw(8) << sample.minutes << " min"
+                 << std::setw(12) << sample.gameTicks << " ticks" << std::setw(6) << sample.games << " games"
+                 << "  round " << std::setw(4) << sample.highestRound
+                 << "  rss " << std::setw(8) << sample.residentBytes / 1024 << " KiB"
+                 << "  p99 " << std::setw(9) << std::setprecision(0) << sample.p99Nanoseconds << " ns"
+                 << "  allocs/tick " << std::setw(7) << std::setprecision(2) << sample.allocationsPerGametick
+                 << "  accounted " << std::setw(8) << sample.accountedBytes << " B";
+            std::cout << line.str() << std::endl;
+        }
+
+    public:
+        SoakRun(std::chrono::steady_clock::duration duration, std::chrono::steady_clock::duration sampleInterval, InputPolicy policy)
+        {
+            this->duration = duration;
+            this->sampleInterval = sampleInterval;
+            this->policy = policy;
+        }
+
+        /**
+         * Plays until the duration is over or something drifted, returns whether all samples were within the thresholds.
+         */
+        bool run(unsigned int seed)
+        {
+            auto settings_ptr = std::make_shared<CentipedeSettings>();
+            NullOutputBuffer sink;
+            std::ostream output(&sink);
+            ConsoleOutput ui(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), output);
+            StandardTheme theme;
+            ReplayInputBuffer input;
+
+            std::unique_ptr<SessionMemory> sessionMemory_ptr;
+            std::shared_ptr<SaveState> saveState_ptr;
+            std::unique_ptr<GameSimulation> simulation_ptr;
+            std::unique_ptr<ScriptedPlayer> player_ptr;
+            SoakSample sample;
+            SoakSample first;
+            bool hasFirst = false;
+            auto start = std::chrono::steady_clock::now();
+            auto nextSample = start + this->sampleInterval;
+            auto sampleAllocations = getAccountedAllocations();
+            long sampleGameTicks = 0;
+
+            while(true)
+            {
+                if(simulation_ptr == nullptr || !simulation_ptr->alive())
+                {
+                    // Lost games are replaced by new ones, leaks of finished games have to show up as well.
+                    // Every game is a session with its own pool, like in the game.
+                    simulation_ptr = nullptr;
+                    saveState_ptr = nullptr;
+                    sessionMemory_ptr = std::make_unique<SessionMemory>();
+                    SessionMemoryScope sessionMemoryScope(*sessionMemory_ptr);
+                    saveState_ptr = GameSimulation::createNewGame(settings_ptr, seed + sample.games);
+                    simulation_ptr = std::make_unique<GameSimulation>(saveState_ptr);
+                    player_ptr = std::make_unique<ScriptedPlayer>(seed + sample.games, this->policy);
+                    sample.games++;
+                }
+
+                auto tickStart = std::chrono::steady_clock::now();
+                {
+                    SessionMemoryScope sessionMemoryScope(*sessionMemory_ptr);
+                    input.setInput(player_ptr->nextInput(*saveState_ptr));
+                    simulation_ptr->executeGametick(input);
+                    ui.displayImage(*saveState_ptr, *settings_ptr, theme);
+                }
+                auto tickEnd = std::chrono::steady_clock::now();
+                this->histogram.record(tickEnd - tickStart);
+                sample.gameTicks++;
+                sampleGameTicks++;
+                sample.highestRound = std::max(sample.highestRound, saveState_ptr->getCurrentRound());
+
+                if(tickEnd < nextSample)
+                {
+                    continue;
+                }
+                auto allocations = getAccountedAllocations();
+                sample.minutes = std::chrono::duration<double, std::ratio<60>>(tickEnd - start).count();
+                sample.residentBytes = getResidentSetBytes();
+                sample.p99Nanoseconds = this->histogram.takeP99Nanoseconds();
+                sample.allocationsPerGametick = (double) (allocations - sampleAllocations) / std::max(sampleGameTicks, 1L);
+                sample.accountedBytes = getAccountedBytes();
+                printSample(sample);
+                sampleAllocations = allocations;
+                sampleGameTicks = 0;
+                nextSample += this->sampleInterval;
+
+                if(!hasFirst)
+                {
+                    first = sample;
+                    hasFirst = true;
+                }
+                auto drift = this->thresholds.checkDrift(first, sample);
+                if(!drift.empty())
+                {
+                    std::cerr << "Soak run failed after " << sample.minutes << " minutes: " << drift << std::endl;
+                    return false;
+                }
+                if(tickEnd - start >= this->duration)
+                {
+                    return true;
+                }
+            }
+        }
+};
+
+#endif
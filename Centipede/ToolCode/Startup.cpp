@@ -0,0 +1,224 @@
+#include "../SourceCode/BusinessLogic/GameSimulation.hpp"
+#include "../SourceCode/BusinessLogic/HeatmapBatch.hpp"
+#include "../SourceCode/Common/CentipedeSettings.hpp"
+#include "../SourceCode/Input/RecordingInputBuffer.hpp"
+#include "../SourceCode/Input/ReplayInputBuffer.hpp"
+#include "../SourceCode/Input/ScriptedPlayer.hpp"
+#include "../SourceCode/Persistence/ReplayRecorder.hpp"
+#include "../SourceCode/Persistence/StateMirror.hpp"
+#include "Soak/SoakRun.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// ###############################
+// Tools
+// ###############################
+
+/**
+ * Plays the game with the ScriptedPlayer until it is lost or the given number of gameticks is reached.
+ * Every gametick is recorded, if a recorder is given.
+ */
+void playScriptedGame(std::shared_ptr<SaveState> saveState_ptr, unsigned int seed, int gameTicks, ReplayRecorder *recorder_ptr)
+{
+    GameSimulation simulation(saveState_ptr);
+    ScriptedPlayer player(seed);
+    auto input_ptr = std::make_shared<ReplayInputBuffer>();
+    // Only what the game actually read is recorded.
+    RecordingInputBuffer input(input_ptr);
+    while(simulation.alive() && saveState_ptr->getGameTick() < gameTicks)
+    {
+        input_ptr->setInput(player.nextInput(*saveState_ptr));
+        simulation.executeGametick(input);
+        auto tickInput = input.takeTickInput(saveState_ptr->getGameTick());
+        if(recorder_ptr != nullptr)
+        {
+            recorder_ptr->recordGametick(tickInput, *saveState_ptr);
+        }
+    }
+}
+
+/**
+ * Records a game played by the ScriptedPlayer until it is lost or the given number of gameticks is reached.
+ * The game starts in the round after the given one, e.g. with a faster and longer centipede.
+ */
+void generateReplay(std::string filepath, unsigned int seed, int gameTicks, int startRound, int keyframeInterval)
+{
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    auto saveState_ptr = GameSimulation::createNewGame(settings_ptr, seed);
+    for(int round = 0; round < startRound; round++)
+    {
+        saveState_ptr->incrementCurrentRound();
+    }
+    ReplayRecorder recorder(filepath, settings_ptr, keyframeInterval);
+    recorder.recordKeyframe(*saveState_ptr);
+    playScriptedGame(saveState_ptr, seed, gameTicks, &recorder);
+    recorder.close(*saveState_ptr);
+}
+
+/**
+ * Returns the first seed from 1 on, whose game the ScriptedPlayer doesn't lose within the given number of gameticks.
+ * A change of the rules changes which games are lost. The long replay then moves on to the next surviving seed
+ * by this rule, instead of getting shorter or being picked by hand.
+ */
+unsigned int findSurvivingSeed(int gameTicks)
+{
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    for(unsigned int seed = 1; ; seed++)
+    {
+        auto saveState_ptr = GameSimulation::createNewGame(settings_ptr, seed);
+        playScriptedGame(saveState_ptr, seed, gameTicks, nullptr);
+        if(saveState_ptr->getGameTick() >= gameTicks)
+        {
+            return seed;
+        }
+    }
+}
+
+/**
+ * Writes replays of scripted games to the directory, e.g. as training workload for the optimized build.
+ */
+int generateReplays(std::string directory, int count, int gameTicks)
+{
+    CentipedeSettings settings;
+    for(int replay = 0; replay < count; replay++)
+    {
+        auto filepath = directory + "/generated-" + std::to_string(replay) + ".crpl";
+        generateReplay(filepath, replay + 1, gameTicks, 0, settings.getReplayKeyframeInterval());
+        std::cout << filepath << std::endl;
+    }
+    return 0;
+}
+
+/**
+ * Writes the replays of the macro benchmark: a short game, a long game and one that starts in a late round.
+ * Keyframes are rare, the benchmark plays every replay from its start.
+ */
+int generateBenchCorpus(std::string directory)
+{
+    const int keyframeInterval = 10000;
+    const int longGameTicks = 30000;
+    generateReplay(directory + "/short.crpl", 1, 2000, 0, keyframeInterval);
+    auto longSeed = findSurvivingSeed(longGameTicks);
+    generateReplay(directory + "/long.crpl", longSeed, longGameTicks, 0, keyframeInterval);
+    generateReplay(directory + "/late-rounds.crpl", 70, 30000, 40, keyframeInterval);
+    std::cout << "Bench corpus written to " << directory << ", long replay with seed " << longSeed << std::endl;
+    return 0;
+}
+
+/**
+ * Plays headless for the given number of hours, fails if memory, gametick time or allocations drift.
+ */
+int soak(double hours, std::string policyName, int sampleSeconds)
+{
+    if(policyName != "autopilot" && policyName != "random")
+    {
+        std::cerr << "Unknown input policy '" << policyName << "', use autopilot or random." << std::endl;
+        return 1;
+    }
+    auto policy = policyName == "random" ? InputPolicy::randomPolicy : InputPolicy::autopilotPolicy;
+    auto duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::ratio<3600>>(hours));
+    SoakRun soakRun(duration, std::chrono::seconds(sampleSeconds), policy);
+    return soakRun.run(1) ? 0 : 1;
+}
+
+/**
+ * Plays a batch of scripted games on the given number of threads and shows where the layer counted most.
+ * All layers are written to the CSV file, if one is given.
+ */
+int heatmap(int games, int threads, std::string layerName, std::string csvPath)
+{
+    const std::string layerNames[] = { "deaths", "hits", "mushrooms" };
+    auto layer = std::find(std::begin(layerNames), std::end(layerNames), layerName) - std::begin(layerNames);
+    if(layer >= HeatmapLayer::heatmapLayerCount)
+    {
+        std::cerr << "Unknown layer '" << layerName << "', use deaths, hits or mushrooms." << std::endl;
+        return 1;
+    }
+    HeatmapBatch batch(games, threads, 100000, 1);
+    auto start = std::chrono::steady_clock::now();
+    auto heatmap_ptr = batch.run();
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(!csvPath.empty())
+    {
+        std::ofstream csv(csvPath);
+        heatmap_ptr->writeCsv(csv);
+        if(!csv.good())
+        {
+            std::cerr << "Could not write " << csvPath << std::endl;
+            return 1;
+        }
+    }
+    ConsoleOutput ui(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), std::cout);
+    StandardTheme theme;
+    ui.displayHeatmap(*heatmap_ptr, (HeatmapLayer) layer, "Heatmap: " + layerName, theme);
+    std::cout << games << " games, " << batch.getGameTicks() << " gameticks on " << batch.getThreads() << " threads in "
+              << seconds << " s" << std::endl;
+    return 0;
+}
+
+/**
+ * Prints the last complete gametick of a game, that left its state mirror behind, e.g. because it crashed.
+ */
+int inspectStateMirror(std::string filepath)
+{
+    auto settings_ptr = std::make_shared<CentipedeSettings>();
+    auto state_ptr = StateMirror::load(filepath, settings_ptr);
+    ConsoleOutput ui(std::make_shared<CompactTheme>(), std::make_shared<MonochromeTheme>(), std::cout);
+    StandardTheme theme;
+    ui.displayImage(*state_ptr, *settings_ptr, theme);
+    std::cout << "gametick " << state_ptr->getGameTick() << ", round " << state_ptr->getCurrentRound()
+              << ", score " << state_ptr->getScore() << ", lives " << state_ptr->getLives()
+              << ", centipedes " << state_ptr->getCentipedes()->size() << ", bullets " << state_ptr->getBullets()->size()
+              << ", seed " << state_ptr->getRandom().getSeed() << " after " << state_ptr->getRandom().getDraws() << " draws" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    std::string command = argc > 1 ? argv[1] : "";
+    try
+    {
+        if(command == "generate-replays" && argc > 2)
+        {
+            auto count = argc > 3 ? std::stoi(argv[3]) : 8;
+            auto gameTicks = argc > 4 ? std::stoi(argv[4]) : 20000;
+            return generateReplays(argv[2], count, gameTicks);
+        }
+        if(command == "generate-bench-corpus" && argc > 2)
+        {
+            return generateBenchCorpus(argv[2]);
+        }
+        if(command == "heatmap" && argc > 2)
+        {
+            auto threads = argc > 3 ? std::stoi(argv[3]) : 0;
+            auto layerName = argc > 4 ? argv[4] : "deaths";
+            auto csvPath = argc > 5 ? argv[5] : "";
+            return heatmap(std::stoi(argv[2]), threads, layerName, csvPath);
+        }
+        if(command == "soak" && argc > 2)
+        {
+            auto policyName = argc > 3 ? argv[3] : "autopilot";
+            auto sampleSeconds = argc > 4 ? std::stoi(argv[4]) : 60;
+            return soak(std::stod(argv[2]), policyName, sampleSeconds);
+        }
+        if(command == "state-mirror" && argc > 2)
+        {
+            return inspectStateMirror(argv[2]);
+        }
+    }
+    catch(const std::exception &exception)
+    {
+        std::cerr << command << " failed: " << exception.what() << std::endl;
+        return 1;
+    }
+    std::cerr << "Usage: centipedeTools generate-replays <directory> [count] [gameticks]" << std::endl
+              << "       centipedeTools generate-bench-corpus <directory>" << std::endl
+              << "       centipedeTools soak <hours> [autopilot|random] [sample seconds]" << std::endl
+              << "       centipedeTools heatmap <games> [threads] [deaths|hits|mushrooms] [csv file]" << std::endl
+              << "       centipedeTools state-mirror <file>" << std::endl;
+    return 1;
+}
@@ -0,0 +1,13 @@
+#include "CppRandom.hpp"
+
+#include <random>
+#include <iostream>
+//Will be used to obtain a seed for the random number engine
+static std::random_device rd;
+    //Standard mersenne_twister_engine seeded with rd()
+static std::mt19937 gen(rd());
+
+int GetRandomNumberBetween(int lower, int upper){
+    std::uniform_int_distribution<> dis(lower, upper);
+    return dis(gen);
+}
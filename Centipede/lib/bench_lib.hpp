@@ -0,0 +1,48 @@
+#ifndef BENCH_LIB_HPP
+#define BENCH_LIB_HPP
+#include "console_lib.hpp"
+#include <chrono>
+#include <functional>
+#include <string>
+
+// ###############################
+// Benchmark Methods
+// ###############################
+
+/**
+ * prints the Name of the current benchmark to the console.
+ */
+inline void printBenchName(std::string benchName){
+    AnsiExcapeCodes ansiExcapeCodes;
+    std::string dividerLine = "###############################";
+    println(dividerLine);
+    println(ansiExcapeCodes.boldOn + benchName + ansiExcapeCodes.boldOff);
+    println(dividerLine);
+}
+
+/**
+ * Runs the function once to warm up, then the given number of times.
+ * Returns the average duration of one run in nanoseconds.
+ */
+inline double measureNanoseconds(int iterations, std::function<void()> function){
+    function();
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iterations; i++){
+        function();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+/**
+ * prints the duration of a run and its speedup compared to the baseline to the console.
+ */
+inline void printBenchResult(std::string name, double nanoseconds, double baselineNanoseconds){
+    AnsiExcapeCodes ansiExcapeCodes;
+    auto speedup = baselineNanoseconds / nanoseconds;
+    auto colour = speedup >= 1 ? ansiExcapeCodes.foregroundGreen : ansiExcapeCodes.foregroundRed;
+    println(name + ": " + std::to_string((long) nanoseconds) + " ns "
+            + colour + "(" + std::to_string(speedup) + "x)" + ansiExcapeCodes.foregroundDefault);
+}
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef BINARY_LIB_HPP
+#define BINARY_LIB_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Writes values in their in-memory representation one after another into a growing buffer.
+class BinaryWriter{
+    private:
+        std::vector<char> bytes;
+
+    public:
+        template <typename TValue>
+        void write(TValue value){
+            static_assert(std::is_trivially_copyable<TValue>::value, "Only trivially copyable values can be written.");
+            this->writeBytes(reinterpret_cast<const char*>(&value), sizeof(TValue));
+        }
+
+        void writeBytes(const char* data, size_t length){
+            this->bytes.insert(this->bytes.end(), data, data + length);
+        }
+
+        // Writes the length of the string followed by its characters.
+        void writeString(const std::string &text){
+            this->write<uint32_t>(text.size());
+            this->writeBytes(text.data(), text.size());
+        }
+
+        // Writes the value in 7 bit groups, small values take a single byte.
+        void writeVarint(uint64_t value){
+            while(value >= 0x80){
+                this->bytes.push_back((char) ((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            this->bytes.push_back((char) value);
+        }
+
+        // Overwrites a value that was written before, e.g. a length that is known only afterwards.
+        template <typename TValue>
+        void overwrite(size_t position, TValue value){
+            if(position + sizeof(TValue) > this->bytes.size()){
+                throw std::logic_error("Position is beyond the written bytes.");
+            }
+            std::memcpy(&this->bytes[position], &value, sizeof(TValue));
+        }
+
+        size_t getSize(){
+            return this->bytes.size();
+        }
+
+        std::vector<char> &getBytes(){
+            return this->bytes;
+        }
+
+        void clear(){
+            this->bytes.clear();
+        }
+};
+
+// Reads values written by the BinaryWriter from a buffer it doesn't own, e.g. a memory mapped file.
+class BinaryReader{
+    private:
+        const char* data;
+        size_t size;
+        size_t position;
+
+        void require(size_t length){
+            if(length > this->size - this->position){
+                throw std::logic_error("Unexpected end of binary data.");
+            }
+        }
+
+    public:
+        BinaryReader(const char* data, size_t size)
+            : data(data), size(size), position(0)
+        {
+        }
+
+        template <typename TValue>
+        TValue read(){
+            static_assert(std::is_trivially_copyable<TValue>::value, "Only trivially copyable values can be read.");
+            this->require(sizeof(TValue));
+            TValue value;
+            std::memcpy(&value, this->data + this->position, sizeof(TValue));
+            this->position += sizeof(TValue);
+            return value;
+        }
+
+        // Returns a pointer to the next bytes without copying them and skips them.
+        const char* readBytes(size_t length){
+            this->require(length);
+            auto bytes = this->data + this->position;
+            this->position += length;
+            return bytes;
+        }
+
+        std::string readString(){
+            auto length = this->read<uint32_t>();
+            auto bytes = this->readBytes(length);
+            return std::string(bytes, length);
+        }
+
+        uint64_t readVarint(){
+            uint64_t value = 0;
+            for(int shift = 0; shift < 64; shift += 7){
+                auto byte = this->read<uint8_t>();
+                value |= (uint64_t) (byte & 0x7F) << shift;
+                if((byte & 0x80) == 0){
+                    return value;
+                }
+            }
+            throw std::logic_error("Varint is longer than 64 bits.");
+        }
+
+        void seek(size_t position){
+            if(position > this->size){
+                throw std::logic_error("Position is beyond the end of the binary data.");
+            }
+            this->position = position;
+        }
+
+        size_t getPosition(){
+            return this->position;
+        }
+
+        size_t getRemaining(){
+            return this->size - this->position;
+        }
+};
+
+#endif
@@ -92,4 +92,8 @@ std::string AnsiExcapeCodes::backgroundWhite="\e[47m";
 std::string AnsiExcapeCodes::backgroundDefault="\e[49m";
 
 std::string AnsiExcapeCodes::eraseInDisplay="\x1B[2J\x1B[H";
-std::string AnsiExcapeCodes::clearScrollback="\x1B[3J\x1B[H";
\ No newline at end of file
+std::string AnsiExcapeCodes::clearScrollback="\x1B[3J\x1B[H";
+
+std::string AnsiExcapeCodes::cursorPosition(int line, int column){
+    return "\x1B[" + std::to_string(line) + ";" + std::to_string(column) + "H";
+}
\ No newline at end of file
@@ -53,6 +53,9 @@ class AnsiExcapeCodes{
 
     static std::string eraseInDisplay;
     static std::string clearScrollback;
+
+    // Moves the cursor to the given line and column, both starting at 1.
+    static std::string cursorPosition(int line, int column);
 };
 
 #endif
\ No newline at end of file
@@ -4,6 +4,18 @@
 #include <vector>
 #include <fstream>
 #include <memory>
+#include <cstdio>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 File::File(std::string filepath){
     this->filepath = std::string(filepath);
@@ -12,7 +24,6 @@ File::File(std::string filepath){
 }
 
 File::~File(){
-    this->filepath = nullptr;
     this->readstream->close();
     this->writestream->close();
     this->readstream = nullptr;
@@ -140,7 +151,7 @@ bool File::openRead(){
 
 bool File::openWrite(bool appending){
     // Falls bereits geöffnet einfach so lassen.
-    if(this->readstream->is_open()){
+    if(this->writestream->is_open()){
         return false;
     }
 
@@ -190,3 +201,332 @@ void File::appendString(std::string &text){
 
     this->closeAll(isResponsible);
 }
+
+void File::writeAllBytes(int byteCount, char* bytes){
+    bool isResponsible = this->openWrite(false);
+
+    this->writestream->write(bytes, byteCount);
+
+    this->closeAll(isResponsible);
+}
+
+void File::replaceAllBytesDurably(int byteCount, const char* bytes){
+    this->closeAll(true);
+    std::string temporaryPath = this->filepath + ".tmp";
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    int fileDescriptor = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fileDescriptor < 0){
+        std::logic_error notWritable("Die temporäre Datei konnte nicht angelegt werden");
+        throw notWritable;
+    }
+    int written = 0;
+    while(written < byteCount){
+        auto result = write(fileDescriptor, bytes + written, byteCount - written);
+        if(result < 0 && errno == EINTR){
+            continue;
+        }
+        if(result <= 0){
+            close(fileDescriptor);
+            std::remove(temporaryPath.c_str());
+            std::logic_error notWritten("Die temporäre Datei konnte nicht geschrieben werden");
+            throw notWritten;
+        }
+        written += result;
+    }
+    // Inhalt muss auf dem Datenträger sein, bevor die alte Datei ersetzt wird.
+    bool synced = fsync(fileDescriptor) == 0;
+    close(fileDescriptor);
+    if(!synced || rename(temporaryPath.c_str(), this->filepath.c_str()) != 0){
+        std::remove(temporaryPath.c_str());
+        std::logic_error notReplaced("Die Datei konnte nicht ersetzt werden");
+        throw notReplaced;
+    }
+    // Auch die Umbenennung selbst auf den Datenträger schreiben.
+    auto separator = this->filepath.find_last_of('/');
+    std::string directory = separator == std::string::npos ? "." : this->filepath.substr(0, separator + 1);
+    int directoryDescriptor = open(directory.c_str(), O_RDONLY);
+    if(directoryDescriptor >= 0){
+        fsync(directoryDescriptor);
+        close(directoryDescriptor);
+    }
+#else
+    {
+        std::ofstream temporary(temporaryPath, std::ios::binary | std::ios::trunc);
+        temporary.write(bytes, byteCount);
+        temporary.flush();
+        if(!temporary.good()){
+            std::logic_error notWritten("Die temporäre Datei konnte nicht geschrieben werden");
+            throw notWritten;
+        }
+    }
+    // rename ersetzt unter Windows keine bestehende Datei.
+    std::remove(this->filepath.c_str());
+    if(std::rename(temporaryPath.c_str(), this->filepath.c_str()) != 0){
+        std::logic_error notReplaced("Die Datei konnte nicht ersetzt werden");
+        throw notReplaced;
+    }
+#endif
+}
+
+MappedFile::MappedFile(std::string filepath){
+    this->data = nullptr;
+    this->size = 0;
+    this->fileDescriptor = -1;
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    this->fileDescriptor = open(filepath.c_str(), O_RDONLY);
+    if(this->fileDescriptor < 0){
+        std::logic_error fileNotFound("Die angegebene Datei wurde nicht gefunden");
+        throw fileNotFound;
+    }
+    struct stat fileStatus;
+    fstat(this->fileDescriptor, &fileStatus);
+    this->size = fileStatus.st_size;
+    // Leere Dateien können nicht eingeblendet werden.
+    if(this->size == 0){
+        return;
+    }
+    auto mapping = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, this->fileDescriptor, 0);
+    if(mapping != MAP_FAILED){
+        this->data = static_cast<const char*>(mapping);
+        return;
+    }
+    // Einblenden fehlgeschlagen -> Datei stattdessen einlesen.
+    close(this->fileDescriptor);
+    this->fileDescriptor = -1;
+#endif
+    File file(filepath);
+    this->fallback = file.readAllBytes();
+    this->data = this->fallback->data();
+    this->size = this->fallback->size();
+}
+
+MappedFile::~MappedFile(){
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    if(this->fileDescriptor >= 0){
+        if(this->data != nullptr){
+            munmap(const_cast<char*>(this->data), this->size);
+        }
+        close(this->fileDescriptor);
+    }
+#endif
+}
+
+const char* MappedFile::getData(){
+    return this->data;
+}
+
+size_t MappedFile::getSize(){
+    return this->size;
+}
+
+SharedMappedFile::SharedMappedFile(std::string filepath, size_t size){
+    this->data = nullptr;
+    this->size = size;
+    this->fileDescriptor = -1;
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    this->fileDescriptor = open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(this->fileDescriptor < 0){
+        std::logic_error notCreated("Die Datei konnte nicht angelegt werden");
+        throw notCreated;
+    }
+    // Nach dem Leeren ergibt ftruncate eine Datei voller Nullen.
+    if(ftruncate(this->fileDescriptor, size) != 0){
+        close(this->fileDescriptor);
+        std::logic_error notResized("Die Datei konnte nicht vergrößert werden");
+        throw notResized;
+    }
+    auto mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, this->fileDescriptor, 0);
+    if(mapping == MAP_FAILED){
+        close(this->fileDescriptor);
+        std::logic_error notMapped("Die Datei konnte nicht eingeblendet werden");
+        throw notMapped;
+    }
+    this->data = static_cast<char*>(mapping);
+#else
+    std::logic_error notSupported("Geteilt eingeblendete Dateien gibt es auf diesem System nicht");
+    throw notSupported;
+#endif
+}
+
+SharedMappedFile::~SharedMappedFile(){
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    munmap(this->data, this->size);
+    close(this->fileDescriptor);
+#endif
+}
+
+char* SharedMappedFile::getData(){
+    return this->data;
+}
+
+size_t SharedMappedFile::getSize(){
+    return this->size;
+}
+namespace{
+    const size_t minMatch = 4;
+    const size_t maxDistance = 65535;
+    const int hashBits = 12;
+
+    uint32_t load32(const char* data){
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    uint32_t hash32(uint32_t value){
+        return (value * 2654435761u) >> (32 - hashBits);
+    }
+
+    // Längen ab 15 passen nicht ins Token: Rest in Bytes zu 255 plus ein abschließendes Byte.
+    void writeLength(size_t length, std::vector<char>& output){
+        while(length >= 255){
+            output.push_back((char) 255);
+            length -= 255;
+        }
+        output.push_back((char) length);
+    }
+
+    void writeSequence(const char* literals, size_t literalLength, size_t distance, size_t matchLength, std::vector<char>& output){
+        auto literalNibble = literalLength < 15 ? literalLength : 15;
+        auto matchNibble = 0;
+        if(matchLength > 0){
+            matchNibble = matchLength - minMatch < 15 ? matchLength - minMatch : 15;
+        }
+        output.push_back((char) ((literalNibble << 4) | matchNibble));
+        if(literalNibble == 15){
+            writeLength(literalLength - 15, output);
+        }
+        output.insert(output.end(), literals, literals + literalLength);
+        if(matchLength == 0){
+            return;
+        }
+        output.push_back((char) (distance & 0xFF));
+        output.push_back((char) (distance >> 8));
+        if(matchNibble == 15){
+            writeLength(matchLength - minMatch - 15, output);
+        }
+    }
+
+    const size_t copyBlock = 16;
+
+    size_t roundUpToCopyBlock(size_t length){
+        return (length + copyBlock - 1) & ~(copyBlock - 1);
+    }
+
+    // Kopiert in Blöcken von 16 Bytes, schreibt also bis zu 15 Bytes über length hinaus.
+    void copyBlocks(char* target, const char* source, size_t length){
+        for(size_t copied = 0; copied < length; copied += copyBlock){
+            std::memcpy(target + copied, source + copied, copyBlock);
+        }
+    }
+
+    size_t readLength(const unsigned char*& input, const unsigned char* end){
+        size_t length = 0;
+        while(true){
+            if(input >= end){
+                throw std::logic_error("Die komprimierten Daten sind unvollständig");
+            }
+            auto byte = *input++;
+            length += byte;
+            if(byte != 255){
+                return length;
+            }
+        }
+    }
+}
+
+void BlockCodec::compress(const char* data, size_t size, std::vector<char>& output){
+    // Position + 1 des letzten Vorkommens jedes Hashes, 0 für keines.
+    std::vector<uint32_t> table(1 << hashBits, 0);
+    size_t anchor = 0;
+    size_t position = 0;
+    // Bei vielen Fehlversuchen hintereinander größere Schritte: Nicht komprimierbares geht schneller durch.
+    size_t misses = 0;
+    while(size >= minMatch && position <= size - minMatch){
+        auto value = load32(data + position);
+        auto& entry = table[hash32(value)];
+        auto candidate = (size_t) entry;
+        entry = (uint32_t) (position + 1);
+        if(candidate == 0 || position - (candidate - 1) > maxDistance || load32(data + candidate - 1) != value){
+            position += 1 + (misses++ >> 5);
+            continue;
+        }
+        misses = 0;
+        auto match = candidate - 1;
+        auto length = minMatch;
+        while(position + length < size && data[match + length] == data[position + length]){
+            length++;
+        }
+        writeSequence(data + anchor, position - anchor, position - match, length, output);
+        position += length;
+        anchor = position;
+    }
+    writeSequence(data + anchor, size - anchor, 0, 0, output);
+}
+
+void BlockCodec::decompress(const char* data, size_t size, char* output, size_t outputSize){
+    auto input = reinterpret_cast<const unsigned char*>(data);
+    auto end = input + size;
+    size_t written = 0;
+    while(input < end){
+        auto token = *input++;
+        size_t literalLength = token >> 4;
+        if(literalLength == 15){
+            literalLength += readLength(input, end);
+        }
+        if(literalLength > (size_t) (end - input) || literalLength > outputSize - written){
+            throw std::logic_error("Die komprimierten Daten sind beschädigt");
+        }
+        // Meist kurze Literale: Feste Blöcke sind schneller als memcpy mit variabler Länge, solange Platz dahinter ist.
+        if(roundUpToCopyBlock(literalLength) <= (size_t) (end - input) && roundUpToCopyBlock(literalLength) <= outputSize - written){
+            copyBlocks(output + written, reinterpret_cast<const char*>(input), literalLength);
+        }
+        else{
+            std::memcpy(output + written, input, literalLength);
+        }
+        input += literalLength;
+        written += literalLength;
+        // Die letzte Sequenz hat keinen Match.
+        if(input == end){
+            break;
+        }
+        if(end - input < 2){
+            throw std::logic_error("Die komprimierten Daten sind unvollständig");
+        }
+        size_t distance = input[0] | (input[1] << 8);
+        input += 2;
+        size_t matchLength = (token & 0x0F) + minMatch;
+        if((token & 0x0F) == 15){
+            matchLength += readLength(input, end);
+        }
+        if(distance == 0 || distance > written || matchLength > outputSize - written){
+            throw std::logic_error("Die komprimierten Daten sind beschädigt");
+        }
+        auto source = output + written - distance;
+        auto target = output + written;
+        if(distance >= copyBlock && roundUpToCopyBlock(matchLength) <= outputSize - written){
+            copyBlocks(target, source, matchLength);
+        }
+        else if(distance >= matchLength){
+            std::memcpy(target, source, matchLength);
+        }
+        else if(distance == 1){
+            std::memset(target, *source, matchLength);
+        }
+        else{
+            // Überlappend, z.B. Nullfolgen mit Distanz 1: Das Muster einmal kopieren, dann das Kopierte verdoppeln.
+            // Ein Vielfaches der Distanz hat wieder das richtige Muster.
+            std::memcpy(target, source, distance);
+            size_t copied = distance;
+            while(copied < matchLength){
+                auto length = copied < matchLength - copied ? copied : matchLength - copied;
+                std::memcpy(target + copied, target, length);
+                copied += length;
+            }
+        }
+        written += matchLength;
+    }
+    if(written != outputSize){
+        throw std::logic_error("Die komprimierten Daten haben nicht die erwartete Länge");
+    }
+}
@@ -34,6 +34,11 @@ class File{
 
         void appendBytes(int byteCount, char* bytes);
         void appendString(std::string &text);
+        // Ersetzt den gesamten Inhalt der Datei.
+        void writeAllBytes(int byteCount, char* bytes);
+        // Ersetzt den gesamten Inhalt atomar: Schreibt in eine temporäre Datei, schreibt sie auf den Datenträger
+        // und benennt sie dann um. Nach einem Absturz ist entweder der alte oder der neue Inhalt vorhanden.
+        void replaceAllBytesDurably(int byteCount, const char* bytes);
 
     private:
         bool openRead();
@@ -41,4 +46,57 @@ class File{
         void closeAll(bool isResponsible);
 };
 
+// Blendet eine Datei nur lesend in den Speicher ein, ohne sie zu kopieren.
+// Auf Systemen ohne mmap wird die Datei stattdessen komplett eingelesen.
+class MappedFile{
+    private:
+        const char* data;
+        size_t size;
+        int fileDescriptor;
+        std::shared_ptr<std::vector<char>> fallback;
+
+    public:
+        MappedFile(std::string filepath);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const char* getData();
+        size_t getSize();
+};
+
+// Blendet eine Datei fester Größe schreibbar und geteilt in den Speicher ein. Was hineingeschrieben wird,
+// landet ohne weiteren Aufruf in der Datei, auch wenn der Prozess danach abstürzt oder beendet wird.
+// Bei einem Stromausfall kann es dagegen verloren gehen. Gibt es nur auf Systemen mit mmap.
+class SharedMappedFile{
+    private:
+        char* data;
+        size_t size;
+        int fileDescriptor;
+
+    public:
+        // Legt die Datei an oder leert sie und füllt sie mit size Nullbytes.
+        // Wirft einen logic_error, wenn das nicht möglich ist.
+        SharedMappedFile(std::string filepath, size_t size);
+        ~SharedMappedFile();
+        SharedMappedFile(const SharedMappedFile&) = delete;
+        SharedMappedFile& operator=(const SharedMappedFile&) = delete;
+
+        char* getData();
+        size_t getSize();
+};
+
+// Komprimiert Blöcke von Bytes im Stil von LZ4, ohne externe Bibliothek.
+// Jede Sequenz besteht aus einem Token (4 Bit Literal-Länge, 4 Bit Match-Länge - 4), den Literalen
+// und der Distanz (2 Bytes) des Matches. Längen ab 15 werden mit weiteren Bytes verlängert.
+// Die letzte Sequenz besteht nur aus Literalen. Lange Nullfolgen werden zu Matches mit Distanz 1.
+class BlockCodec{
+    public:
+        // Hängt die komprimierten Bytes an output an.
+        static void compress(const char* data, size_t size, std::vector<char>& output);
+        // Entpackt genau outputSize Bytes nach output.
+        // Wirft einen logic_error, wenn die Daten beschädigt sind oder nicht genau passen.
+        static void decompress(const char* data, size_t size, char* output, size_t outputSize);
+};
+
 #endif
\ No newline at end of file
@@ -12,7 +12,7 @@ using namespace std; // Kommentar C++ Gruppe: Finden wir auch kacke, ist aber au
 #define WIN32_LEAN_AND_MEAN
 #define VC_EXTRALEAN
 #include <Windows.h>
-int key_press() { // not working: F11 (-122, toggles fullscreen)
+inline int key_press() { // not working: F11 (-122, toggles fullscreen)
     KEY_EVENT_RECORD keyevent;
     INPUT_RECORD irec;
     DWORD events;
@@ -75,7 +75,7 @@ int key_press() { // not working: F11 (-122, toggles fullscreen)
 #else
 #include <sys/ioctl.h>
 #include <termios.h>
-int key_press() { // not working: ¹ (251), num lock (-144), caps lock (-20), windows key (-91), kontext menu key (-93)
+inline int key_press() { // not working: ¹ (251), num lock (-144), caps lock (-20), windows key (-91), kontext menu key (-93)
     struct termios term;
     tcgetattr(0, &term);
     while(true) {
@@ -0,0 +1,195 @@
+#include "perf_lib.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+PerfCounterGroup::PerfCounterGroup(){
+    this->leader = -1;
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        this->descriptors[counter] = -1;
+        this->ids[counter] = 0;
+    }
+#if defined(__linux__)
+    const uint64_t configs[PerfCounter::perfCounterCount] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = configs[counter];
+        attributes.disabled = this->leader < 0 ? 1 : 0;
+        // Nur den eigenen Code zählen, dafür reichen auch eingeschränkte Rechte.
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+        int descriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, this->leader, 0);
+        if(descriptor < 0){
+            // Zähler nicht verfügbar -> ohne ihn weitermachen.
+            continue;
+        }
+        this->descriptors[counter] = descriptor;
+        ioctl(descriptor, PERF_EVENT_IOC_ID, &this->ids[counter]);
+        if(this->leader < 0){
+            this->leader = descriptor;
+        }
+    }
+    if(this->leader >= 0){
+        ioctl(this->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(this->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+PerfCounterGroup::~PerfCounterGroup(){
+#if defined(__linux__)
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        if(this->descriptors[counter] >= 0){
+            close(this->descriptors[counter]);
+        }
+    }
+#endif
+}
+
+bool PerfCounterGroup::isAvailable(PerfCounter counter){
+    return this->descriptors[counter] >= 0;
+}
+
+bool PerfCounterGroup::isAnyAvailable(){
+    return this->leader >= 0;
+}
+
+void PerfCounterGroup::read(uint64_t values[PerfCounter::perfCounterCount]){
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        values[counter] = 0;
+    }
+#if defined(__linux__)
+    if(this->leader < 0){
+        return;
+    }
+    // Aufbau: Anzahl, dann pro Zähler Wert und Id.
+    uint64_t buffer[1 + 2 * PerfCounter::perfCounterCount];
+    if(::read(this->leader, buffer, sizeof(buffer)) <= 0){
+        return;
+    }
+    for(uint64_t entry = 0; entry < buffer[0] && entry < PerfCounter::perfCounterCount; entry++){
+        for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+            if(this->descriptors[counter] >= 0 && this->ids[counter] == buffer[2 + 2 * entry]){
+                values[counter] = buffer[1 + 2 * entry];
+            }
+        }
+    }
+#endif
+}
+
+PhaseProfiler::PhaseProfiler(std::vector<std::string> phaseNames)
+    : phaseNames(phaseNames), totals(phaseNames.size())
+{
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        this->startValues[counter] = 0;
+    }
+}
+
+void PhaseProfiler::begin(){
+    this->counters.read(this->startValues);
+    this->startTime = std::chrono::steady_clock::now();
+}
+
+void PhaseProfiler::end(int phase){
+    auto endTime = std::chrono::steady_clock::now();
+    uint64_t endValues[PerfCounter::perfCounterCount];
+    this->counters.read(endValues);
+    auto &totals = this->totals[phase];
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        totals.counters[counter] += endValues[counter] - this->startValues[counter];
+    }
+    totals.time += endTime - this->startTime;
+    totals.runs++;
+}
+
+bool PhaseProfiler::hasCounters(){
+    return this->counters.isAnyAvailable();
+}
+
+int PhaseProfiler::getPhaseCount(){
+    return this->phaseNames.size();
+}
+
+std::string PhaseProfiler::getPhaseName(int phase){
+    return this->phaseNames[phase];
+}
+
+std::chrono::steady_clock::duration PhaseProfiler::getTotalTime(int phase){
+    return this->totals[phase].time;
+}
+
+std::string PhaseProfiler::report(){
+    const char* counterNames[PerfCounter::perfCounterCount] = { "cycles", "instructions", "cache misses", "branch misses" };
+    std::ostringstream text;
+    text << std::left << std::setw(16) << "phase" << std::right << std::setw(10) << "runs" << std::setw(14) << "ns/run";
+    for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+        if(this->counters.isAvailable((PerfCounter) counter)){
+            text << std::setw(16) << counterNames[counter];
+        }
+    }
+    text << "\n";
+    for(size_t phase = 0; phase < this->phaseNames.size(); phase++){
+        auto &totals = this->totals[phase];
+        auto runs = totals.runs > 0 ? totals.runs : 1;
+        auto nanoseconds = std::chrono::duration<double, std::nano>(totals.time).count() / runs;
+        text << std::left << std::setw(16) << this->phaseNames[phase] << std::right << std::setw(10) << totals.runs
+             << std::setw(14) << std::fixed << std::setprecision(0) << nanoseconds;
+        for(int counter = 0; counter < PerfCounter::perfCounterCount; counter++){
+            if(this->counters.isAvailable((PerfCounter) counter)){
+                text << std::setw(16) << std::setprecision(1) << (double) totals.counters[counter] / runs;
+            }
+        }
+        text << "\n";
+    }
+    if(!this->hasCounters()){
+        text << "Hardware counters unavailable (perf_event_open failed), only times are shown.\n";
+    }
+    return text.str();
+}
+
+uint64_t getResidentSetBytes(){
+#if defined(__linux__)
+    // Zweite Zahl in statm: residente Seiten.
+    std::ifstream statm("/proc/self/statm");
+    uint64_t pages = 0;
+    uint64_t residentPages = 0;
+    if(statm >> pages >> residentPages){
+        return residentPages * sysconf(_SC_PAGESIZE);
+    }
+#endif
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0){
+#if defined(__APPLE__)
+        return usage.ru_maxrss;
+#else
+        return (uint64_t) usage.ru_maxrss * 1024;
+#endif
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,94 @@
+#ifndef PERF_LIB_HPP
+#define PERF_LIB_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum PerfCounter : int {
+    cpuCycles = 0,
+    instructions = 1,
+    cacheMisses = 2,
+    branchMisses = 3,
+    perfCounterCount = 4
+};
+
+// Hardware-Zähler des aktuellen Threads über perf_event_open.
+// Zähler, die das System nicht anbietet (Rechte, Container, anderes Betriebssystem), bleiben einfach weg.
+class PerfCounterGroup{
+    private:
+        int descriptors[PerfCounter::perfCounterCount];
+        // Kennung jedes Zählers, mit der seine Werte beim Lesen der Gruppe zugeordnet werden.
+        uint64_t ids[PerfCounter::perfCounterCount];
+        int leader;
+
+    public:
+        PerfCounterGroup();
+        ~PerfCounterGroup();
+        PerfCounterGroup(const PerfCounterGroup&) = delete;
+        PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+        bool isAvailable(PerfCounter counter);
+        bool isAnyAvailable();
+        // Liest alle Zähler auf einmal, nicht verfügbare Zähler sind 0.
+        void read(uint64_t values[PerfCounter::perfCounterCount]);
+};
+
+// Summiert Zählerstände und Laufzeit für benannte Abschnitte, z.B. die Phasen eines Gameticks.
+class PhaseProfiler{
+    private:
+        class PhaseTotals{
+            public:
+                uint64_t counters[PerfCounter::perfCounterCount] = {};
+                std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero();
+                uint64_t runs = 0;
+        };
+
+        std::vector<std::string> phaseNames;
+        std::vector<PhaseTotals> totals;
+        PerfCounterGroup counters;
+        uint64_t startValues[PerfCounter::perfCounterCount];
+        std::chrono::steady_clock::time_point startTime;
+
+    public:
+        PhaseProfiler(std::vector<std::string> phaseNames);
+
+        void begin();
+        void end(int phase);
+        bool hasCounters();
+        int getPhaseCount();
+        std::string getPhaseName(int phase);
+        // Gesamte Laufzeit der Phase über alle Durchläufe.
+        std::chrono::steady_clock::duration getTotalTime(int phase);
+        // Tabelle mit den Durchschnittswerten pro Durchlauf jeder Phase.
+        std::string report();
+};
+
+// Aktuell belegter physischer Speicher des Prozesses in Bytes.
+// Ohne /proc (z.B. macOS) der bisherige Höchstwert, 0 wenn gar nichts verfügbar ist.
+uint64_t getResidentSetBytes();
+
+// Misst einen Abschnitt vom Anlegen bis zum Ende des Gültigkeitsbereichs. Ohne Profiler passiert nichts.
+class ProfiledPhase{
+    private:
+        PhaseProfiler* profiler;
+        int phase;
+
+    public:
+        ProfiledPhase(PhaseProfiler* profiler, int phase){
+            this->profiler = profiler;
+            this->phase = phase;
+            if(this->profiler != nullptr){
+                this->profiler->begin();
+            }
+        }
+
+        ~ProfiledPhase(){
+            if(this->profiler != nullptr){
+                this->profiler->end(this->phase);
+            }
+        }
+};
+
+#endif
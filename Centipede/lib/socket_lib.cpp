@@ -0,0 +1,153 @@
+#include "socket_lib.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#if !(defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__CYGWIN__))
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define LOCAL_SOCKETS
+#endif
+
+LocalSocket::LocalSocket(int fileDescriptor){
+    this->fileDescriptor = fileDescriptor;
+}
+
+LocalSocket::~LocalSocket(){
+#ifdef LOCAL_SOCKETS
+    close(this->fileDescriptor);
+#endif
+}
+
+#ifdef LOCAL_SOCKETS
+// Adresse eines Unix Domain Sockets. Der Pfad darf nicht länger sein, als sun_path Platz bietet.
+static sockaddr_un getAddress(std::string &path){
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if(path.empty() || path.size() >= sizeof(address.sun_path)){
+        throw std::logic_error("Der Pfad des Sockets ist leer oder zu lang: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+static int openSocket(){
+    int fileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fileDescriptor < 0){
+        throw std::logic_error("Der Socket konnte nicht angelegt werden.");
+    }
+#ifdef SO_NOSIGPIPE
+    // macOS kennt kein MSG_NOSIGNAL, stattdessen wird SIGPIPE für den ganzen Socket abgeschaltet.
+    int enabled = 1;
+    setsockopt(fileDescriptor, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+    return fileDescriptor;
+}
+#endif
+
+std::unique_ptr<LocalSocket> LocalSocket::listen(std::string path){
+#ifdef LOCAL_SOCKETS
+    auto address = getAddress(path);
+    int listening = openSocket();
+    unlink(path.c_str());
+    if(bind(listening, (sockaddr*) &address, sizeof(address)) != 0 || ::listen(listening, 1) != 0){
+        close(listening);
+        throw std::logic_error("Am Socket " + path + " kann nicht gewartet werden: " + std::strerror(errno));
+    }
+    int connection = accept(listening, nullptr, nullptr);
+    close(listening);
+    unlink(path.c_str());
+    if(connection < 0){
+        throw std::logic_error("Die Gegenstelle konnte nicht angenommen werden: " + std::string(std::strerror(errno)));
+    }
+    return std::unique_ptr<LocalSocket>(new LocalSocket(connection));
+#else
+    throw std::logic_error("Lokale Sockets gibt es nur auf POSIX-Systemen.");
+#endif
+}
+
+std::unique_ptr<LocalSocket> LocalSocket::connect(std::string path, int timeoutMilliseconds){
+#ifdef LOCAL_SOCKETS
+    auto address = getAddress(path);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+    while(true){
+        int connection = openSocket();
+        if(::connect(connection, (sockaddr*) &address, sizeof(address)) == 0){
+            return std::unique_ptr<LocalSocket>(new LocalSocket(connection));
+        }
+        auto error = errno;
+        close(connection);
+        // Die Gegenstelle wartet noch nicht -> später erneut versuchen.
+        auto retry = error == ENOENT || error == ECONNREFUSED;
+        if(!retry || std::chrono::steady_clock::now() >= deadline){
+            throw std::logic_error("Keine Verbindung zum Socket " + path + ": " + std::strerror(error));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+#else
+    throw std::logic_error("Lokale Sockets gibt es nur auf POSIX-Systemen.");
+#endif
+}
+
+bool LocalSocket::sendAll(const char* data, size_t size){
+#ifdef LOCAL_SOCKETS
+#ifdef MSG_NOSIGNAL
+    int flags = MSG_NOSIGNAL;
+#else
+    int flags = 0;
+#endif
+    size_t sent = 0;
+    while(sent < size){
+        auto count = send(this->fileDescriptor, data + sent, size - sent, flags);
+        if(count < 0 && errno == EINTR){
+            continue;
+        }
+        if(count <= 0){
+            return false;
+        }
+        sent += count;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool LocalSocket::receiveAvailable(std::vector<char>& output){
+#ifdef LOCAL_SOCKETS
+    char buffer[4096];
+    while(true){
+        auto count = recv(this->fileDescriptor, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if(count > 0){
+            output.insert(output.end(), buffer, buffer + count);
+            continue;
+        }
+        if(count == 0){
+            // Die Gegenstelle hat die Verbindung geschlossen.
+            return false;
+        }
+        if(errno == EINTR){
+            continue;
+        }
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+#else
+    return false;
+#endif
+}
+
+bool LocalSocket::waitForData(int timeoutMilliseconds){
+#ifdef LOCAL_SOCKETS
+    pollfd request = {};
+    request.fd = this->fileDescriptor;
+    request.events = POLLIN;
+    return poll(&request, 1, timeoutMilliseconds) > 0;
+#else
+    return true;
+#endif
+}
@@ -0,0 +1,37 @@
+#ifndef SOCKET_LIB_HPP
+#define SOCKET_LIB_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Verbindung zu genau einem anderen Prozess auf demselben Rechner über einen Unix Domain Socket.
+// Gibt es nur auf POSIX-Systemen, sonst werfen listen und connect einen logic_error.
+class LocalSocket{
+    private:
+        int fileDescriptor;
+
+        LocalSocket(int fileDescriptor);
+
+    public:
+        ~LocalSocket();
+        LocalSocket(const LocalSocket&) = delete;
+        LocalSocket& operator=(const LocalSocket&) = delete;
+
+        // Legt den Socket unter path an und wartet, bis sich die Gegenstelle verbindet.
+        // Eine alte Datei unter path wird ersetzt, nach dem Verbinden wird sie wieder entfernt.
+        static std::unique_ptr<LocalSocket> listen(std::string path);
+        // Verbindet sich mit dem Socket unter path. Versucht es bis zu timeoutMilliseconds lang,
+        // falls die Gegenstelle noch nicht wartet. Wirft einen logic_error, wenn es nicht gelingt.
+        static std::unique_ptr<LocalSocket> connect(std::string path, int timeoutMilliseconds);
+
+        // Sendet alle Bytes. Gibt false zurück, wenn die Gegenstelle die Verbindung getrennt hat.
+        bool sendAll(const char* data, size_t size);
+        // Hängt alle Bytes, die gerade vorliegen, an output an, ohne zu warten.
+        // Gibt false zurück, wenn die Gegenstelle die Verbindung getrennt hat.
+        bool receiveAvailable(std::vector<char>& output);
+        // Wartet bis zu timeoutMilliseconds lang auf Bytes. Gibt true zurück, wenn Bytes vorliegen oder die Verbindung getrennt wurde.
+        bool waitForData(int timeoutMilliseconds);
+};
+
+#endif
@@ -11,7 +11,7 @@
 /**
  * prints the Name of the current test to the console.
  */
-void printTestName(std::string testName){
+inline void printTestName(std::string testName){
     AnsiExcapeCodes ansiExcapeCodes;
     std::string dividerLine = "###############################";
     println(dividerLine);
@@ -22,11 +22,11 @@ void printTestName(std::string testName){
 /**
  * prints the Name of the current test to the console.
  */
-void printSubTestName(std::string testName){
+inline void printSubTestName(std::string testName){
     print(testName + ": ");
 }
 
-std::string getColouredResult(bool passed, std::string errorMessage){
+inline std::string getColouredResult(bool passed, std::string errorMessage){
     AnsiExcapeCodes ansiExcapeCodes;
     if(passed){
         return ansiExcapeCodes.foregroundGreen + "passed" + ansiExcapeCodes.foregroundDefault;
@@ -38,12 +38,12 @@ std::string getColouredResult(bool passed, std::string errorMessage){
 /**
  * prints a result to the console.
  */
-void printResult(bool passed, std::string errorMessage){
+inline void printResult(bool passed, std::string errorMessage){
     std::string result = getColouredResult(passed, errorMessage);
     print(result + " ");
 }
 
-void printTestSummary(bool passed){
+inline void printTestSummary(bool passed){
     AnsiExcapeCodes ansiExcapeCodes;
     println(ansiExcapeCodes.boldOn + "Summary: " + getColouredResult(passed, "Please check previous messages for details.") + ansiExcapeCodes.boldOff);
 }
@@ -59,7 +59,7 @@ bool assertEquals(TObject expected, TObject actual){
     return equal;
 }
 
-void endTest(){
+inline void endTest(){
     println("");
 }
 
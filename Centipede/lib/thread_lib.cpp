@@ -0,0 +1,58 @@
+#include "thread_lib.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+ThreadPlacement::ThreadPlacement()
+    : ThreadPlacement("", -1, 0, 0)
+{
+}
+
+ThreadPlacement::ThreadPlacement(std::string name, int cpu, int realtimePriority, int niceLevel){
+    this->name = name;
+    this->cpu = cpu;
+    this->realtimePriority = realtimePriority;
+    this->niceLevel = niceLevel;
+}
+
+bool ThreadPlacement::applyToCurrentThread(){
+    bool applied = true;
+#if defined(__linux__)
+    auto thread = pthread_self();
+    if(!this->name.empty()){
+        // Längere Namen lehnt pthread_setname_np ab.
+        applied &= pthread_setname_np(thread, this->name.substr(0, 15).c_str()) == 0;
+    }
+    if(this->cpu >= 0 && this->cpu < CPU_SETSIZE){
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(this->cpu, &cpus);
+        applied &= pthread_setaffinity_np(thread, sizeof(cpus), &cpus) == 0;
+    }
+    if(this->realtimePriority > 0){
+        sched_param parameters = {};
+        parameters.sched_priority = this->realtimePriority;
+        applied &= pthread_setschedparam(thread, SCHED_FIFO, &parameters) == 0;
+    }
+    if(this->niceLevel != 0){
+        // Unter Linux hat jeder Thread seinen eigenen Nice-Wert, adressiert über seine Thread-Id.
+        applied &= setpriority(PRIO_PROCESS, syscall(SYS_gettid), this->niceLevel) == 0;
+    }
+#elif defined(__APPLE__)
+    if(!this->name.empty()){
+        applied &= pthread_setname_np(this->name.c_str()) == 0;
+    }
+    // Feste CPUs, SCHED_FIFO und Nice-Werte pro Thread bietet macOS so nicht an.
+    applied &= this->cpu < 0 && this->realtimePriority <= 0 && this->niceLevel == 0;
+#else
+    applied = this->name.empty() && this->cpu < 0 && this->realtimePriority <= 0 && this->niceLevel == 0;
+#endif
+    return applied;
+}
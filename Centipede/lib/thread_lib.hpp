@@ -0,0 +1,28 @@
+#ifndef THREAD_LIB_HPP
+#define THREAD_LIB_HPP
+
+#include <string>
+
+// Name, CPU und Scheduling eines Threads.
+// Alles, wofür die Rechte fehlen oder was das Betriebssystem nicht kennt, wird stillschweigend ausgelassen.
+class ThreadPlacement{
+    public:
+        // Name in Debuggern und Profilern, unter Linux höchstens 15 Zeichen.
+        std::string name;
+        // CPU, an die der Thread gebunden wird, -1 für beliebige CPUs.
+        int cpu;
+        // Priorität für SCHED_FIFO (1-99), 0 für normales Scheduling.
+        // Vorsicht: ein wartender Thread, der aktiv pollt, blockiert damit seine CPU.
+        int realtimePriority;
+        // Nice-Wert des Threads, 0 lässt ihn unverändert. Negative Werte brauchen meist erweiterte Rechte.
+        int niceLevel;
+
+        ThreadPlacement();
+        ThreadPlacement(std::string name, int cpu, int realtimePriority, int niceLevel);
+
+        // Wendet die Einstellungen auf den aufrufenden Thread an.
+        // Gibt false zurück, wenn etwas davon nicht angewendet werden konnte.
+        bool applyToCurrentThread();
+};
+
+#endif